@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FP16_H__
+#define __NNFW_CKER_FP16_H__
+
+#include "cker/neon/neon_check.h"
+
+#include <Eigen/Core>
+
+#include <cstdint>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Converts float values to IEEE half precision bits, rounding to nearest even
+inline void FloatToFp16(const float *input_data, int size, uint16_t *output_data)
+{
+  int i = 0;
+#if defined(__F16C__)
+  for (; i <= size - 8; i += 8)
+  {
+    const __m256 values = _mm256_loadu_ps(input_data + i);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output_data + i),
+                     _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+  }
+#elif defined(USE_NEON) && defined(__aarch64__)
+  for (; i <= size - 4; i += 4)
+  {
+    vst1_u16(output_data + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(input_data + i))));
+  }
+#endif
+  for (; i < size; ++i)
+  {
+    output_data[i] = Eigen::half_impl::float_to_half_rtne(input_data[i]).x;
+  }
+}
+
+// Widens IEEE half precision bits to float values
+inline void Fp16ToFloat(const uint16_t *input_data, int size, float *output_data)
+{
+  int i = 0;
+#if defined(__F16C__)
+  for (; i <= size - 8; i += 8)
+  {
+    const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_data + i));
+    _mm256_storeu_ps(output_data + i, _mm256_cvtph_ps(values));
+  }
+#elif defined(USE_NEON) && defined(__aarch64__)
+  for (; i <= size - 4; i += 4)
+  {
+    vst1q_f32(output_data + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(input_data + i))));
+  }
+#endif
+  for (; i < size; ++i)
+  {
+    output_data[i] =
+        Eigen::half_impl::half_to_float(Eigen::half_impl::raw_uint16_to_half(input_data[i]));
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FP16_H__
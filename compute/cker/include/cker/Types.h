@@ -34,6 +34,8 @@ enum class FusedActivationFunctionType
   kRelu6 = 1,
   kRelu1 = 2,
   kRelu = 3,
+  kTanh = 4,
+  kSigmoid = 5,
 };
 enum class PaddingType
 {
@@ -106,6 +108,11 @@ struct SoftmaxParams
   int32_t reverse_scaling_divisor;
   int32_t reverse_scaling_right_shift;
   int diff_min;
+  // Quantized softmax output parameters and exp(-input_scale * beta * diff) for diff in
+  // [0, 255] stored in reversed order, populated by PopulateSoftmaxLookupTable
+  int32_t zero_point;
+  float scale;
+  float *table;
 };
 
 struct PackParams
@@ -126,6 +133,24 @@ struct UnpackParams
   int16_t axis;
 };
 
+enum class FusedEpilogueType
+{
+  kNone,
+  kAdd,
+  kMul,
+};
+
+// Elementwise operation that a kernel applies to its output tile after bias and activation
+struct FusedEpilogueParams
+{
+  FusedEpilogueType type{FusedEpilogueType::kNone};
+  // Operand of the output shape, or of the output depth if per_channel is true
+  const float *operand_data{nullptr};
+  bool per_channel{false};
+  float float_activation_min{std::numeric_limits<float>::lowest()};
+  float float_activation_max{std::numeric_limits<float>::max()};
+};
+
 struct ConvParams
 {
   PaddingType padding_type;
@@ -149,6 +174,8 @@ struct ConvParams
   float float_activation_min;
   float float_activation_max;
   bool is_replaced_weights{false};
+  // float only
+  FusedEpilogueParams epilogue;
 };
 
 struct ComparisonParams
@@ -202,7 +229,7 @@ struct BinaryArithmeticOpParam
 struct TransposeParams
 {
   int8_t perm_count;
-  int32_t perm[4];
+  int32_t perm[6];
 };
 
 struct ConcatenationParams
@@ -265,11 +292,34 @@ struct L2NormParams
   int32_t input_zero_point;
 };
 
+struct LocalResponseNormalizationParams
+{
+  int32_t range;
+  double bias;
+  double alpha;
+  double beta;
+};
+
 struct GatherParams
 {
   int32_t axis;
 };
 
+struct BCQFullyConnectedParams
+{
+  // Number of valid input features, which binary code rows are padded from to multiple of 32
+  int32_t weights_hidden_size;
+  float float_activation_min;
+  float float_activation_max;
+};
+
+struct BCQGatherParams
+{
+  // Number of valid columns, which binary code rows are padded from to multiple of 32
+  int32_t input_hidden_size;
+  int32_t axis;
+};
+
 struct InstanceNormParams
 {
   float epsilon;
@@ -285,6 +335,14 @@ struct ResizeBilinearParams
   bool half_pixel_centers;
 };
 
+struct ResizeNearestNeighborParams
+{
+  int32_t output_height;
+  int32_t output_width;
+  bool align_corners;
+  bool half_pixel_centers;
+};
+
 struct TransposeConvParams
 {
   PaddingType padding_type;
@@ -363,6 +421,20 @@ struct SpaceToDepthParams
   int32_t block_size;
 };
 
+struct LSTMParams
+{
+  // Activation of cell input and cell output, usually tanh
+  FusedActivationFunctionType activation;
+  // Bounds of cell state and projected output, no clipping if 0
+  float cell_clip;
+  float proj_clip;
+};
+
+struct RNNParams
+{
+  FusedActivationFunctionType activation;
+};
+
 enum class Order
 {
   kColMajor,
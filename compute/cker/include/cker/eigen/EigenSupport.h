@@ -61,6 +61,15 @@ template <typename Device, typename T> struct MatMulConvFunctor
   {
     out.device(d) = in0.contract(in1, dim_pair);
   }
+
+  // Same as above, and output_kernel is applied to each finished block of out
+  template <typename OutputKernel>
+  void operator()(const Device &d, EigenMatrix out, ConstEigenMatrix in0, ConstEigenMatrix in1,
+                  const Eigen::array<Eigen::IndexPair<Eigen::DenseIndex>, 1> &dim_pair,
+                  const OutputKernel &output_kernel)
+  {
+    out.device(d) = in0.contract(in1, dim_pair, output_kernel);
+  }
 };
 
 // We have a single global threadpool for all convolution operations. This means
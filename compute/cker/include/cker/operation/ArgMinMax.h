@@ -18,13 +18,70 @@
 #ifndef __NNFW_CKER_ARGMINMAX_H__
 #define __NNFW_CKER_ARGMINMAX_H__
 
+#include "cker/eigen/EigenSupport.h"
 #include "cker/Shape.h"
 
+#include <algorithm>
+
 namespace nnfw
 {
 namespace cker
 {
 
+// Number of inner elements whose args are found together when the axis is not innermost
+constexpr int kArgMinMaxInnerBlock = 256;
+// Number of partial results of a row search, which lets the compiler vectorize it
+constexpr int kArgMinMaxRowLanes = 8;
+
+// Finds the first index of the value that wins cmp in a contiguous row. The winning value is
+// searched first, because a search of values only is vectorized while an index search is not.
+template <typename T, typename Cmp> int ArgMinMaxRow(const T *input, int size, const Cmp &cmp)
+{
+  T lanes[kArgMinMaxRowLanes];
+  std::fill(lanes, lanes + kArgMinMaxRowLanes, input[0]);
+  int i = 0;
+  for (; i + kArgMinMaxRowLanes <= size; i += kArgMinMaxRowLanes)
+  {
+    for (int lane = 0; lane < kArgMinMaxRowLanes; ++lane)
+      lanes[lane] = cmp(input[i + lane], lanes[lane]) ? input[i + lane] : lanes[lane];
+  }
+  for (; i < size; ++i)
+    lanes[0] = cmp(input[i], lanes[0]) ? input[i] : lanes[0];
+
+  T min_max_value = lanes[0];
+  for (int lane = 1; lane < kArgMinMaxRowLanes; ++lane)
+    min_max_value = cmp(lanes[lane], min_max_value) ? lanes[lane] : min_max_value;
+
+  // Value that never compares equal like NaN at the first element keeps index 0
+  for (i = 0; i < size; ++i)
+  {
+    if (input[i] == min_max_value)
+      return i;
+  }
+  return 0;
+}
+
+// Finds args of size inner elements along an axis of stride inner_stride at once
+template <typename T1, typename T2, typename Cmp>
+void ArgMinMaxColumns(const T1 *input, int axis_size, int inner_stride, int size, const Cmp &cmp,
+                      T2 *output)
+{
+  T1 min_max_values[kArgMinMaxInnerBlock];
+  assert(size <= kArgMinMaxInnerBlock);
+  std::copy(input, input + size, min_max_values);
+  std::fill(output, output + size, static_cast<T2>(0));
+  for (int a = 1; a < axis_size; ++a)
+  {
+    const T1 *row = input + static_cast<size_t>(a) * inner_stride;
+    for (int i = 0; i < size; ++i)
+    {
+      const bool update = cmp(row[i], min_max_values[i]);
+      min_max_values[i] = update ? row[i] : min_max_values[i];
+      output[i] = update ? static_cast<T2>(a) : output[i];
+    }
+  }
+}
+
 template <typename T1, typename T2, typename Cmp>
 void ArgMinMax(const Shape &input1_shape, const T1 *input1_data, const Shape &output_shape,
                T2 *output_data, int32_t axis, const Cmp &cmp)
@@ -52,24 +109,39 @@ void ArgMinMax(const Shape &input1_shape, const T1 *input1_data, const Shape &ou
     assert(input1_shape.Dims(i) == output_shape.Dims(i - 1));
     inner_size *= input1_shape.Dims(i);
   }
-  for (int outer = 0; outer < outer_size; ++outer)
-  {
-    for (int inner = 0; inner < inner_size; ++inner)
+
+  if (outer_size == 0 || inner_size == 0)
+    return;
+
+  // Each unit finds args of a block of inner elements in an outer slice
+  const int inner_block = std::min(inner_size, kArgMinMaxInnerBlock);
+  const int num_inner_blocks = (inner_size + inner_block - 1) / inner_block;
+  auto compute_units = [&](int first, int last) {
+    for (int unit = first; unit < last; ++unit)
     {
-      auto min_max_value = input1_data[outer * axis_size * inner_size + inner];
-      T2 min_max_index = 0;
-      for (int i = 1; i < axis_size; ++i)
+      const int outer = unit / num_inner_blocks;
+      const T1 *input = input1_data + static_cast<size_t>(outer) * axis_size * inner_size;
+      T2 *output = output_data + static_cast<size_t>(outer) * inner_size;
+      if (inner_size == 1)
+      {
+        output[0] = static_cast<T2>(ArgMinMaxRow(input, axis_size, cmp));
+      }
+      else
       {
-        const auto &curr_value = input1_data[(outer * axis_size + i) * inner_size + inner];
-        if (cmp(curr_value, min_max_value))
-        {
-          min_max_value = curr_value;
-          min_max_index = static_cast<T2>(i);
-        }
+        const int begin = (unit % num_inner_blocks) * inner_block;
+        const int end = std::min(begin + inner_block, inner_size);
+        ArgMinMaxColumns(input + begin, axis_size, inner_size, end - begin, cmp, output + begin);
       }
-      output_data[outer * inner_size + inner] = min_max_index;
     }
-  }
+  };
+
+  const int num_units = outer_size * num_inner_blocks;
+  const double unit_size = static_cast<double>(axis_size) * inner_block;
+  const Eigen::TensorOpCost cost(unit_size * sizeof(T1), inner_block * sizeof(T2), unit_size);
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  device.parallelFor(num_units, cost, [&](Eigen::Index first, Eigen::Index last) {
+    compute_units(static_cast<int>(first), static_cast<int>(last));
+  });
 }
 
 } // namespace cker
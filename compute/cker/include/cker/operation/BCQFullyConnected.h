@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BCQ_FULLY_CONNECTED_H__
+#define __NNFW_CKER_BCQ_FULLY_CONNECTED_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/operation/Helper/BCQ.h"
+
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+class BCQTempArena
+{
+public:
+  BCQTempArena(void) : input_column(), lut()
+  {
+    // DO NOTHING
+  }
+
+  void prepare(int words)
+  {
+    input_column.resize(words * 32);
+    lut.resize(words * 4 * 256);
+  }
+
+public:
+  std::vector<float> input_column;
+  // Sums of every subset of each 8 input features
+  std::vector<float> lut;
+};
+
+namespace bcq
+{
+
+// lut[g * 256 + m] = sum of input[g * 8 + i] for set bits i of m
+inline void BuildSubsetSumLUT(const float *input, int groups, float *lut)
+{
+  for (int g = 0; g < groups; ++g)
+  {
+    const float *x = input + g * 8;
+    float *table = lut + g * 256;
+    table[0] = 0.0f;
+    for (int i = 0; i < 8; ++i)
+    {
+      const int half = 1 << i;
+      for (int m = 0; m < half; ++m)
+      {
+        table[half | m] = table[m] + x[i];
+      }
+    }
+  }
+}
+
+// Sum of input values whose bits are set in the code, by one lookup per 8 features
+inline float SumOfSetBits(const int32_t *code, int words, const float *lut)
+{
+  float sum = 0.0f;
+  for (int w = 0; w < words; ++w)
+  {
+    const uint32_t bits = static_cast<uint32_t>(code[w]);
+    const float *table = lut + w * 4 * 256;
+    sum += table[bits & 0xff] + table[256 + ((bits >> 8) & 0xff)] +
+           table[512 + ((bits >> 16) & 0xff)] + table[768 + (bits >> 24)];
+  }
+  return sum;
+}
+
+} // namespace bcq
+
+/**
+ * @brief BCQ FullyConnected in w_x formation, output[rows, batch] = W * input[hidden, batch]
+ *
+ * Binary codes are not unpacked. For each input column, sums of every subset of 8 features
+ * are tabulated, then the dot product of a binary code is 2 * (sum of features whose bit is 1)
+ * - (sum of all features), where the former takes one lookup per 8 features.
+ */
+inline void BCQFullyConnected(const BCQFullyConnectedParams &params, const Shape &input_shape,
+                              const float *input_data, const Shape &scales_shape,
+                              const float *scales_data, const Shape &binary_shape,
+                              const int32_t *binary_data, const Shape &, const float *bias_data,
+                              const Shape &clusters_shape, const int32_t *clusters_data,
+                              const Shape &output_shape, float *output_data,
+                              BCQTempArena &temp_arena)
+{
+  assert(input_shape.DimensionsCount() == 2);
+  assert(output_shape.DimensionsCount() == 2);
+  UNUSED_RELEASE(scales_shape);
+
+  const int hidden_size = params.weights_hidden_size;
+  const int batches = MatchingDim(input_shape, 1, output_shape, 1);
+  const int rows = output_shape.Dims(0);
+  const int words = binary_shape.Dims(1);
+  const int num_clusters = clusters_shape.Dims(0);
+  assert(input_shape.Dims(0) == hidden_size);
+  assert(words * 32 >= hidden_size);
+  assert(bcq::NumRows(clusters_data, num_clusters) == rows);
+  UNUSED_RELEASE(rows);
+
+  temp_arena.prepare(words);
+  float *column = temp_arena.input_column.data();
+  float *lut = temp_arena.lut.data();
+  // Padded features are zero so that padded bits do not contribute
+  std::fill(column + hidden_size, column + words * 32, 0.0f);
+
+  for (int b = 0; b < batches; ++b)
+  {
+    float total = 0.0f;
+    for (int i = 0; i < hidden_size; ++i)
+    {
+      column[i] = input_data[i * batches + b];
+      total += column[i];
+    }
+    bcq::BuildSubsetSumLUT(column, words * 4, lut);
+
+    int row = 0;
+    int code_index = 0;
+    for (int c = 0; c < num_clusters; ++c)
+    {
+      const int qbits = clusters_data[c * 2];
+      const int cluster_rows = clusters_data[c * 2 + 1];
+      for (int r = 0; r < cluster_rows; ++r, ++row)
+      {
+        float acc = bias_data ? bias_data[row] : 0.0f;
+        for (int q = 0; q < qbits; ++q, ++code_index)
+        {
+          const float set_sum =
+              bcq::SumOfSetBits(binary_data + code_index * words, words, lut);
+          acc += scales_data[code_index] * (2.0f * set_sum - total);
+        }
+        output_data[row * batches + b] = ActivationFunctionWithMinMax(
+            acc, params.float_activation_min, params.float_activation_max);
+      }
+    }
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BCQ_FULLY_CONNECTED_H__
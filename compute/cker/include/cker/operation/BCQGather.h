@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BCQ_GATHER_H__
+#define __NNFW_CKER_BCQ_GATHER_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/operation/Helper/BCQ.h"
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Gather from BCQ weights of [rows, input_hidden_size] matrix
+ *
+ * Only gathered rows or columns are reconstructed, so the whole matrix is never unpacked.
+ */
+template <typename IndicesType>
+inline void BCQGather(const BCQGatherParams &params, const Shape &scales_shape,
+                      const float *scales_data, const Shape &binary_shape,
+                      const int32_t *binary_data, const Shape &indices_shape,
+                      const IndicesType *indices_data, const Shape &clusters_shape,
+                      const int32_t *clusters_data, const Shape &output_shape, float *output_data)
+{
+  UNUSED_RELEASE(scales_shape);
+  UNUSED_RELEASE(output_shape);
+
+  const int hidden_size = params.input_hidden_size;
+  const int words = binary_shape.Dims(1);
+  const int num_clusters = clusters_shape.Dims(0);
+  const int rows = bcq::NumRows(clusters_data, num_clusters);
+  const int num_indices = indices_shape.FlatSize();
+  assert(words * 32 >= hidden_size);
+
+  if (params.axis == 0)
+  {
+    assert(output_shape.FlatSize() == num_indices * hidden_size);
+    for (int i = 0; i < num_indices; ++i)
+    {
+      const int row = static_cast<int>(indices_data[i]);
+      if (row < 0 || row >= rows)
+        throw std::runtime_error("BCQGather: index is out of range");
+      int qbits = 0, code_index = 0;
+      bcq::FindRow(clusters_data, num_clusters, row, &qbits, &code_index);
+      bcq::DecodeRow(scales_data, binary_data, words, qbits, code_index, hidden_size,
+                     output_data + i * hidden_size);
+    }
+  }
+  else if (params.axis == 1)
+  {
+    assert(output_shape.FlatSize() == rows * num_indices);
+    for (int i = 0; i < num_indices; ++i)
+    {
+      if (indices_data[i] < 0 || indices_data[i] >= hidden_size)
+        throw std::runtime_error("BCQGather: index is out of range");
+    }
+
+    int code_index = 0;
+    int row = 0;
+    for (int c = 0; c < num_clusters; ++c)
+    {
+      const int qbits = clusters_data[c * 2];
+      const int cluster_rows = clusters_data[c * 2 + 1];
+      for (int r = 0; r < cluster_rows; ++r, ++row, code_index += qbits)
+      {
+        float *output_row = output_data + row * num_indices;
+        for (int i = 0; i < num_indices; ++i)
+        {
+          const int column = static_cast<int>(indices_data[i]);
+          float value = 0.0f;
+          for (int q = 0; q < qbits; ++q)
+          {
+            value += scales_data[code_index + q] *
+                     bcq::Sign(binary_data + (code_index + q) * words, column);
+          }
+          output_row[i] = value;
+        }
+      }
+    }
+  }
+  else
+  {
+    throw std::runtime_error("BCQGather: axis should be 0 or 1");
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BCQ_GATHER_H__
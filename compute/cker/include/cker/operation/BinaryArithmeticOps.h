@@ -18,13 +18,17 @@
 #ifndef __NNFW_CKER_BINARY_ARITHMETIC_OPS_H__
 #define __NNFW_CKER_BINARY_ARITHMETIC_OPS_H__
 
-#include <functional>
 #include "cker/operation/optimized/BinaryArithmeticOps.h"
+#include "cker/operation/optimized/BroadcastElementwise.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
 namespace nnfw
 {
 namespace cker
@@ -32,44 +36,70 @@ namespace cker
 
 namespace
 {
-template <BinaryArithmeticOpType op_type, typename T>
-const std::function<T(const T &, const T &)> GetBinaryArtithmeticFn()
+template <BinaryArithmeticOpType op_type, typename T> struct BinaryArithmeticFn;
+
+template <typename T> struct BinaryArithmeticFn<BinaryArithmeticOpType::ADD, T>
 {
-  switch (op_type)
+  T operator()(T a, T b) const { return a + b; }
+};
+
+template <typename T> struct BinaryArithmeticFn<BinaryArithmeticOpType::SUB, T>
+{
+  T operator()(T a, T b) const { return a - b; }
+};
+
+template <typename T> struct BinaryArithmeticFn<BinaryArithmeticOpType::MUL, T>
+{
+  T operator()(T a, T b) const { return a * b; }
+};
+
+template <typename T> struct BinaryArithmeticFn<BinaryArithmeticOpType::DIV, T>
+{
+  T operator()(T a, T b) const
   {
-    case BinaryArithmeticOpType::ADD:
-    {
-      return [](const T &a, const T &b) -> T { return a + b; };
-    }
-    case BinaryArithmeticOpType::MUL:
-    {
-      return [](const T &a, const T &b) -> T { return a * b; };
-    }
-    case BinaryArithmeticOpType::SUB:
-    {
-      return [](const T &a, const T &b) -> T { return a - b; };
-    }
-    case BinaryArithmeticOpType::DIV:
-    {
-      if (std::is_floating_point<T>::value)
-        return [](const T &a, const T &b) -> T { return a / b; };
-      else
-        return [](const T &a, const T &b) -> T {
-          if (b == 0)
-            throw std::runtime_error("Divide by zero");
-          return a / b;
-        };
-    }
-    case BinaryArithmeticOpType::POW:
-    {
-      return [](const T &a, const T &b) -> T { return std::pow(a, b); };
-    }
-    default:
-    {
-      assert(false);
-      return nullptr;
-    }
+    if (!std::is_floating_point<T>::value && b == 0)
+      throw std::runtime_error("Divide by zero");
+    return a / b;
   }
+};
+
+template <typename T> struct BinaryArithmeticFn<BinaryArithmeticOpType::POW, T>
+{
+  T operator()(T a, T b) const { return std::pow(a, b); }
+};
+
+template <typename T>
+inline void GetActivationMinMax(const BinaryArithmeticOpParam &params, T *activation_min,
+                                T *activation_max)
+{
+  *activation_min = static_cast<T>(params.quantized_activation_min);
+  *activation_max = static_cast<T>(params.quantized_activation_max);
+}
+
+template <>
+inline void GetActivationMinMax(const BinaryArithmeticOpParam &params, float *activation_min,
+                                float *activation_max)
+{
+  *activation_min = params.float_activation_min;
+  *activation_max = params.float_activation_max;
+}
+
+// Runs the op with activation through the broadcast engine, which inlines the op into loops
+template <BinaryArithmeticOpType op_type, typename T>
+inline void BinaryArithmeticOpWithActivation(const BinaryArithmeticOpParam &params,
+                                             const Shape &input1_shape, const T *input1_data,
+                                             const Shape &input2_shape, const T *input2_data,
+                                             const Shape &output_shape, T *output_data)
+{
+  T activation_min, activation_max;
+  GetActivationMinMax(params, &activation_min, &activation_max);
+  const BinaryArithmeticFn<op_type, T> fn;
+  optimized::BroadcastElementwise(input1_shape, input1_data, input2_shape, input2_data,
+                                  output_shape, output_data,
+                                  [fn, activation_min, activation_max](T a, T b) {
+                                    return ActivationFunctionWithMinMax<T>(fn(a, b), activation_min,
+                                                                           activation_max);
+                                  });
 }
 } // namespace
 
@@ -93,6 +123,16 @@ inline bool ProcessBroadcastShapes(const Shape &shape0, const Shape &shape1,
   const int dims_count = std::max(shape0.DimensionsCount(), shape1.DimensionsCount());
 
   params->broadcast_category = BroadcastableOpCategory::kGenericBroadcast;
+  // Shapes too large to extend are left to the generic broadcast, which handles any rank
+  if (dims_count > Shape::kMaxSmallSize)
+  {
+    if (shape0 == shape1)
+    {
+      params->broadcast_category = BroadcastableOpCategory::kNonBroadcast;
+      return false;
+    }
+    return true;
+  }
   Shape scalar_shape(dims_count, 1);
 
   auto extended_shape0 = Shape::ExtendedShape(dims_count, shape0);
@@ -194,15 +234,16 @@ inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shap
                                const T *input1_data, const Shape &input2_shape,
                                const T *input2_data, const Shape &output_shape, T *output_data)
 {
-  reference::BinaryArithmeticOp(params, input1_shape, input1_data, input2_shape, input2_data,
-                                output_shape, output_data, GetBinaryArtithmeticFn<op_type, T>());
+  BinaryArithmeticOpWithActivation<op_type>(params, input1_shape, input1_data, input2_shape,
+                                            input2_data, output_shape, output_data);
 }
 
-template <BinaryArithmeticOpType op_type>
-inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
-                               const uint8_t *input1_data, const Shape &input2_shape,
-                               const uint8_t *input2_data, const Shape &output_shape,
-                               uint8_t *output_data)
+// uint8 and int8 asymmetric quantized types share the kernels
+template <BinaryArithmeticOpType op_type, typename T>
+inline void QuantizedBinaryArithmeticOp(const BinaryArithmeticOpParam &params,
+                                        const Shape &input1_shape, const T *input1_data,
+                                        const Shape &input2_shape, const T *input2_data,
+                                        const Shape &output_shape, T *output_data)
 {
   switch (op_type)
   {
@@ -212,8 +253,8 @@ inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shap
                            output_shape, output_data);
       break;
     case nnfw::cker::BinaryArithmeticOpType::MUL:
-      optimized::MulQuant8(params, input1_shape, const_cast<uint8_t *>(input1_data), input2_shape,
-                           const_cast<uint8_t *>(input2_data), output_shape, output_data);
+      optimized::MulQuant8(params, input1_shape, input1_data, input2_shape, input2_data,
+                           output_shape, output_data);
       break;
     case nnfw::cker::BinaryArithmeticOpType::DIV:
       throw std::runtime_error{"Quant8 Asymm NYI"};
@@ -224,6 +265,26 @@ inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shap
   }
 }
 
+template <BinaryArithmeticOpType op_type>
+inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                               const uint8_t *input1_data, const Shape &input2_shape,
+                               const uint8_t *input2_data, const Shape &output_shape,
+                               uint8_t *output_data)
+{
+  QuantizedBinaryArithmeticOp<op_type>(params, input1_shape, input1_data, input2_shape,
+                                       input2_data, output_shape, output_data);
+}
+
+template <BinaryArithmeticOpType op_type>
+inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                               const int8_t *input1_data, const Shape &input2_shape,
+                               const int8_t *input2_data, const Shape &output_shape,
+                               int8_t *output_data)
+{
+  QuantizedBinaryArithmeticOp<op_type>(params, input1_shape, input1_data, input2_shape,
+                                       input2_data, output_shape, output_data);
+}
+
 template <BinaryArithmeticOpType op_type>
 inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                                const float *input1_data, const Shape &input2_shape,
@@ -246,9 +307,8 @@ inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shap
                      output_data);
       break;
     case nnfw::cker::BinaryArithmeticOpType::DIV:
-      reference::BinaryArithmeticOp<float>(params, input1_shape, input1_data, input2_shape,
-                                           input2_data, output_shape, output_data,
-                                           GetBinaryArtithmeticFn<op_type, float>());
+      BinaryArithmeticOpWithActivation<op_type>(params, input1_shape, input1_data, input2_shape,
+                                                input2_data, output_shape, output_data);
       break;
     default:
       assert(false);
@@ -262,16 +322,15 @@ inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const S
                                         const T *input2_data, const Shape &output_shape,
                                         T *output_data)
 {
-  reference::BroadcastBinaryArithmeticOpSlow(params, input1_shape, input1_data, input2_shape,
-                                             input2_data, output_shape, output_data,
-                                             GetBinaryArtithmeticFn<op_type, T>());
+  BinaryArithmeticOpWithActivation<op_type>(params, input1_shape, input1_data, input2_shape,
+                                            input2_data, output_shape, output_data);
 }
 
-template <BinaryArithmeticOpType op_type>
-inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
-                                        const uint8_t *input1_data, const Shape &input2_shape,
-                                        const uint8_t *input2_data, const Shape &output_shape,
-                                        uint8_t *output_data)
+template <BinaryArithmeticOpType op_type, typename T>
+inline void QuantizedBroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params,
+                                                 const Shape &input1_shape, const T *input1_data,
+                                                 const Shape &input2_shape, const T *input2_data,
+                                                 const Shape &output_shape, T *output_data)
 {
   switch (op_type)
   {
@@ -281,9 +340,8 @@ inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const S
                                             input2_data, output_shape, output_data);
       break;
     case nnfw::cker::BinaryArithmeticOpType::MUL:
-      optimized::BroadcastMulDispatchQuant8(
-          params, input1_shape, const_cast<uint8_t *>(input1_data), input2_shape,
-          const_cast<uint8_t *>(input2_data), output_shape, output_data);
+      optimized::BroadcastMulDispatchQuant8(params, input1_shape, input1_data, input2_shape,
+                                            input2_data, output_shape, output_data);
       break;
     case nnfw::cker::BinaryArithmeticOpType::DIV:
     case nnfw::cker::BinaryArithmeticOpType::POW:
@@ -294,6 +352,26 @@ inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const S
   }
 }
 
+template <BinaryArithmeticOpType op_type>
+inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                                        const uint8_t *input1_data, const Shape &input2_shape,
+                                        const uint8_t *input2_data, const Shape &output_shape,
+                                        uint8_t *output_data)
+{
+  QuantizedBroadcastBinaryArithmeticOp<op_type>(params, input1_shape, input1_data, input2_shape,
+                                                input2_data, output_shape, output_data);
+}
+
+template <BinaryArithmeticOpType op_type>
+inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                                        const int8_t *input1_data, const Shape &input2_shape,
+                                        const int8_t *input2_data, const Shape &output_shape,
+                                        int8_t *output_data)
+{
+  QuantizedBroadcastBinaryArithmeticOp<op_type>(params, input1_shape, input1_data, input2_shape,
+                                                input2_data, output_shape, output_data);
+}
+
 template <BinaryArithmeticOpType op_type>
 inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
                                         const float *input1_data, const Shape &input2_shape,
@@ -314,9 +392,8 @@ inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const S
     case nnfw::cker::BinaryArithmeticOpType::SUB:
     case nnfw::cker::BinaryArithmeticOpType::DIV:
     case nnfw::cker::BinaryArithmeticOpType::POW:
-      reference::BroadcastBinaryArithmeticOpSlow<float>(
-          params, input1_shape, input1_data, input2_shape, input2_data, output_shape, output_data,
-          GetBinaryArtithmeticFn<op_type, float>());
+      BinaryArithmeticOpWithActivation<op_type>(params, input1_shape, input1_data, input2_shape,
+                                                input2_data, output_shape, output_data);
       break;
     default:
       assert(false);
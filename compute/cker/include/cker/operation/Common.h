@@ -19,8 +19,12 @@
 #define __NNFW_CKER_COMMON_H__
 
 #include "cker/neon/neon_check.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
 #include "cker/Utils.h"
 
+#include <cstddef>
+
 namespace nnfw
 {
 namespace cker
@@ -97,6 +101,43 @@ inline void BiasAndClamp(float clamp_min, float clamp_max, int bias_size, const
 #endif
 }
 
+// Applies epilogue to count channels from channel of one output pixel
+// @note offset is the index of data[0] in the output, which addresses an operand of the output
+//       shape
+inline void ApplyFusedEpilogue(const FusedEpilogueParams &epilogue, int channel, int count,
+                               size_t offset, float *data)
+{
+  const float *operand =
+      epilogue.per_channel ? epilogue.operand_data + channel : epilogue.operand_data + offset;
+  const float clamp_min = epilogue.float_activation_min;
+  const float clamp_max = epilogue.float_activation_max;
+  switch (epilogue.type)
+  {
+    case FusedEpilogueType::kAdd:
+      for (int i = 0; i < count; ++i)
+        data[i] = ActivationFunctionWithMinMax(data[i] + operand[i], clamp_min, clamp_max);
+      break;
+    case FusedEpilogueType::kMul:
+      for (int i = 0; i < count; ++i)
+        data[i] = ActivationFunctionWithMinMax(data[i] * operand[i], clamp_min, clamp_max);
+      break;
+    case FusedEpilogueType::kNone:
+      break;
+  }
+}
+
+// Applies epilogue to the whole output, for kernels that cannot apply it per tile
+inline void ApplyFusedEpilogue(const FusedEpilogueParams &epilogue, const Shape &output_shape,
+                               float *output_data)
+{
+  if (epilogue.type == FusedEpilogueType::kNone)
+    return;
+  const int depth = output_shape.Dims(output_shape.DimensionsCount() - 1);
+  const size_t size = output_shape.FlatSize();
+  for (size_t offset = 0; offset < size; offset += depth)
+    ApplyFusedEpilogue(epilogue, 0, depth, offset, output_data + offset);
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -21,6 +21,7 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/operation/optimized/BroadcastElementwise.h"
 
 namespace nnfw
 {
@@ -92,31 +93,9 @@ BroadcastComparison4DSlowImpl(const Shape &unextended_input1_shape, const T *inp
                               const Shape &unextended_input2_shape, const T *input2_data,
                               const Shape &unextended_output_shape, bool *output_data)
 {
-  assert(unextended_input1_shape.DimensionsCount() <= 4);
-  assert(unextended_input2_shape.DimensionsCount() <= 4);
-  assert(unextended_output_shape.DimensionsCount() <= 4);
-  const Shape output_shape = Shape::ExtendedShape(4, unextended_output_shape);
-
-  NdArrayDesc<4> desc1;
-  NdArrayDesc<4> desc2;
-  NdArrayDescsForElementwiseBroadcast(unextended_input1_shape, unextended_input2_shape, &desc1,
-                                      &desc2);
-
-  for (int b = 0; b < output_shape.Dims(0); ++b)
-  {
-    for (int y = 0; y < output_shape.Dims(1); ++y)
-    {
-      for (int x = 0; x < output_shape.Dims(2); ++x)
-      {
-        for (int c = 0; c < output_shape.Dims(3); ++c)
-        {
-          output_data[Offset(output_shape, b, y, x, c)] =
-              F(input1_data[SubscriptToIndex(desc1, b, y, x, c)],
-                input2_data[SubscriptToIndex(desc2, b, y, x, c)]);
-        }
-      }
-    }
-  }
+  optimized::BroadcastElementwise(unextended_input1_shape, input1_data, unextended_input2_shape,
+                                  input2_data, unextended_output_shape, output_data,
+                                  [](T lhs, T rhs) { return F(lhs, rhs); });
 }
 
 template <typename T, ComparisonFn<T> F>
@@ -134,45 +113,25 @@ inline void BroadcastComparison4DSlowWithScaling(ComparisonParams &params,
                                                  const Shape &input2_shape, const T *input2_data,
                                                  const Shape &output_shape, bool *output_data)
 {
-  assert(input1_shape.DimensionsCount() <= 4);
-  assert(input2_shape.DimensionsCount() <= 4);
-  assert(output_shape.DimensionsCount() <= 4);
-
-  int left_shift = params.left_shift;
-  int32_t input1_offset = params.input1_offset;
-  int32_t input1_multiplier = params.input1_multiplier;
-  int input1_shift = params.input1_shift;
-  int32_t input2_offset = params.input2_offset;
-  int32_t input2_multiplier = params.input2_multiplier;
-  int input2_shift = params.input2_shift;
-
-  NdArrayDesc<4> desc1;
-  NdArrayDesc<4> desc2;
-  NdArrayDescsForElementwiseBroadcast(input1_shape, input2_shape, &desc1, &desc2);
-
-  for (int b = 0; b < output_shape.Dims(0); ++b)
-  {
-    for (int y = 0; y < output_shape.Dims(1); ++y)
-    {
-      for (int x = 0; x < output_shape.Dims(2); ++x)
-      {
-        for (int c = 0; c < output_shape.Dims(3); ++c)
-        {
-          const int32_t input1_val =
-              input1_offset + input1_data[SubscriptToIndex(desc1, b, y, x, c)];
-          const int32_t input2_val =
-              input2_offset + input2_data[SubscriptToIndex(desc2, b, y, x, c)];
-          const int32_t shifted_input1_val = input1_val * (1 << left_shift);
-          const int32_t shifted_input2_val = input2_val * (1 << left_shift);
-          const int32_t scaled_input1_val = MultiplyByQuantizedMultiplierSmallerThanOneExp(
-              shifted_input1_val, input1_multiplier, input1_shift);
-          const int32_t scaled_input2_val = MultiplyByQuantizedMultiplierSmallerThanOneExp(
-              shifted_input2_val, input2_multiplier, input2_shift);
-          output_data[Offset(output_shape, b, y, x, c)] = F(scaled_input1_val, scaled_input2_val);
-        }
-      }
-    }
-  }
+  const int left_shift = params.left_shift;
+  const int32_t input1_offset = params.input1_offset;
+  const int32_t input1_multiplier = params.input1_multiplier;
+  const int input1_shift = params.input1_shift;
+  const int32_t input2_offset = params.input2_offset;
+  const int32_t input2_multiplier = params.input2_multiplier;
+  const int input2_shift = params.input2_shift;
+
+  optimized::BroadcastElementwise(
+      input1_shape, input1_data, input2_shape, input2_data, output_shape, output_data,
+      [=](T lhs, T rhs) {
+        const int32_t shifted_input1_val = (input1_offset + lhs) * (1 << left_shift);
+        const int32_t shifted_input2_val = (input2_offset + rhs) * (1 << left_shift);
+        const int32_t scaled_input1_val = MultiplyByQuantizedMultiplierSmallerThanOneExp(
+            shifted_input1_val, input1_multiplier, input1_shift);
+        const int32_t scaled_input2_val = MultiplyByQuantizedMultiplierSmallerThanOneExp(
+            shifted_input2_val, input2_multiplier, input2_shift);
+        return F(scaled_input1_val, scaled_input2_val);
+      });
 }
 
 #define TFLITE_COMPARISON_OP(name)                                                                \
@@ -21,8 +21,10 @@
 #include "cker/Types.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
+#include "cker/operation/Common.h"
 #include "cker/operation/reference/Conv.h"
 #include "cker/operation/optimized/Conv.h"
+#include "cker/operation/optimized/WinogradConv.h"
 #include <vector>
 
 namespace nnfw
@@ -56,16 +58,23 @@ class Conv
 public:
   Conv()
       : _modified_filter_data(), _im2col_data(), _im2col_shape(4), _need_im2col(false),
+        _use_winograd(false), _winograd_zero_data(), _winograd_input_data(), _winograd_gemm_data(),
         _prepared(false)
   {
   }
 
   void prepare(const Shape &filter_shape, const float *filter_data, PaddingType padding_type,
-               bool &is_replaced_weights)
+               bool &is_replaced_weights, uint32_t stride_width = 0, uint32_t stride_height = 0,
+               uint32_t dilation_width_factor = 1, uint32_t dilation_height_factor = 1)
   {
     if (!_prepared)
     {
-      if (usableMultiThreaded(padding_type))
+      if (optimized::IsWinogradApplicable(filter_shape, stride_width, stride_height,
+                                          dilation_width_factor, dilation_height_factor))
+      {
+        transformFilterForWinograd(filter_shape, filter_data, is_replaced_weights);
+      }
+      else if (usableMultiThreaded(padding_type))
       {
         transposeFilter(filter_shape, filter_data, is_replaced_weights);
       }
@@ -87,7 +96,32 @@ public:
                   const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
                   const float *bias_data, const Shape &output_shape, float *output_data)
   {
-    if (usableMultiThreaded(params.padding_type))
+    const bool use_winograd =
+        _prepared ? _use_winograd
+                  : optimized::IsWinogradApplicable(filter_shape, params.stride_width,
+                                                    params.stride_height,
+                                                    params.dilation_width_factor,
+                                                    params.dilation_height_factor);
+    if (use_winograd)
+    {
+      bool transformed_in_execution = false;
+      if (!_prepared)
+      {
+        // This means that filter is not constant
+        transformFilterForWinograd(filter_shape, filter_data, transformed_in_execution);
+      }
+      const int input_depth = input_shape.Dims(3);
+      const int output_depth = output_shape.Dims(3);
+      const size_t block_tiles = optimized::WinogradTilesPerBlock(input_depth, output_depth);
+      _winograd_zero_data.assign(input_depth, 0.0f);
+      _winograd_input_data.resize(optimized::kWinogradPoints * block_tiles * input_depth);
+      _winograd_gemm_data.resize(optimized::kWinogradPoints * block_tiles * output_depth);
+      multithreaded::WinogradConv(params, input_shape, input_data, filter_shape,
+                                  _modified_filter_data.data(), bias_shape, bias_data, output_shape,
+                                  output_data, _winograd_zero_data.data(),
+                                  _winograd_input_data.data(), _winograd_gemm_data.data());
+    }
+    else if (usableMultiThreaded(params.padding_type))
     {
       bool transposed_in_execution = false;
       if (!_prepared)
@@ -105,6 +139,7 @@ public:
       // TODO Support optimized kernel
       reference::Conv(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
                       bias_data, output_shape, output_data);
+      ApplyFusedEpilogue(params.epilogue, output_shape, output_data);
     }
   }
 
@@ -140,6 +175,17 @@ private:
     is_replaced_weights = true;
   }
 
+  // Transformed filter replaces the transposed one because one Conv uses only one of them
+  void transformFilterForWinograd(const Shape &filter_shape, const float *filter_data,
+                                  bool &is_replaced_weights)
+  {
+    _modified_filter_data.resize(optimized::kWinogradPoints * filter_shape.Dims(0) *
+                                 filter_shape.Dims(3));
+    optimized::WinogradTransformFilter(filter_shape, filter_data, &_modified_filter_data[0]);
+    _use_winograd = true;
+    is_replaced_weights = true;
+  }
+
   void IsRequiredIm2col(const Shape &input_shape, const Shape &kernel_shape,
                         const Shape &output_shape, uint32_t stride_width, uint32_t stride_height)
   {
@@ -160,6 +206,10 @@ private:
   std::vector<uint8_t> _im2col_data;
   Shape _im2col_shape;
   bool _need_im2col;
+  bool _use_winograd;
+  std::vector<float> _winograd_zero_data;
+  std::vector<float> _winograd_input_data;
+  std::vector<float> _winograd_gemm_data;
   bool _prepared;
 };
 } // namespace cker
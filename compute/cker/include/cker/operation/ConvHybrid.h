@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_CONV_HYBRID_H__
+#define __NNFW_CKER_CONV_HYBRID_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/TensorUtils.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/ruy.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Buffers of hybrid convolutions, where activations are quantized to int8 at runtime
+ *        and multiplied with int8 weights
+ */
+class ConvHybridTempArena
+{
+public:
+  ConvHybridTempArena(void) : input_quantized(), scaling_factors(), im2col(), accum_scratch()
+  {
+    // DO NOTHING
+  }
+
+  void prepare(const Shape &input_shape, const Shape &output_shape)
+  {
+    input_quantized.resize(input_shape.FlatSize());
+    scaling_factors.resize(input_shape.Dims(0));
+    accum_scratch.resize(output_shape.FlatSize());
+  }
+
+public:
+  std::vector<int8_t> input_quantized;
+  // Input scale of each batch
+  std::vector<float> scaling_factors;
+  std::vector<int8_t> im2col;
+  std::vector<int32_t> accum_scratch;
+};
+
+namespace hybrid
+{
+
+// Quantizes each batch of input symmetrically so that each batch has its own scale
+inline void QuantizeBatches(const Shape &input_shape, const float *input_data,
+                            ConvHybridTempArena &temp_arena)
+{
+  const int batches = input_shape.Dims(0);
+  const int batch_size = input_shape.FlatSize() / batches;
+  float unused_min, unused_max;
+  for (int b = 0; b < batches; ++b)
+  {
+    SymmetricQuantizeFloats(input_data + b * batch_size, batch_size,
+                            temp_arena.input_quantized.data() + b * batch_size, &unused_min,
+                            &unused_max, &temp_arena.scaling_factors[b]);
+  }
+}
+
+// output = accum * input scale of the batch * filter scale of the channel + bias
+inline void Dequantize(const int32_t *accum_data, const float *scaling_factors,
+                       const float *per_channel_scales, const float *bias_data,
+                       float activation_min, float activation_max, int batches,
+                       int pixels_per_batch, int depth, float *output_data)
+{
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int p = 0; p < pixels_per_batch; ++p)
+    {
+      const int offset = (b * pixels_per_batch + p) * depth;
+      for (int c = 0; c < depth; ++c)
+      {
+        float value = accum_data[offset + c] * scaling_factors[b] * per_channel_scales[c];
+        if (bias_data)
+          value += bias_data[c];
+        output_data[offset + c] = ActivationFunctionWithMinMax(value, activation_min,
+                                                               activation_max);
+      }
+    }
+  }
+}
+
+} // namespace hybrid
+
+/**
+ * @brief Conv2D of float input and int8 symmetric OHWI filter with per-channel scales
+ *
+ * Input is quantized per batch, lowered by im2col and multiplied with the filter as int8 GEMM.
+ */
+inline void ConvHybridPerChannel(const ConvParams &params, const float *per_channel_scales,
+                                 const Shape &input_shape, const float *input_data,
+                                 const Shape &filter_shape, const int8_t *filter_data,
+                                 const Shape &bias_shape, const float *bias_data,
+                                 const Shape &output_shape, float *output_data,
+                                 ConvHybridTempArena &temp_arena, ruy::Context *ruy_context)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  UNUSED_RELEASE(bias_shape);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width = params.dilation_width_factor;
+  const int dilation_height = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+
+  temp_arena.prepare(input_shape, output_shape);
+  hybrid::QuantizeBatches(input_shape, input_data, temp_arena);
+
+  // Input of 1x1 convolution without stride and padding is already the im2col matrix
+  const int kernel_size = filter_height * filter_width * input_depth;
+  const int output_pixels = batches * output_height * output_width;
+  const bool need_im2col = filter_height != 1 || filter_width != 1 || stride_width != 1 ||
+                           stride_height != 1 || pad_width != 0 || pad_height != 0;
+  const int8_t *gemm_input_data = temp_arena.input_quantized.data();
+  if (need_im2col)
+  {
+    temp_arena.im2col.resize(static_cast<size_t>(output_pixels) * kernel_size);
+    int8_t *col = temp_arena.im2col.data();
+    for (int b = 0; b < batches; ++b)
+    {
+      const int8_t *input_batch =
+          temp_arena.input_quantized.data() + b * input_height * input_width * input_depth;
+      for (int out_y = 0; out_y < output_height; ++out_y)
+      {
+        for (int out_x = 0; out_x < output_width; ++out_x)
+        {
+          for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+          {
+            const int in_y = out_y * stride_height - pad_height + filter_y * dilation_height;
+            for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+            {
+              const int in_x = out_x * stride_width - pad_width + filter_x * dilation_width;
+              // Zero is the zero point of symmetric quantization
+              if (in_y < 0 || in_y >= input_height || in_x < 0 || in_x >= input_width)
+                std::memset(col, 0, input_depth);
+              else
+                std::memcpy(col, input_batch + (in_y * input_width + in_x) * input_depth,
+                            input_depth);
+              col += input_depth;
+            }
+          }
+        }
+      }
+    }
+    gemm_input_data = temp_arena.im2col.data();
+  }
+
+  // accum[pixel][out_c] = filter[out_c][:] * col[pixel][:]
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = output_depth;
+  lhs_params.cols = kernel_size;
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = kernel_size;
+  rhs_params.cols = output_pixels;
+
+  MatrixParams<int32_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_depth;
+  dst_params.cols = output_pixels;
+
+  GemmParams<int32_t, int32_t> gemm_params;
+
+  ruy::Matrix<int8_t> ruy_lhs;
+  ruy::Matrix<int8_t> ruy_rhs;
+  ruy::Matrix<int32_t> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, filter_data, &ruy_lhs);
+  ruy_support::MakeRuyMatrix(rhs_params, gemm_input_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, temp_arena.accum_scratch.data(), &ruy_dst);
+
+  ruy::BasicSpec<int32_t, int32_t> ruy_spec;
+  ruy_support::MakeRuySpec(gemm_params, &ruy_spec);
+
+  constexpr ruy::Path kRuyPath = ruy::kAllPaths;
+  ruy::Mul<kRuyPath>(ruy_lhs, ruy_rhs, ruy_spec, ruy_context, &ruy_dst);
+
+  hybrid::Dequantize(temp_arena.accum_scratch.data(), temp_arena.scaling_factors.data(),
+                     per_channel_scales, bias_data, params.float_activation_min,
+                     params.float_activation_max, batches, output_height * output_width,
+                     output_depth, output_data);
+}
+
+/**
+ * @brief DepthwiseConv2D of float input and int8 symmetric [1, H, W, C * M] filter with
+ *        per-channel scales
+ */
+inline void DepthwiseConvHybridPerChannel(const DepthwiseConvParams &params,
+                                          const float *per_channel_scales,
+                                          const Shape &input_shape, const float *input_data,
+                                          const Shape &filter_shape, const int8_t *filter_data,
+                                          const Shape &bias_shape, const float *bias_data,
+                                          const Shape &output_shape, float *output_data,
+                                          ConvHybridTempArena &temp_arena)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  UNUSED_RELEASE(bias_shape);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int depth_multiplier = params.depth_multiplier;
+  assert(output_depth == input_depth * depth_multiplier);
+
+  temp_arena.prepare(input_shape, output_shape);
+  hybrid::QuantizeBatches(input_shape, input_data, temp_arena);
+
+  int32_t *accum = temp_arena.accum_scratch.data();
+  std::fill(accum, accum + output_shape.FlatSize(), 0);
+  for (int b = 0; b < batches; ++b)
+  {
+    const int8_t *input_batch =
+        temp_arena.input_quantized.data() + b * input_height * input_width * input_depth;
+    for (int out_y = 0; out_y < output_height; ++out_y)
+    {
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        int32_t *accum_pixel =
+            accum + ((b * output_height + out_y) * output_width + out_x) * output_depth;
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+        {
+          const int in_y = out_y * params.stride_height - params.padding_values.height +
+                           filter_y * params.dilation_height_factor;
+          if (in_y < 0 || in_y >= input_height)
+            continue;
+          for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+          {
+            const int in_x = out_x * params.stride_width - params.padding_values.width +
+                             filter_x * params.dilation_width_factor;
+            if (in_x < 0 || in_x >= input_width)
+              continue;
+            const int8_t *input_pixel = input_batch + (in_y * input_width + in_x) * input_depth;
+            const int8_t *filter_tap = filter_data + (filter_y * filter_width + filter_x) *
+                                                         output_depth;
+            // Output channel ic * depth_multiplier + m takes input channel ic
+            for (int ic = 0; ic < input_depth; ++ic)
+            {
+              const int32_t input_value = input_pixel[ic];
+              for (int m = 0; m < depth_multiplier; ++m)
+              {
+                const int c = ic * depth_multiplier + m;
+                accum_pixel[c] += input_value * static_cast<int32_t>(filter_tap[c]);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  hybrid::Dequantize(accum, temp_arena.scaling_factors.data(), per_channel_scales, bias_data,
+                     params.float_activation_min, params.float_activation_max, batches,
+                     output_height * output_width, output_depth, output_data);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_CONV_HYBRID_H__
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_CONV_INT8_H__
+#define __NNFW_CKER_CONV_INT8_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/ruy.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Conv2D of int8 asymmetric input and output with int8 symmetric OHWI filter
+ *
+ * Each output channel is requantized by its own multiplier and shift, so that the filter can be
+ * quantized per channel. The input is lowered by im2col, where the padding is filled with the input
+ * zero point, and multiplied with the filter as int8 GEMM.
+ */
+inline void ConvPerChannel(const ConvParams &params, const int32_t *output_multiplier,
+                           const int *output_shift, const Shape &input_shape,
+                           const int8_t *input_data, const Shape &filter_shape,
+                           const int8_t *filter_data, const Shape &bias_shape,
+                           const int32_t *bias_data, const Shape &output_shape,
+                           int8_t *output_data, std::vector<int8_t> &im2col_data,
+                           ruy::Context *ruy_context)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  UNUSED_RELEASE(bias_shape);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width = params.dilation_width_factor;
+  const int dilation_height = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int8_t input_zero_point = static_cast<int8_t>(-params.input_offset);
+
+  // Input of 1x1 convolution without stride and padding is already the im2col matrix
+  const int kernel_size = filter_height * filter_width * input_depth;
+  const int output_pixels = batches * output_height * output_width;
+  const bool need_im2col = filter_height != 1 || filter_width != 1 || stride_width != 1 ||
+                           stride_height != 1 || pad_width != 0 || pad_height != 0;
+  const int8_t *gemm_input_data = input_data;
+  if (need_im2col)
+  {
+    im2col_data.resize(static_cast<size_t>(output_pixels) * kernel_size);
+    int8_t *col = im2col_data.data();
+    for (int b = 0; b < batches; ++b)
+    {
+      const int8_t *input_batch = input_data + b * input_height * input_width * input_depth;
+      for (int out_y = 0; out_y < output_height; ++out_y)
+      {
+        for (int out_x = 0; out_x < output_width; ++out_x)
+        {
+          for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+          {
+            const int in_y = out_y * stride_height - pad_height + filter_y * dilation_height;
+            for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+            {
+              const int in_x = out_x * stride_width - pad_width + filter_x * dilation_width;
+              if (in_y < 0 || in_y >= input_height || in_x < 0 || in_x >= input_width)
+                std::memset(col, input_zero_point, input_depth);
+              else
+                std::memcpy(col, input_batch + (in_y * input_width + in_x) * input_depth,
+                            input_depth);
+              col += input_depth;
+            }
+          }
+        }
+      }
+    }
+    gemm_input_data = im2col_data.data();
+  }
+
+  // output[pixel][out_c] = filter[out_c][:] * col[pixel][:]
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = output_depth;
+  lhs_params.cols = kernel_size;
+  lhs_params.cacheable = true;
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = kernel_size;
+  rhs_params.cols = output_pixels;
+  rhs_params.zero_point = input_zero_point;
+
+  MatrixParams<int8_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_depth;
+  dst_params.cols = output_pixels;
+  dst_params.zero_point = static_cast<int8_t>(params.output_offset);
+
+  GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+  gemm_params.bias = bias_data;
+  gemm_params.clamp_min = static_cast<int8_t>(params.quantized_activation_min);
+  gemm_params.clamp_max = static_cast<int8_t>(params.quantized_activation_max);
+  gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+  gemm_params.multiplier_exponent_perchannel = output_shift;
+
+  ruy::Matrix<int8_t> ruy_lhs;
+  ruy::Matrix<int8_t> ruy_rhs;
+  ruy::Matrix<int8_t> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, filter_data, &ruy_lhs);
+  ruy_support::MakeRuyMatrix(rhs_params, gemm_input_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, output_data, &ruy_dst);
+
+  ruy::BasicSpec<int32_t, int8_t> ruy_spec;
+  ruy_support::MakeRuySpec(gemm_params, &ruy_spec);
+
+  constexpr ruy::Path kRuyPath = ruy::kAllPaths;
+  ruy::Mul<kRuyPath>(ruy_lhs, ruy_rhs, ruy_spec, ruy_context, &ruy_dst);
+}
+
+/**
+ * @brief DepthwiseConv2D of int8 asymmetric input and output with int8 symmetric [1, H, W, C * M]
+ *        filter, where each output channel is requantized by its own multiplier and shift
+ */
+inline void DepthwiseConvPerChannel(const DepthwiseConvParams &params,
+                                    const int32_t *output_multiplier, const int *output_shift,
+                                    const Shape &input_shape, const int8_t *input_data,
+                                    const Shape &filter_shape, const int8_t *filter_data,
+                                    const Shape &bias_shape, const int32_t *bias_data,
+                                    const Shape &output_shape, int8_t *output_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  UNUSED_RELEASE(bias_shape);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int depth_multiplier = params.depth_multiplier;
+  const int32_t input_offset = params.input_offset;
+  assert(output_depth == input_depth * depth_multiplier);
+
+  // Each thread computes whole output rows with its own accumulators
+  auto compute_rows = [&](int first_row, int last_row) {
+    std::vector<int32_t> accum(output_depth);
+    for (int row = first_row; row < last_row; ++row)
+    {
+      const int b = row / output_height;
+      const int out_y = row % output_height;
+      const int8_t *input_batch = input_data + b * input_height * input_width * input_depth;
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        if (bias_data)
+          std::copy(bias_data, bias_data + output_depth, accum.begin());
+        else
+          std::fill(accum.begin(), accum.end(), 0);
+
+        // Taps in padding are skipped because they hold the input zero point
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+        {
+          const int in_y = out_y * params.stride_height - params.padding_values.height +
+                           filter_y * params.dilation_height_factor;
+          if (in_y < 0 || in_y >= input_height)
+            continue;
+          for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+          {
+            const int in_x = out_x * params.stride_width - params.padding_values.width +
+                             filter_x * params.dilation_width_factor;
+            if (in_x < 0 || in_x >= input_width)
+              continue;
+            const int8_t *input_pixel = input_batch + (in_y * input_width + in_x) * input_depth;
+            const int8_t *filter_tap =
+                filter_data + (filter_y * filter_width + filter_x) * output_depth;
+            if (depth_multiplier == 1)
+            {
+              for (int c = 0; c < output_depth; ++c)
+              {
+                accum[c] += (input_pixel[c] + input_offset) * static_cast<int32_t>(filter_tap[c]);
+              }
+            }
+            else
+            {
+              // Output channel ic * depth_multiplier + m takes input channel ic
+              for (int ic = 0; ic < input_depth; ++ic)
+              {
+                const int32_t input_value = input_pixel[ic] + input_offset;
+                for (int m = 0; m < depth_multiplier; ++m)
+                {
+                  const int c = ic * depth_multiplier + m;
+                  accum[c] += input_value * static_cast<int32_t>(filter_tap[c]);
+                }
+              }
+            }
+          }
+        }
+
+        int8_t *output_pixel =
+            output_data + ((b * output_height + out_y) * output_width + out_x) * output_depth;
+        for (int c = 0; c < output_depth; ++c)
+        {
+          int32_t acc = MultiplyByQuantizedMultiplier(accum[c], output_multiplier[c],
+                                                      output_shift[c]);
+          acc += params.output_offset;
+          acc = std::max(acc, params.quantized_activation_min);
+          acc = std::min(acc, params.quantized_activation_max);
+          output_pixel[c] = static_cast<int8_t>(acc);
+        }
+      }
+    }
+  };
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  const double row_macs =
+      static_cast<double>(output_width) * output_depth * filter_height * filter_width;
+  const Eigen::TensorOpCost row_cost(row_macs, static_cast<double>(output_width) * output_depth,
+                                     row_macs * 2);
+  device.parallelFor(batches * output_height, row_cost, [&](Eigen::Index first, Eigen::Index last) {
+    compute_rows(static_cast<int>(first), static_cast<int>(last));
+  });
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_CONV_INT8_H__
@@ -24,6 +24,7 @@
 
 #include "cker/operation/Helper/Tensor.h"
 #include "cker/operation/Helper/MatmulBCast.h"
+#include "cker/operation/optimized/Reduce.h"
 
 #include "Transpose.h"
 #include "BatchMatMul.h"
@@ -182,7 +183,7 @@ inline Shape copyShape(const Shape &shape)
 class Einsum
 {
 public:
-  Einsum() : _prepared(false)
+  Einsum() : _prepared(false), _planned(false), _plan()
   {
     // DO NOTHING
   }
@@ -199,13 +200,33 @@ public:
     _prepared = true;
   }
 
+  /**
+   * @brief Compiles the equation into a contraction plan for input_shapes
+   *
+   * The plan keeps the permutations, the reduced sizes and the GEMM dimensions of each operand,
+   * and the buffers for them, so that a run with the same input shapes only transposes and
+   * multiplies. Equations with repeated labels or broadcasting that the plan does not cover run
+   * through the generic path.
+   */
+  void prepare(std::string &equation, const std::vector<Shape> &input_shapes)
+  {
+    prepare(equation);
+    if (!isPlannedFor(input_shapes))
+    {
+      compilePlan(input_shapes);
+    }
+  }
+
   void operator()(std::string &equation, const std::vector<Shape> &input_shapes,
                   const std::vector<const float *> &input_data, const Shape &output_shape,
                   float *output_data)
   {
-    if (!_prepared)
+    prepare(equation, input_shapes);
+    if (_plan.compiled)
     {
-      prepare(equation);
+      assert(output_shape.FlatSize() == _plan.output_shape.FlatSize());
+      runPlan(input_data, output_data);
+      return;
     }
 
     const int num_inputs = input_shapes.size();
@@ -344,6 +365,361 @@ public:
     temp_operand.clear();
   }
 
+private:
+  // Operand after the transpose and the reduction, viewed as [batch_size, rows, cols]
+  struct OperandPlan
+  {
+    bool transpose = false;
+    TransposeParams transpose_params;
+    Shape transposed_shape;
+    // Reduce dimensions are summed over the last axis of size reduce_size
+    int32_t reduce_size = 1;
+    bool swap_free_and_contract = false;
+    int32_t batch_size = 1;
+    int32_t rows = 1;
+    int32_t cols = 1;
+    std::vector<float> transposed;
+    std::vector<float> reduced;
+  };
+
+  struct ContractionPlan
+  {
+    bool compiled = false;
+    std::vector<Shape> input_shapes;
+    std::vector<OperandPlan> operands;
+    int32_t batch_size = 1;
+    // Contraction result is [batch shape] + [free shape 0] + [free shape 1]
+    bool output_transpose = false;
+    TransposeParams output_params;
+    Shape result_shape;
+    Shape output_shape;
+    std::vector<float> result;
+  };
+
+  bool isPlannedFor(const std::vector<Shape> &input_shapes) const
+  {
+    return _planned && _plan.input_shapes == input_shapes;
+  }
+
+  void compilePlan(const std::vector<Shape> &input_shapes)
+  {
+    // Shape is not assignable, so the plan is reset field by field
+    _plan.compiled = false;
+    _plan.input_shapes.clear();
+    for (const auto &input_shape : input_shapes)
+      _plan.input_shapes.emplace_back(input_shape);
+    _plan.operands.clear();
+    _plan.batch_size = 1;
+    _plan.output_transpose = false;
+    _plan.result.clear();
+    _planned = true;
+
+    const int num_inputs = input_shapes.size();
+    std::vector<InputTensor<float>> inputs(num_inputs);
+    for (int i = 0; i < num_inputs; i++)
+    {
+      inputs[i].shape.ReplaceWith(input_shapes[i].DimensionsCount(), input_shapes[i].DimsData());
+      inputs[i].buffer = nullptr;
+    }
+
+    OperandLabels input_labels(_input_labels);
+    Labels output_labels(_output_labels);
+    std::vector<DimensionType> label_types(_label_types);
+    OperandLabelCounts input_label_counts(_input_label_counts);
+    LabelCounts output_label_counts(_output_label_counts);
+    LabelToDimSizes label_to_dim_sizes;
+
+    processDimensions(inputs, &input_labels, &output_labels, &label_types, &input_label_counts,
+                      &output_label_counts, &label_to_dim_sizes);
+
+    // Diagonals of repeated labels are taken by the generic path
+    auto has_repeated_label = [](const LabelCounts &counts) {
+      return std::any_of(counts.begin(), counts.end(), [](int32_t c) { return c > 1; });
+    };
+    if (has_repeated_label(output_label_counts) ||
+        std::any_of(input_label_counts.begin(), input_label_counts.end(), has_repeated_label))
+    {
+      return;
+    }
+
+    _plan.operands.resize(num_inputs);
+    std::vector<Shape> operand_shapes(num_inputs);
+    OperandLabels free_labels(num_inputs);
+    for (int i = 0; i < num_inputs; ++i)
+    {
+      if (!planOperand(input_shapes[i], label_types, input_labels[i], &free_labels[i],
+                       &operand_shapes[i], &_plan.operands[i]))
+        return;
+    }
+
+    std::vector<int32_t> result_dims;
+    if (num_inputs == 2)
+    {
+      MatMulBCast bcast(operand_shapes[0], operand_shapes[1]);
+      if (!bcast.IsValid())
+      {
+        throw std::runtime_error{"Einsum: Invalid broadcasting dimensions"};
+      }
+      // Batches are multiplied pairwise or against a single matrix only
+      const int32_t batch_size = bcast.output_batch_size();
+      if ((bcast.x_batch_size() != batch_size && bcast.x_batch_size() != 1) ||
+          (bcast.y_batch_size() != batch_size && bcast.y_batch_size() != 1))
+        return;
+      _plan.batch_size = batch_size;
+      const Shape &batch_shape = bcast.output_batch_shape();
+      result_dims.assign(batch_shape.DimsData(),
+                         batch_shape.DimsData() + batch_shape.DimensionsCount());
+    }
+    else
+    {
+      _plan.batch_size = _plan.operands[0].batch_size;
+      result_dims.assign(operand_shapes[0].DimsData(),
+                         operand_shapes[0].DimsData() + operand_shapes[0].DimensionsCount() - 2);
+    }
+
+    // Result labels are the broadcasting dimensions, the named batch dimensions and then the free
+    // dimensions of each input
+    const int num_labels = label_types.size();
+    Labels result_labels;
+    for (int label = 0; label < num_labels; ++label)
+    {
+      if (label_types[label] == kBroadcasting)
+        result_labels.push_back(label);
+    }
+    for (int label = 0; label < num_labels; ++label)
+    {
+      if (label_types[label] == kBatch)
+        result_labels.push_back(label);
+    }
+    for (int i = 0; i < num_inputs; ++i)
+    {
+      for (int label : free_labels[i])
+      {
+        result_labels.push_back(label);
+        result_dims.push_back(label_to_dim_sizes[label]);
+      }
+    }
+    if (result_labels.size() != result_dims.size() ||
+        result_labels.size() != output_labels.size())
+      return;
+    _plan.result_shape.ReplaceWith(result_dims.size(), result_dims.data());
+
+    std::vector<int32_t> label_to_position(num_labels, -1);
+    for (size_t i = 0; i < result_labels.size(); ++i)
+    {
+      label_to_position[result_labels[i]] = i;
+    }
+    std::vector<int32_t> output_permutation(output_labels.size());
+    for (size_t i = 0; i < output_labels.size(); ++i)
+    {
+      if (output_labels[i] < 0 || label_to_position[output_labels[i]] < 0)
+        return;
+      output_permutation[i] = label_to_position[output_labels[i]];
+    }
+
+    _plan.output_shape.ReplaceWith(_plan.result_shape.DimensionsCount(),
+                                   _plan.result_shape.DimsData());
+    _plan.output_transpose = shouldTranspose(_plan.result_shape, output_permutation);
+    if (_plan.output_transpose)
+    {
+      if (!setTransposeParams(_plan.result_shape, output_permutation, &_plan.output_params,
+                              &_plan.output_shape))
+        return;
+      _plan.result.resize(_plan.result_shape.FlatSize());
+    }
+    _plan.compiled = true;
+  }
+
+  // Plans the transpose into [batch, free, contract, reduce] order, the reduction and the view of
+  // an operand as [batch, rows, cols]
+  bool planOperand(const Shape &input_shape, const std::vector<DimensionType> &label_types,
+                   Labels labels, Labels *free_labels, Shape *operand_shape, OperandPlan *op)
+  {
+    std::vector<int32_t> permutation(input_shape.DimensionsCount());
+    std::iota(permutation.begin(), permutation.end(), 0);
+    op->swap_free_and_contract = shouldSwapFreeAndContract(labels, label_types);
+    if (!op->swap_free_and_contract)
+    {
+      std::sort(permutation.begin(), permutation.end(), [&](int i, int j) {
+        int label_i = labels[i];
+        int label_j = labels[j];
+        return std::tie(label_types[label_i], label_i) < std::tie(label_types[label_j], label_j);
+      });
+    }
+    op->transpose = shouldTranspose(input_shape, permutation);
+    if (op->transpose)
+    {
+      if (!setTransposeParams(input_shape, permutation, &op->transpose_params,
+                              &op->transposed_shape))
+        return false;
+      op->transposed.resize(op->transposed_shape.FlatSize());
+    }
+    permuteLabels(permutation, &labels);
+
+    std::vector<int32_t> reshape(5, 1);
+    std::vector<int32_t> operand_dims;
+    for (size_t label_idx = 0; label_idx < labels.size(); ++label_idx)
+    {
+      const int label = labels[label_idx];
+      const int32_t dim = input_shape.Dims(permutation[label_idx]);
+      if (label_types[label] == kBroadcasting || label_types[label] == kBatch)
+      {
+        operand_dims.push_back(dim);
+      }
+      else if (label_types[label] == kFree)
+      {
+        free_labels->push_back(label);
+      }
+      reshape[label_types[label]] *= dim;
+    }
+    if (op->swap_free_and_contract)
+      std::swap(reshape[kFree], reshape[kContract]);
+    operand_dims.push_back(reshape[kFree]);
+    operand_dims.push_back(reshape[kContract]);
+    operand_shape->ReplaceWith(operand_dims.size(), operand_dims.data());
+
+    op->batch_size = reshape[kBroadcasting] * reshape[kBatch];
+    op->rows = reshape[kFree];
+    op->cols = reshape[kContract];
+    op->reduce_size = reshape[kReduce];
+    if (op->reduce_size != 1)
+      op->reduced.resize(static_cast<size_t>(op->batch_size) * op->rows * op->cols);
+    return true;
+  }
+
+  bool setTransposeParams(const Shape &input_shape, const std::vector<int32_t> &permutation,
+                          TransposeParams *params, Shape *output_shape)
+  {
+    if (permutation.size() > static_cast<size_t>(optimized::kTransposeMaxDims))
+      return false;
+    params->perm_count = permutation.size();
+    output_shape->Resize(permutation.size());
+    for (size_t i = 0; i < permutation.size(); ++i)
+    {
+      params->perm[i] = permutation[i];
+      output_shape->SetDim(i, input_shape.Dims(permutation[i]));
+    }
+    return true;
+  }
+
+  void runPlan(const std::vector<const float *> &input_data, float *output_data)
+  {
+    const int num_inputs = _plan.operands.size();
+    const float *operand_data[2] = {nullptr, nullptr};
+    for (int i = 0; i < num_inputs; ++i)
+    {
+      OperandPlan &op = _plan.operands[i];
+      const float *data = input_data[i];
+      if (op.transpose && op.transposed_shape.FlatSize() > 0)
+      {
+        Transpose<float>(op.transpose_params, _plan.input_shapes[i], data, op.transposed_shape,
+                         op.transposed.data());
+        data = op.transposed.data();
+      }
+      if (op.reduce_size != 1)
+      {
+        optimized::ReduceSegments segments;
+        segments.outer_size = static_cast<int>(op.reduced.size());
+        segments.reduce_size = op.reduce_size;
+        segments.inner_size = 1;
+        optimized::ReduceSegmented(
+            segments, data, 0.f,
+            [](const float current, const float in) -> float { return current + in; },
+            op.reduced.data());
+        data = op.reduced.data();
+      }
+      operand_data[i] = data;
+    }
+
+    float *result_data = _plan.output_transpose ? _plan.result.data() : output_data;
+    if (num_inputs == 1)
+    {
+      const OperandPlan &op = _plan.operands[0];
+      const size_t size = static_cast<size_t>(op.batch_size) * op.rows * op.cols;
+      if (operand_data[0] != result_data)
+        memcpy(result_data, operand_data[0], size * sizeof(float));
+    }
+    else
+    {
+      contractPlanned(operand_data[0], operand_data[1], result_data);
+    }
+
+    if (_plan.output_transpose && _plan.output_shape.FlatSize() > 0)
+    {
+      Transpose<float>(_plan.output_params, _plan.result_shape, result_data, _plan.output_shape,
+                       output_data);
+    }
+  }
+
+  using ConstMatrixMap =
+      Eigen::TensorMap<Eigen::Tensor<const float, 2, Eigen::RowMajor, Eigen::DenseIndex>>;
+  using MatrixMap = Eigen::TensorMap<Eigen::Tensor<float, 2, Eigen::RowMajor, Eigen::DenseIndex>>;
+
+  // Multiplies [batch, free 0, free 1] = lhs * rhs over the contract dimension of each batch
+  void contractPlanned(const float *lhs_data, const float *rhs_data, float *output_data)
+  {
+    const OperandPlan &x = _plan.operands[0];
+    const OperandPlan &y = _plan.operands[1];
+    const int32_t batch_size = _plan.batch_size;
+    const int32_t free_x = x.swap_free_and_contract ? x.cols : x.rows;
+    const int32_t free_y = y.swap_free_and_contract ? y.cols : y.rows;
+    const int32_t contract_size = x.swap_free_and_contract ? x.rows : x.cols;
+    const size_t output_matrix_size = static_cast<size_t>(free_x) * free_y;
+    if (batch_size == 0 || output_matrix_size == 0)
+      return;
+    if (contract_size == 0)
+    {
+      std::fill(output_data, output_data + batch_size * output_matrix_size, 0.f);
+      return;
+    }
+
+    Eigen::array<Eigen::IndexPair<Eigen::DenseIndex>, 1> dim_pair;
+    dim_pair[0] = Eigen::IndexPair<Eigen::DenseIndex>(x.swap_free_and_contract ? 0 : 1,
+                                                      y.swap_free_and_contract ? 0 : 1);
+    const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+
+    // Batches of lhs against a single rhs matrix are multiplied as one taller lhs matrix
+    if (y.batch_size == 1 && !x.swap_free_and_contract)
+    {
+      ConstMatrixMap lhs(lhs_data, x.batch_size * x.rows, x.cols);
+      ConstMatrixMap rhs(rhs_data, y.rows, y.cols);
+      MatrixMap output(output_data, x.batch_size * free_x, free_y);
+      output.device(device) = lhs.contract(rhs, dim_pair);
+      return;
+    }
+
+    const size_t lhs_stride = x.batch_size == 1 ? 0 : static_cast<size_t>(x.rows) * x.cols;
+    const size_t rhs_stride = y.batch_size == 1 ? 0 : static_cast<size_t>(y.rows) * y.cols;
+    auto contract_batch = [&](int32_t b, bool on_thread_pool) {
+      ConstMatrixMap lhs(lhs_data + b * lhs_stride, x.rows, x.cols);
+      ConstMatrixMap rhs(rhs_data + b * rhs_stride, y.rows, y.cols);
+      MatrixMap output(output_data + b * output_matrix_size, free_x, free_y);
+      if (on_thread_pool)
+        output.device(device) = lhs.contract(rhs, dim_pair);
+      else
+        output = lhs.contract(rhs, dim_pair);
+    };
+
+    // Enough batches keep every thread busy with whole matrices, otherwise each matrix is split
+    if (batch_size >= device.numThreads())
+    {
+      const double flops = static_cast<double>(output_matrix_size) * contract_size;
+      const Eigen::TensorOpCost cost(
+          (static_cast<double>(x.rows) * x.cols + static_cast<double>(y.rows) * y.cols) *
+              sizeof(float),
+          output_matrix_size * sizeof(float), flops * 2);
+      device.parallelFor(batch_size, cost, [&](Eigen::Index first, Eigen::Index last) {
+        for (Eigen::Index b = first; b < last; ++b)
+          contract_batch(static_cast<int32_t>(b), false);
+      });
+    }
+    else
+    {
+      for (int32_t b = 0; b < batch_size; ++b)
+        contract_batch(b, true);
+    }
+  }
+
 private:
   void parseEquation(std::string &equation)
   {
@@ -916,6 +1292,8 @@ private:
 
 private:
   bool _prepared;
+  bool _planned;
+  ContractionPlan _plan;
 
   OperandLabels _input_labels;
   Labels _output_labels;
@@ -23,6 +23,9 @@
 #include "cker/Types.h"
 #include "cker/Utils.h"
 #include "cker/TensorUtils.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/ruy.h>
 
 namespace nnfw
 {
@@ -140,6 +143,66 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   }
 }
 
+// Computes int8 FullyConnected as one int8 GEMM, where weights are quantized per tensor
+inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
+                           const int8_t *input_data, const Shape &filter_shape,
+                           const int8_t *filter_data, const Shape &bias_shape,
+                           const int32_t *bias_data, const Shape &output_shape,
+                           int8_t *output_data, ruy::Context *ruy_context)
+{
+  UNUSED_RELEASE(input_shape);
+  UNUSED_RELEASE(bias_shape);
+  assert(filter_shape.DimensionsCount() >= 2);
+  assert(output_shape.DimensionsCount() >= 1);
+  assert(params.quantized_activation_min <= params.quantized_activation_max);
+
+  const int output_dim_count = output_shape.DimensionsCount();
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  const int output_depth =
+      MatchingDim(filter_shape, filter_dim_count - 2, output_shape, output_dim_count - 1);
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = output_depth;
+  lhs_params.cols = accum_depth;
+  lhs_params.zero_point = static_cast<int8_t>(-params.weights_offset);
+  lhs_params.cacheable = true;
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = accum_depth;
+  rhs_params.cols = batches;
+  rhs_params.zero_point = static_cast<int8_t>(-params.input_offset);
+
+  MatrixParams<int8_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_depth;
+  dst_params.cols = batches;
+  dst_params.zero_point = static_cast<int8_t>(params.output_offset);
+
+  GemmParams<int32_t, int8_t> gemm_params;
+  gemm_params.bias = bias_data;
+  gemm_params.clamp_min = static_cast<int8_t>(params.quantized_activation_min);
+  gemm_params.clamp_max = static_cast<int8_t>(params.quantized_activation_max);
+  gemm_params.multiplier_fixedpoint = params.output_multiplier;
+  gemm_params.multiplier_exponent = params.output_shift;
+
+  ruy::Matrix<int8_t> ruy_lhs;
+  ruy::Matrix<int8_t> ruy_rhs;
+  ruy::Matrix<int8_t> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, filter_data, &ruy_lhs);
+  ruy_support::MakeRuyMatrix(rhs_params, input_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, output_data, &ruy_dst);
+
+  ruy::BasicSpec<int32_t, int8_t> ruy_spec;
+  ruy_support::MakeRuySpec(gemm_params, &ruy_spec);
+
+  constexpr ruy::Path kRuyPath = ruy::kAllPaths;
+  ruy::Mul<kRuyPath>(ruy_lhs, ruy_rhs, ruy_spec, ruy_context, &ruy_dst);
+}
+
 inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape &input_shape,
                                  const float *input_data, const Shape &filter_shape,
                                  const int8_t *filter_data, const Shape &, const float *bias_data,
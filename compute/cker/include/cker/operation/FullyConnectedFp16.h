@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FULLY_CONNECTED_FP16_H__
+#define __NNFW_CKER_FULLY_CONNECTED_FP16_H__
+
+#include "cker/Fp16.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <Eigen/Core>
+
+#include <algorithm>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Number of float weights widened at a time, which is small enough to stay in cache
+constexpr int kFp16WeightsWidenedBlockSize = 16 * 1024;
+
+// Rows of weights widened at a time for FullyConnectedFp16Weights
+inline int FullyConnectedFp16WidenedRows(const Shape &weights_shape)
+{
+  return std::max(1, kFp16WeightsWidenedBlockSize / weights_shape.Dims(1));
+}
+
+/**
+ * @brief FullyConnected of float input with weights stored in half precision
+ *
+ * Weights are widened to float a block of rows at a time right before the block is multiplied,
+ * so computation is in float while only half of the weights memory is resident.
+ * widened_data should hold FullyConnectedFp16WidenedRows(weights_shape) * input_size floats.
+ */
+inline void FullyConnectedFp16Weights(const FullyConnectedParams &params, const Shape &input_shape,
+                                      const float *input_data, const Shape &weights_shape,
+                                      const uint16_t *weights_data, const Shape &,
+                                      const float *bias_data, const Shape &, float *output_data,
+                                      float *widened_data)
+{
+  using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  const int input_size = weights_shape.Dims(1);
+  const int num_units = weights_shape.Dims(0);
+  const int batch_size = input_shape.FlatSize() / input_size;
+  const int block_rows = FullyConnectedFp16WidenedRows(weights_shape);
+
+  const Eigen::Map<const RowMajorMatrix> input(input_data, batch_size, input_size);
+  for (int row = 0; row < num_units; row += block_rows)
+  {
+    const int rows = std::min(block_rows, num_units - row);
+    Fp16ToFloat(weights_data + row * input_size, rows * input_size, widened_data);
+
+    const Eigen::Map<const RowMajorMatrix> weights(widened_data, rows, input_size);
+    Eigen::Map<RowMajorMatrix, 0, Eigen::OuterStride<>> output(
+        output_data + row, batch_size, rows, Eigen::OuterStride<>(num_units));
+    output.noalias() = input * weights.transpose();
+  }
+
+  for (int b = 0; b < batch_size; ++b)
+  {
+    float *output_row = output_data + b * num_units;
+    for (int u = 0; u < num_units; ++u)
+    {
+      const float value = bias_data ? output_row[u] + bias_data[u] : output_row[u];
+      output_row[u] = ActivationFunctionWithMinMax(value, params.float_activation_min,
+                                                   params.float_activation_max);
+    }
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FULLY_CONNECTED_FP16_H__
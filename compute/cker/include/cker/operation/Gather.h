@@ -18,19 +18,44 @@
 #ifndef __NNFW_CKER_GATHER_H__
 #define __NNFW_CKER_GATHER_H__
 
+#include "cker/eigen/EigenSupport.h"
+#include "cker/Fp16.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 
+#include <cstring>
+
 namespace nnfw
 {
 namespace cker
 {
 
-template <typename T, typename CoordsT = int32_t>
-inline void Gather(const GatherParams &op_params, const Shape &input_shape, const T *input_data,
-                   const Shape &coords_shape, const CoordsT *coords_data, const Shape &,
-                   T *output_data)
+inline int GatherInnerSize(const GatherParams &op_params, const Shape &input_shape)
+{
+  const int axis =
+      op_params.axis < 0 ? op_params.axis + input_shape.DimensionsCount() : op_params.axis;
+  int inner_size = 1;
+  for (int i = axis + 1; i < input_shape.DimensionsCount(); ++i)
+  {
+    inner_size *= input_shape.Dims(i);
+  }
+  return inner_size;
+}
+
+// Number of rows ahead whose first cache lines are prefetched while a row is gathered
+constexpr int kGatherPrefetchDistance = 8;
+
+/**
+ * @brief Gathers rows of input along axis and writes each of them by row_fn(input_row, output_row)
+ *
+ * Rows are sharded over threads by their position in the output. Rows of a large embedding table
+ * are mostly out of cache, so the rows of upcoming indices are prefetched.
+ */
+template <typename In, typename Out, typename CoordsT, typename RowFn>
+inline void GatherRows(const GatherParams &op_params, const Shape &input_shape,
+                       const In *input_data, const Shape &coords_shape, const CoordsT *coords_data,
+                       Out *output_data, const RowFn &row_fn)
 {
   int axis = op_params.axis;
   if (axis < 0)
@@ -48,23 +73,80 @@ inline void Gather(const GatherParams &op_params, const Shape &input_shape, cons
     outer_size *= input_shape.Dims(i);
   }
 
-  int inner_size = 1;
-  for (int i = axis + 1; i < input_shape.DimensionsCount(); ++i)
-  {
-    inner_size *= input_shape.Dims(i);
-  }
+  const int inner_size = GatherInnerSize(op_params, input_shape);
 
-  for (int outer = 0; outer < outer_size; ++outer)
-  {
-    for (int i = 0; i < coords_count; ++i)
+  UNUSED_RELEASE(axis_size);
+  auto input_row = [&](int row) {
+    const int outer = row / coords_count;
+    const CoordsT coord = coords_data[row % coords_count];
+    assert(coord >= 0);
+    assert(coord < axis_size);
+    return input_data + (static_cast<size_t>(outer) * axis_size + coord) * inner_size;
+  };
+  auto gather_rows = [&](int first, int last) {
+    for (int row = first; row < last; ++row)
     {
-      assert(coords_data[i] >= 0);
-      assert(coords_data[i] < axis_size);
-      std::memcpy(output_data + (outer * coords_count + i) * inner_size,
-                  input_data + (outer * axis_size + coords_data[i]) * inner_size,
-                  sizeof(T) * inner_size);
+      if (row + kGatherPrefetchDistance < last)
+      {
+        optimized_ops_preload_l1_keep(input_row(row + kGatherPrefetchDistance));
+      }
+      row_fn(input_row(row), output_data + static_cast<size_t>(row) * inner_size);
     }
-  }
+  };
+
+  const int num_rows = outer_size * coords_count;
+  const Eigen::TensorOpCost cost(static_cast<double>(inner_size) * sizeof(In),
+                                 static_cast<double>(inner_size) * sizeof(Out), inner_size);
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  device.parallelFor(num_rows, cost, [&](Eigen::Index first, Eigen::Index last) {
+    gather_rows(static_cast<int>(first), static_cast<int>(last));
+  });
+}
+
+template <typename T, typename CoordsT = int32_t>
+inline void Gather(const GatherParams &op_params, const Shape &input_shape, const T *input_data,
+                   const Shape &coords_shape, const CoordsT *coords_data, const Shape &,
+                   T *output_data)
+{
+  const int inner_size = GatherInnerSize(op_params, input_shape);
+  GatherRows(op_params, input_shape, input_data, coords_shape, coords_data, output_data,
+             [inner_size](const T *input_row, T *output_row) {
+               std::memcpy(output_row, input_row, sizeof(T) * inner_size);
+             });
+}
+
+/**
+ * @brief Gathers rows of an asymmetric quantized table and dequantizes them to float
+ */
+template <typename T, typename CoordsT = int32_t>
+inline void GatherDequantize(const GatherParams &op_params, const Shape &input_shape,
+                             const T *input_data, float scale, int32_t zero_point,
+                             const Shape &coords_shape, const CoordsT *coords_data, const Shape &,
+                             float *output_data)
+{
+  const int inner_size = GatherInnerSize(op_params, input_shape);
+  GatherRows(op_params, input_shape, input_data, coords_shape, coords_data, output_data,
+             [inner_size, scale, zero_point](const T *input_row, float *output_row) {
+               for (int i = 0; i < inner_size; ++i)
+               {
+                 output_row[i] = scale * (static_cast<int32_t>(input_row[i]) - zero_point);
+               }
+             });
+}
+
+/**
+ * @brief Gathers rows of a half precision table and widens them to float
+ */
+template <typename CoordsT = int32_t>
+inline void GatherFp16(const GatherParams &op_params, const Shape &input_shape,
+                       const uint16_t *input_data, const Shape &coords_shape,
+                       const CoordsT *coords_data, const Shape &, float *output_data)
+{
+  const int inner_size = GatherInnerSize(op_params, input_shape);
+  GatherRows(op_params, input_shape, input_data, coords_shape, coords_data, output_data,
+             [inner_size](const uint16_t *input_row, float *output_row) {
+               Fp16ToFloat(input_row, inner_size, output_row);
+             });
 }
 
 } // namespace cker
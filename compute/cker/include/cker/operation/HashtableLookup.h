@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_HASHTABLE_LOOKUP_H__
+#define __NNFW_CKER_HASHTABLE_LOOKUP_H__
+
+#include "cker/operation/Gather.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+constexpr int32_t kHashtableEmptySlot = -1;
+
+/**
+ * @brief Looks up rows of values by keys through an open addressing hash index
+ *
+ * The index is built once from keys by prepare(), so that each lookup costs a few probes instead
+ * of a binary search over the keys. Found rows are copied by the Gather row copy, and rows of
+ * missing keys are filled with zero.
+ */
+class HashtableLookup
+{
+public:
+  HashtableLookup() : _slot_keys(), _slot_rows(), _rows(), _mask(0), _prepared(false)
+  {
+    // DO NOTHING
+  }
+
+  void prepare(const Shape &keys_shape, const int32_t *keys_data)
+  {
+    const int num_keys = keys_shape.FlatSize();
+    // Load factor is kept at most one half for short probe sequences
+    uint32_t capacity = 1;
+    while (capacity < static_cast<uint32_t>(num_keys) * 2)
+      capacity <<= 1;
+    _mask = capacity - 1;
+    _slot_keys.assign(capacity, 0);
+    _slot_rows.assign(capacity, kHashtableEmptySlot);
+
+    for (int row = 0; row < num_keys; ++row)
+    {
+      uint32_t slot = Hash(keys_data[row]) & _mask;
+      while (_slot_rows[slot] != kHashtableEmptySlot && _slot_keys[slot] != keys_data[row])
+        slot = (slot + 1) & _mask;
+      // The first row of a duplicated key is kept
+      if (_slot_rows[slot] == kHashtableEmptySlot)
+      {
+        _slot_keys[slot] = keys_data[row];
+        _slot_rows[slot] = row;
+      }
+    }
+    _prepared = true;
+  }
+
+  bool prepared() const { return _prepared; }
+
+  // Returns the row of key, or -1 if key is not in the keys
+  int32_t find(int32_t key) const
+  {
+    uint32_t slot = Hash(key) & _mask;
+    while (_slot_rows[slot] != kHashtableEmptySlot)
+    {
+      if (_slot_keys[slot] == key)
+        return _slot_rows[slot];
+      slot = (slot + 1) & _mask;
+    }
+    return kHashtableEmptySlot;
+  }
+
+  // Gathers rows of values by lookups and marks in hits whether each lookup is found
+  template <typename T>
+  void operator()(const Shape &lookups_shape, const int32_t *lookups_data,
+                  const Shape &values_shape, const T *values_data, const Shape &output_shape,
+                  T *output_data, uint8_t *hits_data)
+  {
+    assert(_prepared);
+    const int num_lookups = lookups_shape.FlatSize();
+    const int num_rows = values_shape.Dims(0);
+    const int row_size = values_shape.FlatSize() / std::max(num_rows, 1);
+    UNUSED_RELEASE(output_shape);
+    assert(output_shape.FlatSize() == num_lookups * row_size);
+
+    bool all_hit = true;
+    _rows.resize(num_lookups);
+    for (int i = 0; i < num_lookups; ++i)
+    {
+      const int32_t row = find(lookups_data[i]);
+      hits_data[i] = row == kHashtableEmptySlot ? 0 : 1;
+      all_hit &= row != kHashtableEmptySlot;
+      // Missing rows are gathered from row 0 and cleared below
+      _rows[i] = row == kHashtableEmptySlot ? 0 : row;
+    }
+
+    if (num_rows > 0)
+    {
+      GatherParams params;
+      params.axis = 0;
+      Gather(params, values_shape, values_data, Shape{num_lookups}, _rows.data(), output_shape,
+             output_data);
+    }
+    if (all_hit && num_rows > 0)
+      return;
+
+    for (int i = 0; i < num_lookups; ++i)
+    {
+      if (hits_data[i] == 0)
+        std::memset(output_data + static_cast<size_t>(i) * row_size, 0, sizeof(T) * row_size);
+    }
+  }
+
+private:
+  static uint32_t Hash(int32_t key)
+  {
+    // Fibonacci hashing mixes high bits of the product down to the masked bits
+    const uint32_t product = static_cast<uint32_t>(key) * 2654435769u;
+    return product ^ (product >> 16);
+  }
+
+  std::vector<int32_t> _slot_keys;
+  std::vector<int32_t> _slot_rows;
+  std::vector<int32_t> _rows;
+  uint32_t _mask;
+  bool _prepared;
+};
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_HASHTABLE_LOOKUP_H__
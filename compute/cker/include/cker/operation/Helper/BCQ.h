@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_HELPER_BCQ_H__
+#define __NNFW_CKER_HELPER_BCQ_H__
+
+/**
+ * BCQ(Binary-Coded Quantization) weights of [rows, hidden_size] matrix consist of
+ *
+ * - clusters : int32 [num_clusters, 2] of (qbits, number of rows). Rows are split into
+ *              consecutive clusters, and each row of a cluster has qbits binary codes.
+ * - binary   : int32 [sum of rows * qbits, ceil(hidden_size / 32)]. Binary codes of a row are
+ *              stored in [row][qbit] order. Bit j of word w is the sign of column 32 * w + j,
+ *              where 1 means +1 and 0 means -1.
+ * - scales   : float [sum of rows * qbits], alpha of each binary code in the same order.
+ *
+ * A row is reconstructed as sum of alpha * binary code over its qbits.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace bcq
+{
+
+// Finds qbits and index of the first binary code of the row
+inline void FindRow(const int32_t *clusters, int num_clusters, int row, int *qbits,
+                    int *code_index)
+{
+  int row_begin = 0;
+  int code_begin = 0;
+  for (int c = 0; c < num_clusters; ++c)
+  {
+    const int cluster_qbits = clusters[c * 2];
+    const int cluster_rows = clusters[c * 2 + 1];
+    if (row < row_begin + cluster_rows)
+    {
+      *qbits = cluster_qbits;
+      *code_index = code_begin + (row - row_begin) * cluster_qbits;
+      return;
+    }
+    row_begin += cluster_rows;
+    code_begin += cluster_rows * cluster_qbits;
+  }
+  throw std::runtime_error("BCQ: row is out of clusters");
+}
+
+inline int NumRows(const int32_t *clusters, int num_clusters)
+{
+  int rows = 0;
+  for (int c = 0; c < num_clusters; ++c)
+  {
+    rows += clusters[c * 2 + 1];
+  }
+  return rows;
+}
+
+inline float Sign(const int32_t *code, int column)
+{
+  return ((static_cast<uint32_t>(code[column / 32]) >> (column % 32)) & 1u) ? 1.0f : -1.0f;
+}
+
+// output[0:hidden_size] = sum of alpha * binary code of the row
+inline void DecodeRow(const float *scales, const int32_t *binary, int words, int qbits,
+                      int code_index, int hidden_size, float *output)
+{
+  for (int i = 0; i < hidden_size; ++i)
+  {
+    output[i] = 0.0f;
+  }
+  for (int q = 0; q < qbits; ++q)
+  {
+    const float alpha = scales[code_index + q];
+    const int32_t *code = binary + (code_index + q) * words;
+    for (int w = 0; w < words; ++w)
+    {
+      const uint32_t bits = static_cast<uint32_t>(code[w]);
+      const int column_end = std::min(32, hidden_size - w * 32);
+      float *out = output + w * 32;
+      for (int j = 0; j < column_end; ++j)
+      {
+        out[j] += ((bits >> j) & 1u) ? alpha : -alpha;
+      }
+    }
+  }
+}
+
+} // namespace bcq
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_HELPER_BCQ_H__
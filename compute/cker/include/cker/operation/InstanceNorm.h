@@ -17,17 +17,29 @@
 #ifndef __NNFW_CKER_INSTANCE_NORM_H__
 #define __NNFW_CKER_INSTANCE_NORM_H__
 
+#include "cker/eigen/EigenSupport.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace nnfw
 {
 namespace cker
 {
 
+// Pixels of a block whose channel sums are accumulated on one thread
+constexpr int32_t kInstanceNormBlockPixels = 1024;
+
+/**
+ * @brief Normalizes each channel of each batch of NHWC input over height and width
+ *
+ * Sums and squared sums of all channels are accumulated in a single sweep over pixels, in
+ * blocks that run on threads, and then each pixel is scaled and shifted across channels.
+ */
 inline void InstanceNorm(const InstanceNormParams &params, const Shape &input_shape,
                          const float *input_data, const Shape &gamma_shape, const float *gamma_data,
                          const Shape &beta_shape, const float *beta_data, const Shape &output_shape,
@@ -39,51 +51,87 @@ inline void InstanceNorm(const InstanceNormParams &params, const Shape &input_sh
   const int32_t channels = MatchingDim(input_shape, 3, output_shape, 3);
   const float output_activation_min = params.float_activation_min;
   const float output_activation_max = params.float_activation_max;
-
-  UNUSED_RELEASE(gamma_shape);
-  UNUSED_RELEASE(beta_shape);
   assert(output_activation_min <= output_activation_max);
 
-  for (int32_t batch = 0; batch < batches; batch++)
-  {
-    for (int32_t channel = 0; channel < channels; channel++)
-    {
-      double sum = 0.0f;
-      double square_sum = 0.0f;
-      int32_t size = heights * widths;
-
-      for (int32_t height = 0; height < heights; height++)
-      {
-        for (int32_t width = 0; width < widths; width++)
-        {
-          double input_val = input_data[Offset(input_shape, batch, height, width, channel)];
-          sum += input_val;
-          square_sum += (input_val * input_val);
-        }
-      }
+  // gamma and beta of one element apply to every channel
+  const bool gamma_broadcast = gamma_shape.FlatSize() == 1;
+  const bool beta_broadcast = beta_shape.FlatSize() == 1;
+  assert(gamma_broadcast || gamma_shape.FlatSize() == channels);
+  assert(beta_broadcast || beta_shape.FlatSize() == channels);
 
-      double mean = sum / size;
-      double var = square_sum / size - mean * mean;
+  const int32_t size = heights * widths;
+  if (batches * size * channels == 0)
+    return;
+  const int32_t blocks = (size + kInstanceNormBlockPixels - 1) / kInstanceNormBlockPixels;
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
 
-      double gamma = gamma_data[channel];
-      double beta = beta_data[channel];
+  using ConstChannels = Eigen::Map<const Eigen::ArrayXf>;
+  using Channels = Eigen::Map<Eigen::ArrayXf>;
 
-      double a = gamma / (std::sqrt(var + params.epsilon));
-      double b = -mean * a + beta;
+  // Sums and squared sums of each block, in double against cancellation in the variance
+  std::vector<double> sums(static_cast<size_t>(batches) * blocks * channels * 2);
+  const Eigen::TensorOpCost stats_cost(kInstanceNormBlockPixels * channels * sizeof(float), 0,
+                                       3 * kInstanceNormBlockPixels * channels);
+  device.parallelFor(batches * blocks, stats_cost, [&](Eigen::Index first, Eigen::Index last) {
+    for (Eigen::Index block = first; block < last; ++block)
+    {
+      const int32_t batch = static_cast<int32_t>(block / blocks);
+      const int32_t begin = static_cast<int32_t>(block % blocks) * kInstanceNormBlockPixels;
+      const int32_t end = std::min(begin + kInstanceNormBlockPixels, size);
+      Eigen::Map<Eigen::ArrayXd> sum(sums.data() + block * channels * 2, channels);
+      Eigen::Map<Eigen::ArrayXd> square_sum(sums.data() + block * channels * 2 + channels,
+                                            channels);
+      sum.setZero();
+      square_sum.setZero();
+      const float *input = input_data + (static_cast<size_t>(batch) * size + begin) * channels;
+      for (int32_t p = begin; p < end; ++p, input += channels)
+      {
+        const auto value = ConstChannels(input, channels).cast<double>();
+        sum += value;
+        square_sum += value.square();
+      }
+    }
+  });
 
-      for (int32_t height = 0; height < heights; height++)
+  // Each channel of a batch becomes output = input * scale + shift
+  std::vector<float> scales(static_cast<size_t>(batches) * channels);
+  std::vector<float> shifts(static_cast<size_t>(batches) * channels);
+  for (int32_t batch = 0; batch < batches; ++batch)
+  {
+    for (int32_t channel = 0; channel < channels; ++channel)
+    {
+      double sum = 0.0;
+      double square_sum = 0.0;
+      for (int32_t block = 0; block < blocks; ++block)
       {
-        for (int32_t width = 0; width < widths; width++)
-        {
-          double input_value = input_data[Offset(output_shape, batch, height, width, channel)];
-          double output_value = input_value * a + b;
-          output_data[Offset(output_shape, batch, height, width, channel)] =
-              ActivationFunctionWithMinMax((float)output_value, output_activation_min,
-                                           output_activation_max);
-        }
+        const double *block_sums = sums.data() + (batch * blocks + block) * channels * 2;
+        sum += block_sums[channel];
+        square_sum += block_sums[channels + channel];
       }
+      const double mean = sum / size;
+      const double var = std::max(square_sum / size - mean * mean, 0.0);
+      const double gamma = gamma_data[gamma_broadcast ? 0 : channel];
+      const double beta = beta_data[beta_broadcast ? 0 : channel];
+      const double a = gamma / std::sqrt(var + params.epsilon);
+      scales[batch * channels + channel] = static_cast<float>(a);
+      shifts[batch * channels + channel] = static_cast<float>(beta - mean * a);
     }
   }
+
+  const Eigen::TensorOpCost cost(channels * sizeof(float), channels * sizeof(float),
+                                 4 * channels);
+  device.parallelFor(batches * size, cost, [&](Eigen::Index first, Eigen::Index last) {
+    for (Eigen::Index p = first; p < last; ++p)
+    {
+      const int32_t batch = static_cast<int32_t>(p / size);
+      const ConstChannels scale(scales.data() + batch * channels, channels);
+      const ConstChannels shift(shifts.data() + batch * channels, channels);
+      Channels(output_data + p * channels, channels) =
+          (ConstChannels(input_data + p * channels, channels) * scale + shift)
+              .max(output_activation_min)
+              .min(output_activation_max);
+    }
+  });
 }
 
 } // namespace cker
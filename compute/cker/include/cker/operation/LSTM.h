@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_LSTM_H__
+#define __NNFW_CKER_LSTM_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/TensorUtils.h"
+
+#include <Eigen/Core>
+
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Weight matrix of LSTM, whose data is nullptr if the model does not have it
+ * @note  @c scale is used only for symmetric quantized int8 weights
+ */
+template <typename T> struct LSTMMatrix
+{
+  const T *data{nullptr};
+  float scale{1.f};
+};
+
+/**
+ * @brief Weights of LSTM cell
+ *
+ * CIFG(Coupled Input and Forget Gate) LSTM has no input gate weights and bias. LSTM without
+ * peephole has no cell_to_* weights, and LSTM without projection has no projection weights.
+ * Matrices are float or int8(hybrid), while vectors are always float.
+ */
+template <typename T> struct LSTMWeights
+{
+  LSTMMatrix<T> input_to_input;
+  LSTMMatrix<T> input_to_forget;
+  LSTMMatrix<T> input_to_cell;
+  LSTMMatrix<T> input_to_output;
+  LSTMMatrix<T> recurrent_to_input;
+  LSTMMatrix<T> recurrent_to_forget;
+  LSTMMatrix<T> recurrent_to_cell;
+  LSTMMatrix<T> recurrent_to_output;
+  LSTMMatrix<T> projection;
+  const float *cell_to_input{nullptr};
+  const float *cell_to_forget{nullptr};
+  const float *cell_to_output{nullptr};
+  const float *input_gate_bias{nullptr};
+  const float *forget_gate_bias{nullptr};
+  const float *cell_bias{nullptr};
+  const float *output_gate_bias{nullptr};
+  const float *projection_bias{nullptr};
+};
+
+// Buffers to quantize float vectors which are multiplied to int8 weights
+class LSTMHybridTempArena
+{
+public:
+  void prepare(int n_batch, int n_input, int n_cell, int n_output)
+  {
+    quantized_input.resize(n_batch * n_input);
+    quantized_output_state.resize(n_batch * n_output);
+    quantized_cell.resize(n_batch * n_cell);
+    input_scaling_factors.resize(n_batch);
+    output_state_scaling_factors.resize(n_batch);
+    cell_scaling_factors.resize(n_batch);
+    product_scaling_factors.resize(n_batch);
+    prepared = true;
+  }
+
+public:
+  bool prepared{false};
+  std::vector<int8_t> quantized_input;
+  std::vector<int8_t> quantized_output_state;
+  std::vector<int8_t> quantized_cell;
+  std::vector<float> input_scaling_factors;
+  std::vector<float> output_state_scaling_factors;
+  std::vector<float> cell_scaling_factors;
+  std::vector<float> product_scaling_factors;
+};
+
+namespace lstm
+{
+
+struct QuantizedVectors
+{
+  const int8_t *values{nullptr};
+  const float *scaling_factors{nullptr};
+  bool is_zero{false};
+};
+
+inline QuantizedVectors QuantizeVectors(const float *vectors, int n_batch, int size,
+                                        int8_t *values, float *scaling_factors)
+{
+  QuantizedVectors quantized;
+  quantized.values = values;
+  quantized.scaling_factors = scaling_factors;
+  quantized.is_zero = IsZeroVector(vectors, n_batch * size);
+  if (!quantized.is_zero)
+  {
+    float unused_min, unused_max;
+    for (int b = 0; b < n_batch; ++b)
+    {
+      SymmetricQuantizeFloats(vectors + b * size, size, values + b * size, &unused_min,
+                              &unused_max, &scaling_factors[b]);
+    }
+  }
+  return quantized;
+}
+
+// result[b][row] += matrix[row] * vectors[b]
+inline void MatMulAccumulate(const LSTMMatrix<float> &matrix, int m_rows, int m_cols,
+                             const float *vectors, const QuantizedVectors &, float *, int n_batch,
+                             float *result)
+{
+  MatrixBatchVectorMultiplyAccumulate(matrix.data, m_rows, m_cols, vectors, n_batch, result,
+                                      /*result_stride=*/1);
+}
+
+inline void MatMulAccumulate(const LSTMMatrix<int8_t> &matrix, int m_rows, int m_cols,
+                             const float *, const QuantizedVectors &quantized,
+                             float *product_scaling_factors, int n_batch, float *result)
+{
+  if (quantized.is_zero)
+    return;
+
+  for (int b = 0; b < n_batch; ++b)
+  {
+    product_scaling_factors[b] = quantized.scaling_factors[b] * matrix.scale;
+  }
+  MatrixBatchVectorMultiplyAccumulate(matrix.data, m_rows, m_cols, quantized.values,
+                                      product_scaling_factors, n_batch, result,
+                                      /*result_stride=*/1);
+}
+
+// gate[b] += peephole * cell_state[b]
+inline void PeepholeAccumulate(const float *peephole, const float *cell_state, int n_batch,
+                               int n_cell, float *gate)
+{
+  Eigen::Map<const Eigen::ArrayXf> peephole_map(peephole, n_cell);
+  for (int b = 0; b < n_batch; ++b)
+  {
+    Eigen::Map<Eigen::ArrayXf> gate_map(gate + b * n_cell, n_cell);
+    gate_map += peephole_map * Eigen::Map<const Eigen::ArrayXf>(cell_state + b * n_cell, n_cell);
+  }
+}
+
+inline void Clip(float clip, int size, float *vector)
+{
+  if (clip > 0.f)
+  {
+    Eigen::Map<Eigen::ArrayXf> map(vector, size);
+    map = map.max(-clip).min(clip);
+  }
+}
+
+} // namespace lstm
+
+/**
+ * @brief Run one time step of LSTM cell for all batches
+ *
+ * All gates of all batches are computed by one matrix-batch-vector multiplication for each
+ * weight matrix, then cell and output updates run as vectorized element-wise operations.
+ * @c scratch_buffer must hold (CIFG ? 3 : 4) * n_batch * n_cell floats.
+ */
+template <typename T>
+inline void LSTM(const LSTMParams &params, const Shape &input_shape, const float *input_data,
+                 const LSTMWeights<T> &weights, const Shape &output_state_shape,
+                 const float *output_state_in_data, const Shape &cell_state_shape,
+                 const float *cell_state_in_data, float *scratch_buffer_data,
+                 float *output_state_out_data, float *cell_state_out_data, float *output_data,
+                 LSTMHybridTempArena *temp_arena = nullptr)
+{
+  static_assert(std::is_same<T, float>::value || std::is_same<T, int8_t>::value,
+                "LSTM weights should be float or int8");
+  constexpr bool is_hybrid = std::is_same<T, int8_t>::value;
+
+  const int n_batch = input_shape.Dims(0);
+  const int n_input = input_shape.Dims(1);
+  const int n_cell = cell_state_shape.Dims(1);
+  const int n_output = output_state_shape.Dims(1);
+  const int n_batch_cell = n_batch * n_cell;
+  const bool use_cifg = weights.input_to_input.data == nullptr;
+  const bool use_peephole = weights.cell_to_forget != nullptr;
+
+  float *input_gate = use_cifg ? nullptr : scratch_buffer_data;
+  float *cell_gate = scratch_buffer_data + (use_cifg ? 0 : n_batch_cell);
+  float *forget_gate = cell_gate + n_batch_cell;
+  float *output_gate = forget_gate + n_batch_cell;
+
+  // Quantize input and output state once for all gates
+  lstm::QuantizedVectors quantized_input, quantized_output_state;
+  float *product_scaling_factors = nullptr;
+  if (is_hybrid)
+  {
+    assert(temp_arena != nullptr && temp_arena->prepared);
+    quantized_input =
+        lstm::QuantizeVectors(input_data, n_batch, n_input, temp_arena->quantized_input.data(),
+                              temp_arena->input_scaling_factors.data());
+    quantized_output_state = lstm::QuantizeVectors(
+        output_state_in_data, n_batch, n_output, temp_arena->quantized_output_state.data(),
+        temp_arena->output_state_scaling_factors.data());
+    product_scaling_factors = temp_arena->product_scaling_factors.data();
+  }
+
+  // Gates start from biases
+  if (!use_cifg)
+  {
+    VectorBatchVectorAssign(weights.input_gate_bias, n_cell, n_batch, input_gate);
+  }
+  VectorBatchVectorAssign(weights.forget_gate_bias, n_cell, n_batch, forget_gate);
+  VectorBatchVectorAssign(weights.cell_bias, n_cell, n_batch, cell_gate);
+  VectorBatchVectorAssign(weights.output_gate_bias, n_cell, n_batch, output_gate);
+
+  // Batched gate GEMMs for input and recurrent weights
+  auto gate_matmul = [&](const LSTMMatrix<T> &input_weights,
+                         const LSTMMatrix<T> &recurrent_weights, float *gate) {
+    lstm::MatMulAccumulate(input_weights, n_cell, n_input, input_data, quantized_input,
+                           product_scaling_factors, n_batch, gate);
+    lstm::MatMulAccumulate(recurrent_weights, n_cell, n_output, output_state_in_data,
+                           quantized_output_state, product_scaling_factors, n_batch, gate);
+  };
+  if (!use_cifg)
+  {
+    gate_matmul(weights.input_to_input, weights.recurrent_to_input, input_gate);
+  }
+  gate_matmul(weights.input_to_forget, weights.recurrent_to_forget, forget_gate);
+  gate_matmul(weights.input_to_cell, weights.recurrent_to_cell, cell_gate);
+  gate_matmul(weights.input_to_output, weights.recurrent_to_output, output_gate);
+
+  // Input and forget gates
+  if (!use_cifg)
+  {
+    if (use_peephole && weights.cell_to_input)
+    {
+      lstm::PeepholeAccumulate(weights.cell_to_input, cell_state_in_data, n_batch, n_cell,
+                               input_gate);
+    }
+    ApplyActivationToVector(input_gate, n_batch_cell, FusedActivationFunctionType::kSigmoid,
+                            input_gate);
+  }
+  if (use_peephole)
+  {
+    lstm::PeepholeAccumulate(weights.cell_to_forget, cell_state_in_data, n_batch, n_cell,
+                             forget_gate);
+  }
+  ApplyActivationToVector(forget_gate, n_batch_cell, FusedActivationFunctionType::kSigmoid,
+                          forget_gate);
+
+  // New cell state
+  ApplyActivationToVector(cell_gate, n_batch_cell, params.activation, cell_gate);
+  {
+    Eigen::Map<const Eigen::ArrayXf> forget_map(forget_gate, n_batch_cell);
+    Eigen::Map<const Eigen::ArrayXf> cell_gate_map(cell_gate, n_batch_cell);
+    Eigen::Map<const Eigen::ArrayXf> cell_state_in_map(cell_state_in_data, n_batch_cell);
+    Eigen::Map<Eigen::ArrayXf> cell_state_out_map(cell_state_out_data, n_batch_cell);
+    if (use_cifg)
+    {
+      cell_state_out_map = forget_map * cell_state_in_map + (1.f - forget_map) * cell_gate_map;
+    }
+    else
+    {
+      Eigen::Map<const Eigen::ArrayXf> input_map(input_gate, n_batch_cell);
+      cell_state_out_map = forget_map * cell_state_in_map + input_map * cell_gate_map;
+    }
+  }
+  lstm::Clip(params.cell_clip, n_batch_cell, cell_state_out_data);
+
+  // Output gate, which is multiplied by activated cell state in place
+  if (use_peephole)
+  {
+    lstm::PeepholeAccumulate(weights.cell_to_output, cell_state_out_data, n_batch, n_cell,
+                             output_gate);
+  }
+  ApplyActivationToVector(output_gate, n_batch_cell, FusedActivationFunctionType::kSigmoid,
+                          output_gate);
+  ApplyActivationToVector(cell_state_out_data, n_batch_cell, params.activation, cell_gate);
+  Eigen::Map<Eigen::ArrayXf>(output_gate, n_batch_cell) *=
+      Eigen::Map<const Eigen::ArrayXf>(cell_gate, n_batch_cell);
+
+  // Projection
+  if (weights.projection.data)
+  {
+    if (weights.projection_bias)
+    {
+      VectorBatchVectorAssign(weights.projection_bias, n_output, n_batch, output_data);
+    }
+    else
+    {
+      ZeroVector(output_data, n_batch * n_output);
+    }
+    lstm::QuantizedVectors quantized_cell;
+    if (is_hybrid)
+    {
+      quantized_cell =
+          lstm::QuantizeVectors(output_gate, n_batch, n_cell, temp_arena->quantized_cell.data(),
+                                temp_arena->cell_scaling_factors.data());
+    }
+    lstm::MatMulAccumulate(weights.projection, n_output, n_cell, output_gate, quantized_cell,
+                           product_scaling_factors, n_batch, output_data);
+    lstm::Clip(params.proj_clip, n_batch * n_output, output_data);
+  }
+  else
+  {
+    assert(n_output == n_cell);
+    std::memcpy(output_data, output_gate, n_batch_cell * sizeof(float));
+  }
+  std::memcpy(output_state_out_data, output_data, n_batch * n_output * sizeof(float));
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_LSTM_H__
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_LOCAL_RESPONSE_NORMALIZATION_H__
+#define __NNFW_CKER_LOCAL_RESPONSE_NORMALIZATION_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Divides each value by (bias + alpha * sum of squares in the window of range)^beta
+ *
+ * Windows run along the innermost dimension. Each window sum is the previous one with one square
+ * added and one removed, so a row costs O(depth) for any range. Scales are then raised to -beta
+ * across the row with vector instructions.
+ */
+inline void LocalResponseNormalization(const LocalResponseNormalizationParams &op_params,
+                                       const Shape &input_shape, const float *input_data,
+                                       const Shape &output_shape, float *output_data)
+{
+  const int trailing_dim = output_shape.DimensionsCount() - 1;
+  const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+  const int range = op_params.range;
+  const float bias = static_cast<float>(op_params.bias);
+  const float alpha = static_cast<float>(op_params.alpha);
+  const float beta = static_cast<float>(op_params.beta);
+  if (depth == 0)
+    return;
+
+  using ConstRow = Eigen::Map<const Eigen::ArrayXf>;
+  using Row = Eigen::Map<Eigen::ArrayXf>;
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  const Eigen::TensorOpCost cost(depth * sizeof(float), depth * sizeof(float), 30 * depth);
+  device.parallelFor(outer_size, cost, [&](Eigen::Index first, Eigen::Index last) {
+    std::vector<float> squares(depth);
+    std::vector<float> scales(depth);
+    for (Eigen::Index i = first; i < last; ++i)
+    {
+      const float *input = input_data + i * depth;
+      const ConstRow in(input, depth);
+      Row(squares.data(), depth) = in.square();
+
+      // Window of channel c is [c - range, c + range]
+      double window = 0.0;
+      for (int c = 0; c <= std::min(range, depth - 1); ++c)
+        window += squares[c];
+      for (int c = 0; c < depth; ++c)
+      {
+        scales[c] = bias + alpha * static_cast<float>(window);
+        if (c + range + 1 < depth)
+          window += squares[c + range + 1];
+        if (c - range >= 0)
+          window -= squares[c - range];
+      }
+
+      const Row scale(scales.data(), depth);
+      Row out(output_data + i * depth, depth);
+      if (beta == 0.5f)
+        out = in * scale.rsqrt();
+      else if (beta == 0.75f)
+        out = in * (scale.rsqrt() * scale.sqrt().rsqrt());
+      else
+        out = in * (scale.log() * -beta).exp();
+    }
+  });
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_LOCAL_RESPONSE_NORMALIZATION_H__
@@ -20,6 +20,7 @@
 
 #include "cker/Shape.h"
 #include "cker/Utils.h"
+#include "cker/operation/optimized/BroadcastElementwise.h"
 
 namespace nnfw
 {
@@ -31,34 +32,9 @@ inline void LogicalOrBroadcast(const Shape &unextended_input1_shape, const T *in
                                const Shape &unextended_input2_shape, const T *input2_data,
                                const Shape &unextended_output_shape, T *output_data)
 {
-  assert(unextended_input1_shape.DimensionsCount() <= 4);
-  assert(unextended_input2_shape.DimensionsCount() <= 4);
-  assert(unextended_output_shape.DimensionsCount() <= 4);
-  const Shape output_shape = Shape::ExtendedShape(4, unextended_output_shape);
-
-  NdArrayDesc<4> desc1;
-  NdArrayDesc<4> desc2;
-  NdArrayDescsForElementwiseBroadcast(unextended_input1_shape, unextended_input2_shape, &desc1,
-                                      &desc2);
-
-  for (int b = 0; b < output_shape.Dims(0); ++b)
-  {
-    for (int y = 0; y < output_shape.Dims(1); ++y)
-    {
-      for (int x = 0; x < output_shape.Dims(2); ++x)
-      {
-        for (int c = 0; c < output_shape.Dims(3); ++c)
-        {
-          auto out_idx = Offset(output_shape, b, y, x, c);
-          auto in1_idx = SubscriptToIndex(desc1, b, y, x, c);
-          auto in2_idx = SubscriptToIndex(desc2, b, y, x, c);
-          auto in1_val = input1_data[in1_idx];
-          auto in2_val = input2_data[in2_idx];
-          output_data[out_idx] = in1_val || in2_val;
-        }
-      }
-    }
-  }
+  optimized::BroadcastElementwise(unextended_input1_shape, input1_data, unextended_input2_shape,
+                                  input2_data, unextended_output_shape, output_data,
+                                  [](T a, T b) { return static_cast<T>(a || b); });
 }
 
 template <typename T>
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_LOOKUP_TABLE_H__
+#define __NNFW_CKER_LOOKUP_TABLE_H__
+
+#include "cker/neon/neon_check.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Tabulates transform(dequantize(x)) requantized for every 8-bit quantized value x
+ *
+ * The table is indexed by the bit pattern of x, so int8 value -1 maps to table[255].
+ */
+template <typename T, typename Transform>
+inline void PopulateLookupTable(float input_scale, int32_t input_zero_point, float output_scale,
+                                int32_t output_zero_point, Transform transform, T *table)
+{
+  static_assert(sizeof(T) == 1, "Lookup table is only for 8-bit types");
+  const float inverse_scale = 1 / static_cast<double>(output_scale);
+  const int32_t maxval = std::numeric_limits<T>::max();
+  const int32_t minval = std::numeric_limits<T>::min();
+  for (int32_t val = minval; val <= maxval; ++val)
+  {
+    const float dequantized = static_cast<double>(input_scale) * (val - input_zero_point);
+    const float transformed = transform(dequantized);
+    const float rescaled = std::round(transformed * inverse_scale);
+    const int32_t quantized = static_cast<int32_t>(rescaled + output_zero_point);
+    table[static_cast<uint8_t>(val)] =
+        static_cast<T>(std::max(std::min(maxval, quantized), minval));
+  }
+}
+
+// output[i] = table[input[i]]
+inline void LookupTable(const uint8_t *input_data, int size, const uint8_t *table,
+                        uint8_t *output_data)
+{
+  int i = 0;
+#if defined(USE_NEON) && defined(__aarch64__)
+  // The table is held in 16 registers, and each TBL/TBX looks up 16 values in one 64-byte quarter.
+  // Indices out of the quarter leave the lane unchanged.
+  uint8x16x4_t table_quarters[4];
+  for (int q = 0; q < 4; ++q)
+  {
+    for (int k = 0; k < 4; ++k)
+    {
+      table_quarters[q].val[k] = vld1q_u8(table + q * 64 + k * 16);
+    }
+  }
+  for (; i <= size - 16; i += 16)
+  {
+    const uint8x16_t index = vld1q_u8(input_data + i);
+    uint8x16_t result = vqtbl4q_u8(table_quarters[0], index);
+    result = vqtbx4q_u8(result, table_quarters[1], vsubq_u8(index, vdupq_n_u8(64)));
+    result = vqtbx4q_u8(result, table_quarters[2], vsubq_u8(index, vdupq_n_u8(128)));
+    result = vqtbx4q_u8(result, table_quarters[3], vsubq_u8(index, vdupq_n_u8(192)));
+    vst1q_u8(output_data + i, result);
+  }
+#endif
+  // There is no byte gather on x86, so the remaining values are looked up one by one
+  for (; i < size; ++i)
+  {
+    output_data[i] = table[input_data[i]];
+  }
+}
+
+inline void LookupTable(const int8_t *input_data, int size, const int8_t *table,
+                        int8_t *output_data)
+{
+  LookupTable(reinterpret_cast<const uint8_t *>(input_data), size,
+              reinterpret_cast<const uint8_t *>(table), reinterpret_cast<uint8_t *>(output_data));
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_LOOKUP_TABLE_H__
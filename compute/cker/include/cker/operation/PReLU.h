@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_PRELU_H__
+#define __NNFW_CKER_PRELU_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/Shape.h"
+#include "cker/Utils.h"
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Rows of at least this many elements are computed with vector instructions
+constexpr int kPReLUVectorSize = 4;
+
+// Returns true if alpha broadcasts along every dimension of output but the innermost
+inline bool IsPerChannelAlpha(const Shape &alpha_shape, const Shape &output_shape)
+{
+  const int rank = output_shape.DimensionsCount();
+  if (alpha_shape.DimensionsCount() > rank || rank == 0)
+    return false;
+  const Shape extended_alpha_shape = Shape::ExtendedShape(rank, alpha_shape);
+  for (int i = 0; i < rank - 1; ++i)
+  {
+    if (extended_alpha_shape.Dims(i) != 1)
+      return false;
+  }
+  return extended_alpha_shape.Dims(rank - 1) == output_shape.Dims(rank - 1);
+}
+
+inline void PReLURow(const float *input, const float *alpha, int size, float *output)
+{
+  if (size < kPReLUVectorSize)
+  {
+    for (int i = 0; i < size; ++i)
+      output[i] = input[i] >= 0.f ? input[i] : input[i] * alpha[i];
+    return;
+  }
+  using ConstRow = Eigen::Map<const Eigen::ArrayXf>;
+  const ConstRow in(input, size);
+  Eigen::Map<Eigen::ArrayXf>(output, size) =
+      in.max(0.f) + ConstRow(alpha, size) * in.min(0.f);
+}
+
+/**
+ * @brief Computes output = input >= 0 ? input : input * alpha
+ *
+ * Alpha of input shape and alpha per channel, which is broadcast over rows of the innermost
+ * dimension, run vectorized on threads. Other broadcasts of up to 4 dimensions are generic.
+ */
+inline void PReLU(const Shape &input_shape, const float *input_data, const Shape &alpha_shape,
+                  const float *alpha_data, const Shape &output_shape, float *output_data)
+{
+  const int flat_size = output_shape.FlatSize();
+  if (flat_size == 0)
+    return;
+
+  if (input_shape == output_shape &&
+      (alpha_shape == output_shape || IsPerChannelAlpha(alpha_shape, output_shape)))
+  {
+    const int depth = output_shape.Dims(output_shape.DimensionsCount() - 1);
+    const bool per_channel = !(alpha_shape == output_shape);
+    const int rows = depth == 0 ? 0 : flat_size / depth;
+    const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+    const Eigen::TensorOpCost cost(2 * depth * sizeof(float), depth * sizeof(float), 3 * depth);
+    device.parallelFor(rows, cost, [&](Eigen::Index first, Eigen::Index last) {
+      for (Eigen::Index row = first; row < last; ++row)
+      {
+        const float *alpha = per_channel ? alpha_data : alpha_data + row * depth;
+        PReLURow(input_data + row * depth, alpha, depth, output_data + row * depth);
+      }
+    });
+    return;
+  }
+
+  assert(output_shape.DimensionsCount() <= 4);
+  const Shape extended_output_shape = Shape::ExtendedShape(4, output_shape);
+  NdArrayDesc<4> input_desc;
+  NdArrayDesc<4> alpha_desc;
+  NdArrayDescsForElementwiseBroadcast(input_shape, alpha_shape, &input_desc, &alpha_desc);
+  for (int b = 0; b < extended_output_shape.Dims(0); ++b)
+  {
+    for (int y = 0; y < extended_output_shape.Dims(1); ++y)
+    {
+      for (int x = 0; x < extended_output_shape.Dims(2); ++x)
+      {
+        for (int c = 0; c < extended_output_shape.Dims(3); ++c)
+        {
+          const float input = input_data[SubscriptToIndex(input_desc, b, y, x, c)];
+          const float alpha = alpha_data[SubscriptToIndex(alpha_desc, b, y, x, c)];
+          *output_data++ = input >= 0.f ? input : input * alpha;
+        }
+      }
+    }
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_PRELU_H__
@@ -20,6 +20,7 @@
 
 #include "cker/Shape.h"
 #include "cker/Types.h"
+#include "cker/operation/optimized/StridedCopy.h"
 
 namespace nnfw
 {
@@ -45,15 +46,11 @@ inline void Pack(const PackParams &params, const Scalar *const *input_data,
     copy_size *= output_shape.Dims(i);
   }
 
+  optimized::StridedCopyDims dims;
+  dims.push(outer_size, copy_size, inputs_count * copy_size);
+  dims.push(copy_size, 1, 1);
   for (int i = 0; i < inputs_count; ++i)
-  {
-    for (int k = 0; k < outer_size; k++)
-    {
-      const Scalar *input_ptr = input_data[i] + copy_size * k;
-      int loc = k * inputs_count * copy_size + i * copy_size;
-      memcpy(output_data + loc, input_ptr, copy_size * sizeof(Scalar));
-    }
-  }
+    optimized::StridedCopy(dims, input_data[i], output_data + i * copy_size);
 }
 
 } // namespace cker
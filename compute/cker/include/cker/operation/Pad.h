@@ -20,8 +20,8 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
-#include <stdexcept>
-#include <iostream>
+#include "cker/operation/optimized/StridedCopy.h"
+
 namespace nnfw
 {
 namespace cker
@@ -32,191 +32,62 @@ inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &inpu
                 const T *constant_value_data)
 {
   // Note, this is pad with mode=`CONSTANT`: it doesn't support `REFLECT` and `SYMMETRIC`
-  // TODO: come up with more subtle solution that uses subtensors like arm compute
-  // TODO: Check if it works for all layouts
-
-  using PaddingInfo = std::pair<int32_t, int32_t>;
-  /** List of padding information */
-  using PaddingList = std::vector<PaddingInfo>;
+  using optimized::StridedCopyDims;
 
   const T constant_value = constant_value_data ? *constant_value_data : 0;
-  assert(output_shape.DimensionsCount() == input_shape.DimensionsCount());
+  const int rank = input_shape.DimensionsCount();
+  assert(output_shape.DimensionsCount() == rank);
+  assert(pad_rank <= rank && rank <= optimized::kStridedCopyMaxDims);
 
-  PaddingList padding_list(pad_rank);
-  for (int32_t n = 0; n < pad_rank; ++n)
-  {
-    const int32_t *from = padding_data + (n * 2);
-    padding_list[n] = {from[0], from[1]};
-  }
+  // Dimensions from pad_rank on are not padded
+  int32_t before[optimized::kStridedCopyMaxDims] = {0};
+  int32_t after[optimized::kStridedCopyMaxDims] = {0};
   for (int32_t i = 0; i < pad_rank; ++i)
   {
-    assert(output_shape.Dims(i) ==
-           input_shape.Dims(i) + padding_list[i].first + padding_list[i].second);
+    before[i] = padding_data[i * 2];
+    after[i] = padding_data[i * 2 + 1];
+    assert(output_shape.Dims(i) == input_shape.Dims(i) + before[i] + after[i]);
   }
-  /* Use pad_rank since given input/output shapes are expanded to 4d before calling all cker
-     functions:
-     1. to prevent access violation in padding_list;
-     2. handling as 4d is slower than as 2d/3d.
-  */
-  switch (pad_rank)
-  {
-    case 0:
-    case 1:
-    {
-      const int32_t in_row_len = input_shape.Dims(0);
-      std::fill_n(output_data, padding_list[0].first, constant_value);
-      std::memcpy(output_data + padding_list[0].first, input_data, in_row_len * sizeof(T));
-      std::fill_n(output_data + padding_list[0].first + in_row_len, padding_list[0].second,
-                  constant_value);
-      break;
-    }
-    case 2: // HW
-    {
-      const int32_t in_row_len = input_shape.Dims(1);
-      const int32_t out_row_size = output_shape.Dims(1);
-
-      // prepend padding rows
-      std::fill_n(output_data, padding_list[0].first * out_row_size, constant_value);
-
-      const auto r_h_inp_lim = input_shape.Dims(0) + padding_list[0].first;
-      for (auto i = padding_list[0].first, j = 0; i < r_h_inp_lim; ++i, ++j)
-      {
-        auto out_offset = i * out_row_size;
-        const auto in_offset = j * in_row_len;
-
-        // prepend padding values
-        std::fill_n(output_data + out_offset, padding_list[1].first, constant_value);
-
-        out_offset += padding_list[1].first;
-
-        // copy a row of input data
-        memcpy(output_data + out_offset, input_data + in_offset, in_row_len * sizeof(T));
-
-        out_offset += in_row_len;
-
-        // append padding values
-        std::fill_n(output_data + out_offset, padding_list[1].second, constant_value);
-      }
-
-      // append padding rows
-      std::fill_n(output_data + r_h_inp_lim * out_row_size, padding_list[0].second * out_row_size,
-                  constant_value);
-      break;
-    }
-    case 3: // HWC
-    {
-      const int32_t in_row_len = input_shape.Dims(2);
-      const int32_t out_row_size = output_shape.Dims(2);
-      const auto plain_size = out_row_size * output_shape.Dims(1);
-
-      // prepend padding plains
-      std::fill_n(output_data, padding_list[0].first * plain_size, constant_value);
-
-      const auto r_h_inp_lim = input_shape.Dims(0) + padding_list[0].first;
-      for (auto i = padding_list[0].first, i_inp = 0; i < r_h_inp_lim; ++i, ++i_inp)
-      {
-        const auto out_w_offset = (i * output_shape.Dims(1) + 0) * output_shape.Dims(2);
-
-        // prepend padding rows
-        std::fill_n(output_data + out_w_offset, padding_list[1].first * out_row_size,
-                    constant_value);
 
-        const auto r_w_inp_lim = input_shape.Dims(1) + padding_list[1].first;
-        for (auto j = padding_list[1].first, j_inp = 0; j < r_w_inp_lim; ++j, ++j_inp)
-        {
-          auto out_offset = (i * output_shape.Dims(1) + j) * output_shape.Dims(2);
-          const auto in_offset = (i_inp * input_shape.Dims(1) + j_inp) * input_shape.Dims(2);
+  int64_t input_strides[optimized::kStridedCopyMaxDims];
+  int64_t output_strides[optimized::kStridedCopyMaxDims];
+  optimized::ContiguousStrides(input_shape, input_strides);
+  optimized::ContiguousStrides(output_shape, output_strides);
 
-          // prepend padding values
-          std::fill_n(output_data + out_offset, padding_list[2].first, constant_value);
-
-          out_offset += padding_list[2].first;
-
-          // copy a row of input data
-          memcpy(output_data + out_offset, input_data + in_offset, in_row_len * sizeof(T));
-
-          out_offset += in_row_len;
-
-          // append padding values
-          std::fill_n(output_data + out_offset, padding_list[2].second, constant_value);
-        }
-
-        // append padding rows
-        std::fill_n(output_data + out_w_offset + r_w_inp_lim * out_row_size,
-                    padding_list[1].second * out_row_size, constant_value);
-      }
+  // Input goes into the interior of output
+  StridedCopyDims interior;
+  int64_t interior_offset = 0;
+  for (int i = 0; i < rank; ++i)
+  {
+    interior.push(input_shape.Dims(i), input_strides[i], output_strides[i]);
+    interior_offset += before[i] * output_strides[i];
+  }
+  optimized::StridedCopy(interior, input_data, output_data + interior_offset);
 
-      // append padding plains
-      std::fill_n(output_data + r_h_inp_lim * plain_size, padding_list[0].second * plain_size,
-                  constant_value);
-      break;
-    }
-    case 4:
+  // Padding along a dimension at each interior position of the outer dimensions is two
+  // contiguous blocks, so every output element outside the interior is written once
+  for (int i = 0; i < rank; ++i)
+  {
+    if (before[i] == 0 && after[i] == 0)
+      continue;
+    StridedCopyDims outer;
+    int64_t base = 0;
+    for (int k = 0; k < i; ++k)
     {
-      auto get_offset = [](const Shape &shape, int32_t n, int32_t h, int32_t w) -> int32_t {
-        return ((n * shape.Dims(1) + h) * shape.Dims(2) + w) * shape.Dims(3);
-      };
-      const int32_t in_row_len = input_shape.Dims(3);
-      const int32_t out_row_size = output_shape.Dims(3);
-      const auto plain_size = out_row_size * output_shape.Dims(2);
-      const auto parallelepiped_size = plain_size * output_shape.Dims(1);
-
-      // prepend padding parallelepipeds
-      std::fill_n(output_data, padding_list[0].first * parallelepiped_size, constant_value);
-
-      const auto r_b_inp_lim = input_shape.Dims(0) + padding_list[0].first;
-      for (auto i = padding_list[0].first, i_inp = 0; i < r_b_inp_lim; ++i, ++i_inp)
-      {
-        const auto out_h_offset = get_offset(output_shape, i, 0, 0);
-        // prepend padding plains
-        std::fill_n(output_data + out_h_offset, padding_list[1].first * plain_size, constant_value);
-
-        const auto r_h_inp_lim = input_shape.Dims(1) + padding_list[1].first;
-        for (auto j = padding_list[1].first, j_inp = 0; j < r_h_inp_lim; ++j, ++j_inp)
-        {
-          const auto out_w_offset = get_offset(output_shape, i, j, 0);
-
-          // prepend padding rows
-          std::fill_n(output_data + out_w_offset, padding_list[2].first * out_row_size,
-                      constant_value);
-
-          const auto r_w_inp_lim = input_shape.Dims(2) + padding_list[2].first;
-          for (auto k = padding_list[2].first, k_inp = 0; k < r_w_inp_lim; ++k, ++k_inp)
-          {
-            auto out_c_offset = get_offset(output_shape, i, j, k);
-            const auto in_offset = get_offset(input_shape, i_inp, j_inp, k_inp);
-
-            // prepend padding values
-            std::fill_n(output_data + out_c_offset, padding_list[3].first, constant_value);
-
-            out_c_offset += padding_list[3].first;
-
-            // copy a row of input data
-            memcpy(output_data + out_c_offset, input_data + in_offset, in_row_len * sizeof(T));
-
-            out_c_offset += in_row_len;
-
-            // append padding values
-            std::fill_n(output_data + out_c_offset, padding_list[3].second, constant_value);
-          }
-
-          // append padding rows
-          std::fill_n(output_data + out_w_offset + r_w_inp_lim * out_row_size,
-                      padding_list[2].second * out_row_size, constant_value);
-        }
-
-        // append padding plains
-        std::fill_n(output_data + out_h_offset + r_h_inp_lim * plain_size,
-                    padding_list[1].second * plain_size, constant_value);
-      }
-      // append padding parallelepipeds
-      std::fill_n(output_data + r_b_inp_lim * parallelepiped_size,
-                  padding_list[0].second * parallelepiped_size, constant_value);
-      break;
+      outer.push(input_shape.Dims(k), 0, output_strides[k]);
+      base += before[k] * output_strides[k];
     }
-    default:
-      throw std::runtime_error("Padding for rank > 4 NYI");
-      break;
+    outer.push(1, 0, 0);
+
+    const int64_t before_size = before[i] * output_strides[i];
+    const int64_t after_size = after[i] * output_strides[i];
+    const int64_t after_offset = (before[i] + input_shape.Dims(i)) * output_strides[i];
+    const int64_t run_bytes = (before_size + after_size) * sizeof(T);
+    optimized::ForEachStridedRun(outer, run_bytes, [&](int64_t, int64_t output_offset) {
+      T *block = output_data + base + output_offset;
+      optimized::FillRun(block, before_size, constant_value);
+      optimized::FillRun(block + after_offset, after_size, constant_value);
+    });
   }
 }
 } // namespace cker
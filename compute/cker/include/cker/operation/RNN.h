@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_RNN_H__
+#define __NNFW_CKER_RNN_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/TensorUtils.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Run one time step of basic RNN cell for all batches
+ *
+ * output = activation(input * weights^T + hidden_state_in * recurrent_weights^T + bias)
+ * and hidden_state_out has the same values as output.
+ */
+inline void RNN(const RNNParams &params, const Shape &input_shape, const float *input_data,
+                const Shape &weights_shape, const float *weights_data,
+                const Shape &recurrent_weights_shape, const float *recurrent_weights_data,
+                const Shape &bias_shape, const float *bias_data,
+                const Shape &hidden_state_in_shape, const float *hidden_state_in_data,
+                float *output_data, float *hidden_state_out_data)
+{
+  const int n_batch = input_shape.Dims(0);
+  const int n_input = input_shape.Dims(1);
+  const int n_units = weights_shape.Dims(0);
+  assert(weights_shape.Dims(1) == n_input);
+  assert(recurrent_weights_shape.Dims(0) == n_units);
+  assert(recurrent_weights_shape.Dims(1) == n_units);
+  assert(bias_shape.FlatSize() == n_units);
+  assert(hidden_state_in_shape.FlatSize() == n_batch * n_units);
+  UNUSED_RELEASE(recurrent_weights_shape);
+  UNUSED_RELEASE(bias_shape);
+  UNUSED_RELEASE(hidden_state_in_shape);
+
+  VectorBatchVectorAssign(bias_data, n_units, n_batch, output_data);
+  MatrixBatchVectorMultiplyAccumulate(weights_data, n_units, n_input, input_data, n_batch,
+                                      output_data, /*result_stride=*/1);
+  MatrixBatchVectorMultiplyAccumulate(recurrent_weights_data, n_units, n_units,
+                                      hidden_state_in_data, n_batch, output_data,
+                                      /*result_stride=*/1);
+  ApplyActivationToVector(output_data, n_batch * n_units, params.activation, output_data);
+
+  std::memcpy(hidden_state_out_data, output_data, n_batch * n_units * sizeof(float));
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RNN_H__
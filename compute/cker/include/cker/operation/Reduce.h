@@ -21,6 +21,7 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/operation/optimized/Reduce.h"
 
 namespace nnfw
 {
@@ -30,10 +31,10 @@ namespace cker
 // A generic reduce method that can be used for reduce_sum, reduce_mean, etc.
 // This method iterates through input data and reduce elements along the
 // dimensions given in axis.
-template <typename In, typename Out>
+template <typename In, typename Out, typename Reducer>
 inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Shape &,
                        const int *axis, const int num_axis, int *input_iter,
-                       Out reducer(const Out current, const In in), Out *output_data)
+                       const Reducer &reducer, Out *output_data)
 {
   const auto input_dims = input_shape.DimsData();
   const auto input_num_dims = input_shape.DimensionsCount();
@@ -137,10 +138,11 @@ public:
 
   // Computes the generic value (i.e., sum/max/min/prod) of elements across
   // dimensions given in axis. It needs to pass in init_value and reducer.
-  template <typename T>
+  // Axes that collapse into one contiguous range are reduced by the optimized kernel.
+  template <typename T, typename Reducer>
   inline bool ReduceGeneric(const Shape &input_shape, const T *input_data,
                             const Shape &output_shape, T *output_data, const std::vector<int> &axes,
-                            bool, T init_value, T reducer(const T current, const T in))
+                            bool, T init_value, const Reducer &reducer)
   {
     // Reset output data.
     if (!InitTensorDataForReduce(output_shape, init_value, output_data))
@@ -155,6 +157,13 @@ public:
       return false;
     }
 
+    optimized::ReduceSegments segments;
+    if (optimized::ReduceContiguous(input_shape, input_data, resolved_axis_data(),
+                                    num_resolved_axis, init_value, reducer, output_data, &segments))
+    {
+      return true;
+    }
+
     return ReduceImpl<T, T>(input_data, input_shape, output_shape, resolved_axis_data(),
                             num_resolved_axis, temp_index_data(), reducer, output_data);
   }
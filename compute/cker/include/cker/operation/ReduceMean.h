@@ -159,6 +159,23 @@ public:
     {
       return false;
     }
+
+    // Sums contiguous axes first and divides the sums once
+    optimized::ReduceSegments segments;
+    if (optimized::ReduceContiguous(
+            input_shape, input_data, resolved_axis_data(), num_resolved_axis, init_value,
+            [](Out current, In in) { return current + static_cast<Out>(in); }, output_data,
+            &segments))
+    {
+      const int num_outputs = segments.outer_size * segments.inner_size;
+      const Out normalizer = static_cast<Out>(segments.reduce_size);
+      for (int idx = 0; idx < num_outputs; idx++)
+      {
+        output_data[idx] /= normalizer;
+      }
+      return true;
+    }
+
     return ReduceMeanImpl<In, Out>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
                                    temp_index_data(), reducer, output_data);
   }
@@ -184,9 +201,21 @@ public:
       return false;
     }
 
-    size_t normalizer =
-        ReduceSumQuantImpl<In>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
-                               temp_index_data(), reducer, _temp_sum.data());
+    size_t normalizer;
+    optimized::ReduceSegments segments;
+    if (optimized::ReduceContiguous(
+            input_shape, input_data, resolved_axis_data(), num_resolved_axis, 0,
+            [](int current, In in) { return current + static_cast<int>(in); }, _temp_sum.data(),
+            &segments))
+    {
+      normalizer = segments.reduce_size;
+    }
+    else
+    {
+      normalizer =
+          ReduceSumQuantImpl<In>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
+                                 temp_index_data(), reducer, _temp_sum.data());
+    }
     if (num_outputs > 0)
     {
       float scale = input_scale / output_scale;
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_RESIZENEARESTNEIGHBOR_H__
+#define __NNFW_CKER_RESIZENEARESTNEIGHBOR_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/operation/optimized/Resize.h"
+
+namespace nnfw
+{
+namespace cker
+{
+
+class ResizeNearestNeighbor
+{
+public:
+  ResizeNearestNeighbor() : _y_table(), _x_table()
+  {
+    // DO NOTHING
+  }
+
+  // Builds source tables, which are kept while the input shape and params are the same
+  void prepare(const ResizeNearestNeighborParams &params, const Shape &input_shape)
+  {
+    assert(input_shape.DimensionsCount() == 4);
+    const int32_t input_height = input_shape.Dims(1);
+    const int32_t input_width = input_shape.Dims(2);
+    if (!_y_table.matches(input_height, params.output_height, params.align_corners,
+                          params.half_pixel_centers))
+    {
+      optimized::BuildNearestAxisTable(input_height, params.output_height, params.align_corners,
+                                       params.half_pixel_centers, &_y_table);
+    }
+    if (!_x_table.matches(input_width, params.output_width, params.align_corners,
+                          params.half_pixel_centers))
+    {
+      optimized::BuildNearestAxisTable(input_width, params.output_width, params.align_corners,
+                                       params.half_pixel_centers, &_x_table);
+    }
+  }
+
+  template <typename T>
+  void operator()(const ResizeNearestNeighborParams &params, const Shape &input_shape,
+                  const T *input_data, const Shape &output_shape, T *output_data)
+  {
+    prepare(params, input_shape);
+    optimized::ResizeNearestNeighbor<T>(_y_table, _x_table, input_shape, input_data, output_shape,
+                                        output_data);
+  }
+
+private:
+  optimized::ResizeAxisTable _y_table;
+  optimized::ResizeAxisTable _x_table;
+};
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RESIZENEARESTNEIGHBOR_H__
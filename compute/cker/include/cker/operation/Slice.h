@@ -21,15 +21,16 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/operation/optimized/StridedCopy.h"
 
 namespace nnfw
 {
 namespace cker
 {
 
-template <typename T>
-inline void Slice(const SliceParams &op_params, const Shape &input_shape,
-                  SequentialTensorWriter<T> *writer)
+// Computes [start, stop) of 4 dimensions, where op_params are front-padded to 4
+inline void SliceBounds(const SliceParams &op_params, const Shape &input_shape, int *start,
+                        int *stop)
 {
   // TODO(dkalenichenko): This op only supports 4D tensors or smaller.
   assert(op_params.begin_count <= 4);
@@ -38,31 +39,40 @@ inline void Slice(const SliceParams &op_params, const Shape &input_shape,
   const int begin_count = op_params.begin_count;
   const int size_count = op_params.size_count;
   // We front-pad the begin and size vectors.
-  const int start_b = 4 - begin_count > 0 ? 0 : op_params.begin[0];
-  const int stop_b = (4 - size_count > 0 || op_params.size[0] == -1) ? input_shape.Dims(0)
-                                                                     : start_b + op_params.size[0];
-  const int start_h = begin_count < 3 ? 0 : op_params.begin[begin_count - 3];
-  const int stop_h = (size_count < 3 || op_params.size[size_count - 3] == -1)
-                         ? input_shape.Dims(1)
-                         : start_h + op_params.size[size_count - 3];
-  const int start_w = begin_count < 2 ? 0 : op_params.begin[begin_count - 2];
-  const int stop_w = (size_count < 2 || op_params.size[size_count - 2] == -1)
-                         ? input_shape.Dims(2)
-                         : start_w + op_params.size[size_count - 2];
-  const int start_d = begin_count < 1 ? 0 : op_params.begin[begin_count - 1];
-  const int stop_d = (size_count < 1 || op_params.size[size_count - 1] == -1)
-                         ? input_shape.Dims(3)
-                         : start_d + op_params.size[size_count - 1];
+  start[0] = 4 - begin_count > 0 ? 0 : op_params.begin[0];
+  stop[0] = (4 - size_count > 0 || op_params.size[0] == -1) ? input_shape.Dims(0)
+                                                            : start[0] + op_params.size[0];
+  start[1] = begin_count < 3 ? 0 : op_params.begin[begin_count - 3];
+  stop[1] = (size_count < 3 || op_params.size[size_count - 3] == -1)
+                ? input_shape.Dims(1)
+                : start[1] + op_params.size[size_count - 3];
+  start[2] = begin_count < 2 ? 0 : op_params.begin[begin_count - 2];
+  stop[2] = (size_count < 2 || op_params.size[size_count - 2] == -1)
+                ? input_shape.Dims(2)
+                : start[2] + op_params.size[size_count - 2];
+  start[3] = begin_count < 1 ? 0 : op_params.begin[begin_count - 1];
+  stop[3] = (size_count < 1 || op_params.size[size_count - 1] == -1)
+                ? input_shape.Dims(3)
+                : start[3] + op_params.size[size_count - 1];
+}
+
+template <typename T>
+inline void Slice(const SliceParams &op_params, const Shape &input_shape,
+                  SequentialTensorWriter<T> *writer)
+{
+  int start[4];
+  int stop[4];
+  SliceBounds(op_params, input_shape, start, stop);
 
-  for (int in_b = start_b; in_b < stop_b; ++in_b)
+  for (int in_b = start[0]; in_b < stop[0]; ++in_b)
   {
-    for (int in_h = start_h; in_h < stop_h; ++in_h)
+    for (int in_h = start[1]; in_h < stop[1]; ++in_h)
     {
-      for (int in_w = start_w; in_w < stop_w; ++in_w)
+      for (int in_w = start[2]; in_w < stop[2]; ++in_w)
       {
-        const int len = stop_d - start_d;
+        const int len = stop[3] - start[3];
         if (len > 0)
-          writer->WriteN(Offset(input_shape, in_b, in_h, in_w, start_d), len);
+          writer->WriteN(Offset(input_shape, in_b, in_h, in_w, start[3]), len);
       }
     }
   }
@@ -72,8 +82,27 @@ template <typename T>
 inline void Slice(const SliceParams &op_params, const Shape &input_shape, const T *input_data,
                   T *output_data)
 {
-  SequentialTensorWriter<T> writer(input_data, output_data);
-  return Slice(op_params, input_shape, &writer);
+  int start[4];
+  int stop[4];
+  SliceBounds(op_params, input_shape, start, stop);
+
+  int64_t input_strides[4];
+  optimized::ContiguousStrides(input_shape, input_strides);
+  optimized::StridedCopyDims dims;
+  int64_t input_offset = 0;
+  int64_t output_stride = 1;
+  int64_t output_strides[4];
+  for (int i = 3; i >= 0; --i)
+  {
+    output_strides[i] = output_stride;
+    output_stride *= std::max(stop[i] - start[i], 0);
+  }
+  for (int i = 0; i < 4; ++i)
+  {
+    dims.push(std::max(stop[i] - start[i], 0), input_strides[i], output_strides[i]);
+    input_offset += start[i] * input_strides[i];
+  }
+  optimized::StridedCopy(dims, input_data + input_offset, output_data);
 }
 
 } // namespace cker
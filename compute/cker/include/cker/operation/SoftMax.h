@@ -24,8 +24,9 @@
 #include "cker/eigen/Utils.h"
 
 #include <Eigen/Core>
-#include <fixedpoint/fixedpoint.h>
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace nnfw
 {
@@ -50,85 +51,56 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const
   out_mat.array().rowwise() *= scale;
 }
 
-inline void Softmax(const SoftmaxParams &params, const Shape &input_shape,
-                    const uint8_t *input_data, const Shape &output_shape, uint8_t *output_data)
+// Tabulates exp(-input_scale * beta * diff) at table[255 - diff] for quantized diff in [0, 255]
+inline void PopulateSoftmaxLookupTable(SoftmaxParams *data, float input_scale, float beta)
 {
-  const int32_t input_beta_multiplier = params.input_multiplier;
-  const int32_t input_beta_left_shift = params.input_left_shift;
-  const int diff_min = params.diff_min;
-  // The representation chosen for the input to the exp() function is Q5.26.
-  // We need to leave extra space since values that we skip might be as large as
-  // -32 before multiplying by input_beta_multiplier, and therefore as large as
-  // -16 afterwards.  Note that exp(-8) is definitely not insignificant to
-  // accumulation, but exp(-16) definitely is.
-  static const int kScaledDiffIntegerBits = 5;
-  static const int kAccumulationIntegerBits = 12;
-  using FixedPointScaledDiff = gemmlowp::FixedPoint<int32_t, kScaledDiffIntegerBits>;
-  using FixedPointAccum = gemmlowp::FixedPoint<int32_t, kAccumulationIntegerBits>;
-  using FixedPoint0 = gemmlowp::FixedPoint<int32_t, 0>;
+  const float scale = -input_scale * beta;
+  const int32_t max_uint8 = std::numeric_limits<uint8_t>::max();
+  for (int32_t val = 0; val <= max_uint8; ++val)
+  {
+    data->table[max_uint8 - val] = std::exp(scale * val);
+  }
+}
 
+// Quantized softmax on the table populated by PopulateSoftmaxLookupTable, which replaces the
+// per-element fixed-point exp by one lookup
+template <typename In, typename Out>
+inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const In *input_data,
+                    const Shape &output_shape, Out *output_data)
+{
   const int trailing_dim = input_shape.DimensionsCount() - 1;
   const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
   const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+  const int32_t clamp_max = std::numeric_limits<Out>::max();
+  const int32_t clamp_min = std::numeric_limits<Out>::min();
+  const int32_t max_uint8 = std::numeric_limits<uint8_t>::max();
 
   for (int i = 0; i < outer_size; ++i)
   {
-    uint8_t max_in_row = 0;
+    int32_t max_in_row = std::numeric_limits<In>::min();
     for (int c = 0; c < depth; ++c)
     {
-      max_in_row = std::max(max_in_row, input_data[i * depth + c]);
+      max_in_row = std::max(max_in_row, static_cast<int32_t>(input_data[c]));
     }
 
-    FixedPointAccum sum_of_exps = FixedPointAccum::Zero();
+    // table[table_offset + x] is exp of (x - max_in_row) for every x in the row
+    const int32_t table_offset = max_uint8 - max_in_row;
+    float sum_of_exps = 0.0f;
     for (int c = 0; c < depth; ++c)
     {
-      int32_t input_diff = static_cast<int32_t>(input_data[i * depth + c]) - max_in_row;
-      if (input_diff >= diff_min)
-      {
-        const int32_t input_diff_rescaled = MultiplyByQuantizedMultiplierGreaterThanOne(
-            input_diff, input_beta_multiplier, input_beta_left_shift);
-        const FixedPointScaledDiff scaled_diff_f8 =
-            FixedPointScaledDiff::FromRaw(input_diff_rescaled);
-        sum_of_exps = sum_of_exps + gemmlowp::Rescale<kAccumulationIntegerBits>(
-                                        exp_on_negative_values(scaled_diff_f8));
-      }
+      sum_of_exps += params.table[table_offset + input_data[c]];
     }
 
-    int32_t fixed_sum_of_exps = sum_of_exps.raw();
-    int headroom_plus_one = CountLeadingZeros(static_cast<uint32_t>(fixed_sum_of_exps));
-    // This is the number of bits to the left of the binary point above 1.0.
-    // Consider fixed_sum_of_exps=1.25.  In that case shifted_scale=0.8 and
-    // no later adjustment will be needed.
-    int num_bits_over_unit = kAccumulationIntegerBits - headroom_plus_one;
-    int32_t shifted_sum_minus_one =
-        static_cast<int32_t>((static_cast<uint32_t>(fixed_sum_of_exps) << headroom_plus_one) -
-                             (static_cast<uint32_t>(1) << 31));
-
-    FixedPoint0 shifted_scale =
-        one_over_one_plus_x_for_x_in_0_1(FixedPoint0::FromRaw(shifted_sum_minus_one));
-
+    const float inverse_sum = 1.0f / (sum_of_exps * params.scale);
     for (int c = 0; c < depth; ++c)
     {
-      int32_t input_diff = static_cast<int32_t>(input_data[i * depth + c]) - max_in_row;
-      if (input_diff >= diff_min)
-      {
-        const int32_t input_diff_rescaled = MultiplyByQuantizedMultiplierGreaterThanOne(
-            input_diff, input_beta_multiplier, input_beta_left_shift);
-        const FixedPointScaledDiff scaled_diff_f8 =
-            FixedPointScaledDiff::FromRaw(input_diff_rescaled);
-
-        FixedPoint0 exp_in_0 = exp_on_negative_values(scaled_diff_f8);
-        int32_t unsat_output = gemmlowp::RoundingDivideByPOT((shifted_scale * exp_in_0).raw(),
-                                                             num_bits_over_unit + 31 - 8);
-
-        output_data[i * depth + c] = static_cast<uint8_t>(
-            std::max(std::min(unsat_output, static_cast<int32_t>(255)), static_cast<int32_t>(0)));
-      }
-      else
-      {
-        output_data[i * depth + c] = 0;
-      }
+      const float prob_rescaled = params.table[table_offset + input_data[c]] * inverse_sum;
+      const int32_t prob_quantized = static_cast<int32_t>(prob_rescaled + 0.5f) + params.zero_point;
+      output_data[c] = static_cast<Out>(std::max(std::min(clamp_max, prob_quantized), clamp_min));
     }
+
+    input_data += depth;
+    output_data += depth;
   }
 }
 
@@ -21,6 +21,7 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/operation/optimized/StridedCopy.h"
 
 #include <cmath>
 
@@ -261,45 +262,49 @@ inline void StridedSlice(const StridedSliceParams &op_params, const Shape &unext
                          const T *input_data, const Shape &unextended_output_shape, T *output_data)
 {
   // Note that the output_shape is not used herein.
+  UNUSED_RELEASE(unextended_output_shape);
   StridedSliceParams params_copy = op_params;
 
   assert(unextended_input_shape.DimensionsCount() <= 4);
   assert(unextended_output_shape.DimensionsCount() <= 4);
 
   const Shape input_shape = Shape::ExtendedShape(4, unextended_input_shape);
-  const Shape output_shape = Shape::ExtendedShape(4, unextended_output_shape);
 
   // Reverse and pad to 4 dimensions because that is what the runtime code
   // requires (ie. all shapes must be 4D and are given backwards).
   StridedSlicePadIndices(&params_copy, 4);
 
-  const int start_b = StartForAxis(params_copy, input_shape, 0);
-  const int stop_b = StopForAxis(params_copy, input_shape, 0, start_b);
-  const int start_h = StartForAxis(params_copy, input_shape, 1);
-  const int stop_h = StopForAxis(params_copy, input_shape, 1, start_h);
-  const int start_w = StartForAxis(params_copy, input_shape, 2);
-  const int stop_w = StopForAxis(params_copy, input_shape, 2, start_w);
-  const int start_d = StartForAxis(params_copy, input_shape, 3);
-  const int stop_d = StopForAxis(params_copy, input_shape, 3, start_d);
-
-  T *out_ptr = output_data;
-  for (int in_b = start_b; !LoopCondition(in_b, stop_b, params_copy.strides[0]);
-       in_b += params_copy.strides[0])
+  int64_t input_strides[4];
+  optimized::ContiguousStrides(input_shape, input_strides);
+
+  // Each axis is a dimension of the copy, which runs backward along axes of negative stride
+  int32_t counts[4];
+  int64_t input_offset = 0;
+  for (int axis = 0; axis < 4; ++axis)
   {
-    for (int in_h = start_h; !LoopCondition(in_h, stop_h, params_copy.strides[1]);
-         in_h += params_copy.strides[1])
-    {
-      for (int in_w = start_w; !LoopCondition(in_w, stop_w, params_copy.strides[2]);
-           in_w += params_copy.strides[2])
-      {
-        for (int in_d = start_d; !LoopCondition(in_d, stop_d, params_copy.strides[3]);
-             in_d += params_copy.strides[3])
-        {
-          *out_ptr++ = input_data[Offset(input_shape, in_b, in_h, in_w, in_d)];
-        }
-      }
-    }
+    const int stride = params_copy.strides[axis];
+    const int start = StartForAxis(params_copy, input_shape, axis);
+    const int stop = StopForAxis(params_copy, input_shape, axis, start);
+    const int length = stride > 0 ? stop - start : start - stop;
+    const int step = stride > 0 ? stride : -stride;
+    counts[axis] = length > 0 ? (length + step - 1) / step : 0;
+    input_offset += start * input_strides[axis];
+  }
+
+  optimized::StridedCopyDims dims;
+  int64_t output_strides[4];
+  int64_t output_stride = 1;
+  for (int axis = 3; axis >= 0; --axis)
+  {
+    output_strides[axis] = output_stride;
+    output_stride *= counts[axis];
+  }
+  for (int axis = 0; axis < 4; ++axis)
+  {
+    dims.push(counts[axis], params_copy.strides[axis] * input_strides[axis],
+              output_strides[axis]);
   }
+  optimized::StridedCopy(dims, input_data + input_offset, output_data);
 }
 
 } // namespace cker
@@ -19,52 +19,57 @@
 #define __NNFW_CKER_TILE_H__
 
 #include "cker/Shape.h"
+#include "cker/operation/optimized/StridedCopy.h"
 
 namespace nnfw
 {
 namespace cker
 {
 
+/**
+ * @brief Repeats input multipliers[i] times along each dimension i
+ *
+ * Input is copied into output once, and then the filled block of each dimension is copied
+ * after itself from the innermost dimension outward.
+ */
 template <typename T, typename M>
-void CopyMultipleTimes(const T *in_data, int32_t in_size, M multiplier, T *out_data)
+inline void Tile(const Shape &input_shape, const T *input_data, const M *multipliers,
+                 const Shape &output_shape, T *output_data)
 {
-  for (M i = 0; i < multiplier; ++i)
+  const int rank = input_shape.DimensionsCount();
+  assert(output_shape.DimensionsCount() == rank && rank <= optimized::kStridedCopyMaxDims);
+  for (int i = 0; i < rank; ++i)
   {
-    const T *in_end = in_data + in_size;
-    T *new_out_data = std::copy(in_data, in_end, out_data);
-    in_data = out_data;
-    out_data = new_out_data;
+    assert(output_shape.Dims(i) == input_shape.Dims(i) * static_cast<int>(multipliers[i]));
+    if (multipliers[i] <= 0)
+      return;
   }
-}
 
-template <typename T, typename M>
-std::pair<int, int> TileOneDimension(const Shape &in_dimensions, const T *in_data,
-                                     const M *multipliers, T *out_data, int dimension)
-{
-  const int dimension_size = in_dimensions.Dims(dimension);
-  if (dimension == in_dimensions.DimensionsCount() - 1)
-  {
-    CopyMultipleTimes(in_data, dimension_size, multipliers[dimension], out_data);
-    return std::make_pair(dimension_size,
-                          dimension_size * static_cast<int>(multipliers[dimension]));
-  }
-  int total_stride_size = 0, total_tiled_stride_size = 0;
-  const T *copy_from_data = in_data;
-  T *copy_to_data = out_data;
-  for (int i = 0; i < dimension_size; ++i)
+  int64_t input_strides[optimized::kStridedCopyMaxDims];
+  int64_t output_strides[optimized::kStridedCopyMaxDims];
+  optimized::ContiguousStrides(input_shape, input_strides);
+  optimized::ContiguousStrides(output_shape, output_strides);
+
+  optimized::StridedCopyDims dims;
+  for (int i = 0; i < rank; ++i)
+    dims.push(input_shape.Dims(i), input_strides[i], output_strides[i]);
+  optimized::StridedCopy(dims, input_data, output_data);
+
+  for (int i = rank - 1; i >= 0; --i)
   {
-    int stride_size = 0, tiled_stride_size = 0;
-    std::tie(stride_size, tiled_stride_size) =
-        TileOneDimension(in_dimensions, copy_from_data, multipliers, copy_to_data, dimension + 1);
-    copy_from_data += stride_size;
-    copy_to_data += tiled_stride_size;
-    total_stride_size += stride_size;
-    total_tiled_stride_size += tiled_stride_size;
+    const int64_t count = static_cast<int64_t>(multipliers[i]);
+    if (count == 1)
+      continue;
+    optimized::StridedCopyDims outer;
+    for (int k = 0; k < i; ++k)
+      outer.push(input_shape.Dims(k), 0, output_strides[k]);
+    outer.push(1, 0, 0);
+    const int64_t block = input_shape.Dims(i) * output_strides[i];
+    optimized::ForEachStridedRun(outer, block * count * sizeof(T),
+                                 [&](int64_t, int64_t output_offset) {
+                                   optimized::RepeatRun(output_data + output_offset, block, count);
+                                 });
   }
-  CopyMultipleTimes(out_data, total_tiled_stride_size, multipliers[dimension] - 1,
-                    out_data + total_tiled_stride_size);
-  return std::make_pair(total_stride_size,
-                        static_cast<int>(total_tiled_stride_size * multipliers[dimension]));
 }
 
 } // namespace cker
@@ -1,6 +1,5 @@
 /*
- * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
- * Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,90 +19,66 @@
 
 #include "cker/Shape.h"
 #include "cker/Types.h"
-#include "cker/Utils.h"
+#include "cker/operation/reference/TransposeConv.h"
+#include "cker/operation/optimized/TransposeConv.h"
+
+#include <vector>
 
 namespace nnfw
 {
 namespace cker
 {
 
-inline void TransposeConv(const TransposeConvParams &params, const Shape &input_shape,
-                          const float *input_data, const Shape &filter_shape,
-                          const float *filter_data, const Shape &output_shape, float *output_data)
+class TransposeConv
 {
+public:
+  TransposeConv() : _packed_filter_data(), _col_data(), _prepared(false) {}
 
-  const int stride_width = params.stride_width;
-  const int stride_height = params.stride_height;
-  const int pad_width = params.padding_values.width;
-  const int pad_height = params.padding_values.height;
-
-  assert(input_shape.DimensionsCount() == 4);
-  assert(filter_shape.DimensionsCount() == 4);
-  assert(output_shape.DimensionsCount() == 4);
-
-  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
-  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
-  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
-  const int input_height = input_shape.Dims(1);
-  const int input_width = input_shape.Dims(2);
-  const int filter_height = filter_shape.Dims(1);
-  const int filter_width = filter_shape.Dims(2);
-  const int output_height = output_shape.Dims(1);
-  const int output_width = output_shape.Dims(2);
-
-  // Although transpose convolution simplifies to convolution with transposed
-  // weights for strides of 1, non-unitary striding complicates matters. To
-  // keep this reference implementation as clear as possible, we use a
-  // "scatter" access pattern, where we loop through all the input elements,
-  // computing their influence on the output, rather than looping through the
-  // output elements in the typical "gather" access pattern of a conv. We
-  // therefore must initialize the output array to zero.
-  const int num_elements = output_shape.FlatSize();
-  for (int i = 0; i < num_elements; i++)
+  // Packs constant filter once, after which the original filter is not used any more
+  void prepare(const Shape &filter_shape, const float *filter_data)
   {
-    output_data[i] = 0.0f;
+    if (!_prepared)
+    {
+      packFilter(filter_shape, filter_data);
+      _prepared = true;
+    }
   }
 
-  // Loop through input elements one at a time.
-  for (int batch = 0; batch < batches; ++batch)
+  void operator()(const TransposeConvParams &params, const Shape &input_shape,
+                  const float *input_data, const Shape &filter_shape, const float *filter_data,
+                  const Shape &bias_shape, const float *bias_data, const Shape &output_shape,
+                  float *output_data)
   {
-    for (int in_y = 0; in_y < input_height; ++in_y)
+    if (!_prepared)
+    {
+      // This means that filter is not constant
+      packFilter(filter_shape, filter_data);
+    }
+
+    const size_t col_size = static_cast<size_t>(input_shape.FlatSize() / input_shape.Dims(3)) *
+                            filter_shape.Dims(1) * filter_shape.Dims(2) * filter_shape.Dims(0);
+    if (_col_data.size() < col_size)
     {
-      for (int in_x = 0; in_x < input_width; ++in_x)
-      {
-        for (int in_channel = 0; in_channel < input_depth; ++in_channel)
-        {
-          // Loop through the output elements it will influence
-          const int out_x_origin = (in_x * stride_width) - pad_width;
-          const int out_y_origin = (in_y * stride_height) - pad_height;
-          for (int filter_y = 0; filter_y < filter_height; ++filter_y)
-          {
-            for (int filter_x = 0; filter_x < filter_width; ++filter_x)
-            {
-              for (int out_channel = 0; out_channel < output_depth; ++out_channel)
-              {
-                // Compute output element location
-                const int out_x = out_x_origin + filter_x;
-                const int out_y = out_y_origin + filter_y;
-                // We cannot accumulate out of bounds
-                if ((out_x >= 0) && (out_x < output_width) && (out_y >= 0) &&
-                    (out_y < output_height))
-                {
-                  float input_value =
-                      input_data[Offset(input_shape, batch, in_y, in_x, in_channel)];
-                  float filter_value = filter_data[Offset(filter_shape, out_channel, filter_y,
-                                                          filter_x, in_channel)];
-                  output_data[Offset(output_shape, batch, out_y, out_x, out_channel)] +=
-                      input_value * filter_value;
-                }
-              }
-            }
-          }
-        }
-      }
+      _col_data.resize(col_size);
     }
+
+    multithreaded::TransposeConv(params, input_shape, input_data, filter_shape,
+                                 _packed_filter_data.data(), bias_shape, bias_data, output_shape,
+                                 output_data, _col_data.data());
   }
-}
+
+private:
+  void packFilter(const Shape &filter_shape, const float *filter_data)
+  {
+    _packed_filter_data.resize(filter_shape.FlatSize());
+    optimized::TransposeConvPackFilter(filter_shape, filter_data, _packed_filter_data.data());
+  }
+
+private:
+  std::vector<float> _packed_filter_data;
+  std::vector<float> _col_data;
+  bool _prepared;
+};
 
 } // namespace cker
 } // namespace nnfw
@@ -20,6 +20,7 @@
 
 #include "cker/Shape.h"
 #include "cker/Types.h"
+#include "cker/operation/optimized/StridedCopy.h"
 
 namespace nnfw
 {
@@ -46,15 +47,11 @@ void Unpack(const UnpackParams &params, const Shape &input_shape, const Scalar *
   assert(output_shape.FlatSize() == copy_size * outer_size);
   UNUSED_RELEASE(output_shape);
 
+  optimized::StridedCopyDims dims;
+  dims.push(outer_size, outputs_count * copy_size, copy_size);
+  dims.push(copy_size, 1, 1);
   for (int i = 0; i < outputs_count; ++i)
-  {
-    for (int k = 0; k < outer_size; k++)
-    {
-      Scalar *output_ptr = output_datas[i] + copy_size * k;
-      int loc = k * outputs_count * copy_size + i * copy_size;
-      memcpy(output_ptr, input_data + loc, copy_size * sizeof(Scalar));
-    }
-  }
+    optimized::StridedCopy(dims, input_data + i * copy_size, output_datas[i]);
 }
 
 } // namespace cker
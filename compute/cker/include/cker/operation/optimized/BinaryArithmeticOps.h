@@ -20,6 +20,7 @@
 
 #include <functional>
 #include "cker/neon/neon_check.h"
+#include "cker/operation/optimized/BroadcastElementwise.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
@@ -123,8 +124,9 @@ inline void BinaryBroadcastFiveFold(const BinaryArithmeticOpParam &params,
   }
 }
 
-inline int32_t quant8_sum(const BinaryArithmeticOpParam &params, const uint8_t input1_data,
-                          const uint8_t input2_data)
+template <typename T>
+inline int32_t quant8_sum(const BinaryArithmeticOpParam &params, const T input1_data,
+                          const T input2_data)
 {
   const int32_t input1_val = params.input1_offset + input1_data;
   const int32_t input2_val = params.input2_offset + input2_data;
@@ -143,15 +145,15 @@ inline int32_t quant8_sum(const BinaryArithmeticOpParam &params, const uint8_t i
   return clamped_output;
 }
 
+template <typename T>
 inline void AddElementwiseQuant8(int size, const BinaryArithmeticOpParam &params,
-                                 const uint8_t *input1_data, const uint8_t *input2_data,
-                                 uint8_t *output_data)
+                                 const T *input1_data, const T *input2_data, T *output_data)
 {
   int i = 0;
   for (; i < size; ++i)
   {
     int32_t clamped_output = quant8_sum(params, input1_data[i], input2_data[i]);
-    output_data[i] = static_cast<uint8_t>(clamped_output);
+    output_data[i] = static_cast<T>(clamped_output);
   }
 }
 
@@ -208,9 +210,10 @@ inline void AddElementwise(int size, const BinaryArithmeticOpParam &params,
   }
 }
 
+template <typename T>
 inline void AddQuant8(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
-                      const uint8_t *input1_data, const Shape &input2_shape,
-                      const uint8_t *input2_data, const Shape &output_shape, uint8_t *output_data)
+                      const T *input1_data, const Shape &input2_shape, const T *input2_data,
+                      const Shape &output_shape, T *output_data)
 {
   const int flat_size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
   AddElementwiseQuant8(flat_size, params, input1_data, input2_data, output_data);
@@ -227,16 +230,16 @@ inline void Add(const BinaryArithmeticOpParam &params, const Shape &input1_shape
 // Scalar-broadcast add that can be used for inner loop of more general
 // broadcast add, so that, for example, scalar-broadcast with batch will still
 // be fast.
+template <typename T>
 inline void AddScalarBroadcastQuant8(int size, const BinaryArithmeticOpParam &params,
-                                     uint8_t broadcast_value, const uint8_t *input2_data,
-                                     uint8_t *output_data)
+                                     T broadcast_value, const T *input2_data, T *output_data)
 {
   int i = 0;
   int32_t clamped_output;
   for (; i < size; ++i)
   {
     clamped_output = quant8_sum(params, broadcast_value, input2_data[i]);
-    output_data[i] = static_cast<uint8_t>(clamped_output);
+    output_data[i] = static_cast<T>(clamped_output);
   }
 }
 
@@ -267,30 +270,27 @@ inline void AddScalarBroadcast(int size, const BinaryArithmeticOpParam &params,
   }
 }
 
+template <typename T>
 inline void BroadcastAddDispatchQuant8(const BinaryArithmeticOpParam &params,
-                                       const Shape &input1_shape, const uint8_t *input1_data,
-                                       const Shape &input2_shape, const uint8_t *input2_data,
-                                       const Shape &output_shape, uint8_t *output_data)
+                                       const Shape &input1_shape, const T *input1_data,
+                                       const Shape &input2_shape, const T *input2_data,
+                                       const Shape &output_shape, T *output_data)
 {
   if (params.broadcast_category == BroadcastableOpCategory::kGenericBroadcast)
   {
-    const std::function<uint8_t(const BinaryArithmeticOpParam &, const uint8_t &, const uint8_t &)>
-        fn = [](const BinaryArithmeticOpParam &params, const uint8_t &a,
-                const uint8_t &b) -> uint8_t {
-      return static_cast<uint8_t>(quant8_sum(params, a, b));
-    };
-    reference::BroadcastBinaryArithmeticOpSlowQuant8(params, input1_shape, input1_data,
-                                                     input2_shape, input2_data, output_shape,
-                                                     output_data, fn);
+    BroadcastElementwise(input1_shape, input1_data, input2_shape, input2_data, output_shape,
+                         output_data, [&params](T a, T b) -> T {
+                           return static_cast<T>(quant8_sum(params, a, b));
+                         });
   }
   else
   {
     BinaryBroadcastFiveFold(
         params, input1_shape, input1_data, input2_shape, input2_data, output_shape, output_data,
-        static_cast<void (*)(int, const BinaryArithmeticOpParam &, const uint8_t *, const uint8_t *,
-                             uint8_t *)>(AddElementwiseQuant8),
-        static_cast<void (*)(int, const BinaryArithmeticOpParam &, uint8_t, const uint8_t *,
-                             uint8_t *)>(AddScalarBroadcastQuant8));
+        static_cast<void (*)(int, const BinaryArithmeticOpParam &, const T *, const T *, T *)>(
+            AddElementwiseQuant8<T>),
+        static_cast<void (*)(int, const BinaryArithmeticOpParam &, T, const T *, T *)>(
+            AddScalarBroadcastQuant8<T>));
   }
 }
 
@@ -301,10 +301,13 @@ inline void BroadcastAddDispatch(const BinaryArithmeticOpParam &params, const Sh
 {
   if (params.broadcast_category == BroadcastableOpCategory::kGenericBroadcast)
   {
-    const std::function<float(const float &, const float &)> fn =
-        [](const float &a, const float &b) -> float { return a + b; };
-    reference::BroadcastBinaryArithmeticOpSlow(params, input1_shape, input1_data, input2_shape,
-                                               input2_data, output_shape, output_data, fn);
+    const float activation_min = params.float_activation_min;
+    const float activation_max = params.float_activation_max;
+    BroadcastElementwise(input1_shape, input1_data, input2_shape, input2_data, output_shape,
+                         output_data, [activation_min, activation_max](float a, float b) {
+                           return ActivationFunctionWithMinMax(a + b, activation_min,
+                                                               activation_max);
+                         });
   }
   else
   {
@@ -372,8 +375,9 @@ inline void Sub(const BinaryArithmeticOpParam &params, const Shape &input1_shape
   }
 }
 
-inline int32_t quant8_mul(const BinaryArithmeticOpParam &params, const uint8_t input1_data,
-                          const uint8_t input2_data)
+template <typename T>
+inline int32_t quant8_mul(const BinaryArithmeticOpParam &params, const T input1_data,
+                          const T input2_data)
 {
   const int32_t input1_val = params.input1_offset + input1_data;
   const int32_t input2_val = params.input2_offset + input2_data;
@@ -387,16 +391,16 @@ inline int32_t quant8_mul(const BinaryArithmeticOpParam &params, const uint8_t i
   return clamped_output;
 }
 
+template <typename T>
 inline void MulElementwiseQuant8(int size, const BinaryArithmeticOpParam &params,
-                                 const uint8_t *input1_data, const uint8_t *input2_data,
-                                 uint8_t *output_data)
+                                 const T *input1_data, const T *input2_data, T *output_data)
 {
   int i = 0;
   int32_t clamped_output;
   for (; i < size; i++)
   {
     clamped_output = quant8_mul(params, input1_data[i], input2_data[i]);
-    output_data[i] = static_cast<uint8_t>(clamped_output);
+    output_data[i] = static_cast<T>(clamped_output);
   }
 }
 
@@ -454,9 +458,10 @@ inline void MulElementwise(int size, const BinaryArithmeticOpParam &params,
   }
 }
 
+template <typename T>
 inline void MulQuant8(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
-                      const uint8_t *input1_data, const Shape &input2_shape,
-                      const uint8_t *input2_data, const Shape &output_shape, uint8_t *output_data)
+                      const T *input1_data, const Shape &input2_shape, const T *input2_data,
+                      const Shape &output_shape, T *output_data)
 {
   const int flat_size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
   MulElementwiseQuant8(flat_size, params, input1_data, input2_data, output_data);
@@ -470,16 +475,17 @@ inline void Mul(const BinaryArithmeticOpParam &params, const Shape &input1_shape
   MulElementwise(flat_size, params, input1_data, input2_data, output_data);
 }
 
+template <typename T>
 inline void MulSimpleBroadcastQuant8(int size, const BinaryArithmeticOpParam &params,
-                                     const uint8_t broadcast_value, const uint8_t *input2_data,
-                                     uint8_t *output_data)
+                                     const T broadcast_value, const T *input2_data,
+                                     T *output_data)
 {
   int i = 0;
   int32_t clamped_output;
   for (; i < size; ++i)
   {
     clamped_output = quant8_mul(params, broadcast_value, input2_data[i]);
-    output_data[i] = static_cast<uint8_t>(clamped_output);
+    output_data[i] = static_cast<T>(clamped_output);
   }
 }
 
@@ -515,29 +521,26 @@ inline void MulSimpleBroadcast(int size, const BinaryArithmeticOpParam &params,
   }
 }
 
+template <typename T>
 inline void BroadcastMulDispatchQuant8(const BinaryArithmeticOpParam &params,
-                                       const Shape &input1_shape, const uint8_t *input1_data,
-                                       const Shape &input2_shape, const uint8_t *input2_data,
-                                       const Shape &output_shape, uint8_t *output_data)
+                                       const Shape &input1_shape, const T *input1_data,
+                                       const Shape &input2_shape, const T *input2_data,
+                                       const Shape &output_shape, T *output_data)
 {
   if (params.broadcast_category == BroadcastableOpCategory::kGenericBroadcast)
   {
-    const std::function<uint8_t(const BinaryArithmeticOpParam &, const uint8_t &, const uint8_t &)>
-        fn = [](const BinaryArithmeticOpParam &params, const uint8_t &a,
-                const uint8_t &b) -> uint8_t {
-      return static_cast<uint8_t>(quant8_mul(params, a, b));
-    };
-    reference::BroadcastBinaryArithmeticOpSlowQuant8(params, input1_shape, input1_data,
-                                                     input2_shape, input2_data, output_shape,
-                                                     output_data, fn);
+    BroadcastElementwise(input1_shape, input1_data, input2_shape, input2_data, output_shape,
+                         output_data, [&params](T a, T b) -> T {
+                           return static_cast<T>(quant8_mul(params, a, b));
+                         });
     return;
   }
   BinaryBroadcastFiveFold(
       params, input1_shape, input1_data, input2_shape, input2_data, output_shape, output_data,
-      static_cast<void (*)(int, const BinaryArithmeticOpParam &, const uint8_t *, const uint8_t *,
-                           uint8_t *)>(MulElementwiseQuant8),
-      static_cast<void (*)(int, const BinaryArithmeticOpParam &, uint8_t, const uint8_t *,
-                           uint8_t *)>(MulSimpleBroadcastQuant8));
+      static_cast<void (*)(int, const BinaryArithmeticOpParam &, const T *, const T *, T *)>(
+          MulElementwiseQuant8<T>),
+      static_cast<void (*)(int, const BinaryArithmeticOpParam &, T, const T *, T *)>(
+          MulSimpleBroadcastQuant8<T>));
 }
 
 inline void BroadcastMulDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
@@ -547,11 +550,13 @@ inline void BroadcastMulDispatch(const BinaryArithmeticOpParam &params, const Sh
 {
   if (params.broadcast_category == BroadcastableOpCategory::kGenericBroadcast)
   {
-    // TODO: Use GetBinaryArithmeticFn
-    const std::function<float(const float &, const float &)> fn =
-        [](const float &a, const float &b) -> float { return a * b; };
-    reference::BroadcastBinaryArithmeticOpSlow(params, input1_shape, input1_data, input2_shape,
-                                               input2_data, output_shape, output_data, fn);
+    const float activation_min = params.float_activation_min;
+    const float activation_max = params.float_activation_max;
+    BroadcastElementwise(input1_shape, input1_data, input2_shape, input2_data, output_shape,
+                         output_data, [activation_min, activation_max](float a, float b) {
+                           return ActivationFunctionWithMinMax(a * b, activation_min,
+                                                               activation_max);
+                         });
     return;
   }
   BinaryBroadcastFiveFold(
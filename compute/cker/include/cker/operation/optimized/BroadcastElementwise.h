@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_BROADCAST_ELEMENTWISE_H__
+#define __NNFW_CKER_OPTIMIZED_BROADCAST_ELEMENTWISE_H__
+
+#include "cker/Shape.h"
+
+#include <cassert>
+#include <stdexcept>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+constexpr int kMaxBroadcastDims = 8;
+
+/**
+ * @brief Loops of elementwise broadcast of two inputs to output
+ *
+ * Output dimensions of size 1 are dropped, and neighbouring dimensions are merged when each input
+ * is broadcast along both or along neither of them. Dimension 0 is the innermost one, and the
+ * stride of an input is 0 along a dimension that it is broadcast along.
+ */
+struct BroadcastLoops
+{
+  int num_dims;
+  int dims[kMaxBroadcastDims];
+  int input1_strides[kMaxBroadcastDims];
+  int input2_strides[kMaxBroadcastDims];
+};
+
+inline BroadcastLoops MakeBroadcastLoops(const Shape &input1_shape, const Shape &input2_shape,
+                                         const Shape &output_shape)
+{
+  const int rank = output_shape.DimensionsCount();
+  // Inputs are aligned to the innermost output dimension without ExtendedShape, which is limited
+  // to small shapes
+  const int input1_rank_diff = rank - input1_shape.DimensionsCount();
+  const int input2_rank_diff = rank - input2_shape.DimensionsCount();
+  assert(input1_rank_diff >= 0 && input2_rank_diff >= 0);
+
+  BroadcastLoops loops;
+  loops.num_dims = 0;
+  int input1_stride = 1;
+  int input2_stride = 1;
+  bool prev_broadcast1 = false;
+  bool prev_broadcast2 = false;
+  for (int i = rank - 1; i >= 0; --i)
+  {
+    const int output_dim = output_shape.Dims(i);
+    const int input1_dim = i < input1_rank_diff ? 1 : input1_shape.Dims(i - input1_rank_diff);
+    const int input2_dim = i < input2_rank_diff ? 1 : input2_shape.Dims(i - input2_rank_diff);
+    assert(input1_dim == output_dim || input1_dim == 1);
+    assert(input2_dim == output_dim || input2_dim == 1);
+    if (output_dim == 1)
+      continue;
+
+    const bool broadcast1 = input1_dim == 1;
+    const bool broadcast2 = input2_dim == 1;
+    if (loops.num_dims > 0 && broadcast1 == prev_broadcast1 && broadcast2 == prev_broadcast2)
+    {
+      // Merged dimension keeps the stride of the inner one because they are contiguous
+      loops.dims[loops.num_dims - 1] *= output_dim;
+    }
+    else
+    {
+      if (loops.num_dims == kMaxBroadcastDims)
+        throw std::runtime_error{"Broadcast: too many dimensions to broadcast"};
+      loops.dims[loops.num_dims] = output_dim;
+      loops.input1_strides[loops.num_dims] = broadcast1 ? 0 : input1_stride;
+      loops.input2_strides[loops.num_dims] = broadcast2 ? 0 : input2_stride;
+      loops.num_dims++;
+      prev_broadcast1 = broadcast1;
+      prev_broadcast2 = broadcast2;
+    }
+    input1_stride *= input1_dim;
+    input2_stride *= input2_dim;
+  }
+  return loops;
+}
+
+// Inner loop over contiguous output, where an input of stride 0 is a scalar. Each case is a
+// separate plain loop so that the compiler vectorizes it.
+template <typename In, typename Out, typename Fn>
+inline void BroadcastInnerLoop(const In *input1_data, int input1_stride, const In *input2_data,
+                               int input2_stride, int size, Out *output_data, const Fn &fn)
+{
+  if (input1_stride == 0)
+  {
+    assert(input2_stride == 1);
+    const In input1_value = *input1_data;
+    for (int i = 0; i < size; ++i)
+    {
+      output_data[i] = fn(input1_value, input2_data[i]);
+    }
+  }
+  else if (input2_stride == 0)
+  {
+    assert(input1_stride == 1);
+    const In input2_value = *input2_data;
+    for (int i = 0; i < size; ++i)
+    {
+      output_data[i] = fn(input1_data[i], input2_value);
+    }
+  }
+  else
+  {
+    assert(input1_stride == 1 && input2_stride == 1);
+    for (int i = 0; i < size; ++i)
+    {
+      output_data[i] = fn(input1_data[i], input2_data[i]);
+    }
+  }
+}
+
+/**
+ * @brief output = fn(input1, input2) with numpy-style broadcasting for any rank
+ *
+ * Covers non-broadcast inputs as well, which collapse to one contiguous loop. Outer loops only
+ * step the input offsets by the strides, instead of computing N-d offsets of every element.
+ */
+template <typename In, typename Out, typename Fn>
+inline void BroadcastElementwise(const Shape &input1_shape, const In *input1_data,
+                                 const Shape &input2_shape, const In *input2_data,
+                                 const Shape &output_shape, Out *output_data, const Fn &fn)
+{
+  if (output_shape.FlatSize() == 0)
+    return;
+
+  const BroadcastLoops loops = MakeBroadcastLoops(input1_shape, input2_shape, output_shape);
+  if (loops.num_dims == 0)
+  {
+    output_data[0] = fn(input1_data[0], input2_data[0]);
+    return;
+  }
+
+  const int inner_size = loops.dims[0];
+  int index[kMaxBroadcastDims] = {0};
+  int input1_offset = 0;
+  int input2_offset = 0;
+  while (true)
+  {
+    BroadcastInnerLoop(input1_data + input1_offset, loops.input1_strides[0],
+                       input2_data + input2_offset, loops.input2_strides[0], inner_size,
+                       output_data, fn);
+    output_data += inner_size;
+
+    int d = 1;
+    for (; d < loops.num_dims; ++d)
+    {
+      input1_offset += loops.input1_strides[d];
+      input2_offset += loops.input2_strides[d];
+      if (++index[d] < loops.dims[d])
+        break;
+      input1_offset -= loops.input1_strides[d] * loops.dims[d];
+      input2_offset -= loops.input2_strides[d] * loops.dims[d];
+      index[d] = 0;
+    }
+    if (d == loops.num_dims)
+      break;
+  }
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_BROADCAST_ELEMENTWISE_H__
@@ -175,6 +175,42 @@ namespace multithreaded
 {
 namespace
 {
+// Applies bias, activation and epilogue to each block of the output while it is still in cache,
+// instead of a separate pass over the whole output
+struct ConvOutputKernel
+{
+  const float *bias_data;
+  float activation_min;
+  float activation_max;
+  const FusedEpilogueParams *epilogue;
+  int output_depth;
+
+  template <typename Index, typename Scalar>
+  EIGEN_ALWAYS_INLINE void
+  operator()(const Eigen::internal::blas_data_mapper<Scalar, Index, Eigen::ColMajor> &output_mapper,
+             const Eigen::TensorContractionParams &params, Index i, Index j, Index num_rows,
+             Index num_cols) const
+  {
+    // Row major contraction is evaluated with swapped arguments, so that rows of the block are
+    // output channels from i and columns are output pixels from j
+    assert(params.swapped_arguments);
+    UNUSED_RELEASE(params);
+    const int channel = static_cast<int>(i);
+    const int count = static_cast<int>(num_rows);
+    for (Index col = 0; col < num_cols; ++col)
+    {
+      float *output = &output_mapper(0, col);
+      for (int c = 0; c < count; ++c)
+      {
+        const float bias = bias_data ? bias_data[channel + c] : 0.0f;
+        output[c] = ActivationFunctionWithMinMax(output[c] + bias, activation_min, activation_max);
+      }
+      const size_t offset = static_cast<size_t>(j + col) * output_depth + channel;
+      ApplyFusedEpilogue(*epilogue, channel, count, offset, output);
+    }
+  }
+};
+
 template <class T> class EigenTensorConvFunctor
 {
 private:
@@ -195,11 +231,13 @@ private:
   }
 
 public:
+  template <typename OutputKernel>
   void operator()(const Eigen::ThreadPoolDevice &device, const T *input_data, int input_batches,
                   int input_height, int input_width, int input_depth, const T *filter_data,
                   int filter_height, int filter_width, int filter_count, int stride_rows,
                   int stride_cols, int pad_height, int pad_width, nnfw::cker::PaddingType padding,
-                  T *output_data, int output_height, int output_width)
+                  T *output_data, int output_height, int output_width,
+                  const OutputKernel &output_kernel)
   {
     const bool is_1x1_kernel =
         (filter_height == 1 && filter_width == 1 && stride_rows == 1 && stride_cols == 1);
@@ -230,7 +268,7 @@ public:
       eigen_support::ConstEigenMatrix input(input_data, io_col, filter_col);
       eigen_support::ConstEigenMatrix filter(filter_data, filter_col, filter_count);
       eigen_support::MatMulConvFunctor<Eigen::ThreadPoolDevice, T>()(device, output, input, filter,
-                                                                     dim_pair);
+                                                                     dim_pair, output_kernel);
     }
     else
     {
@@ -240,8 +278,9 @@ public:
                                             input_depth);
       eigen_support::ConstEigenTensor filter(filter_data, filter_height, filter_width, input_depth,
                                              filter_count);
-      output.device(device) = Eigen::SpatialConvolution(input, filter, stride_cols, stride_rows,
-                                                        RuntimePadding2EigenPadding(padding));
+      output.device(device) =
+          Eigen::SpatialConvolution(input, filter, stride_cols, stride_rows,
+                                    RuntimePadding2EigenPadding(padding), 1, 1, output_kernel);
     }
   }
 };
@@ -274,13 +313,15 @@ inline void Conv(const ConvParams &params, const Shape &input_shape, const float
   const int output_height = output_shape.Dims(1);
   const int output_width = output_shape.Dims(2);
 
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+  UNUSED_RELEASE(bias_shape);
+
+  const ConvOutputKernel output_kernel{bias_data, output_activation_min, output_activation_max,
+                                       &params.epilogue, output_depth};
   EigenTensorConvFunctor<float> conv_functor;
   conv_functor(device, input_data, batches, input_height, input_width, input_depth, filter_data,
                filter_height, filter_width, output_depth, stride_height, stride_width, pad_height,
-               pad_width, padding, output_data, output_height, output_width);
-
-  optimized::AddBiasAndEvalActivationFunction(output_activation_min, output_activation_max,
-                                              bias_shape, bias_data, output_shape, output_data);
+               pad_width, padding, output_data, output_height, output_width, output_kernel);
 }
 
 } // namespace multithreaded
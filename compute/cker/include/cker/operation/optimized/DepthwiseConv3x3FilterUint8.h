@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_3X3_FILTER_UINT8_H__
+#define __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_3X3_FILTER_UINT8_H__
+
+#include "cker/neon/neon_check.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <fixedpoint/fixedpoint.h>
+
+#include <algorithm>
+#include <vector>
+
+#if !defined(USE_NEON) && defined(__SSE2__)
+#define CKER_DEPTHWISE_CONV_3X3_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Implementation of quantized DepthwiseConv for 3x3 filters
+//
+// Filter values with filter offset added are widened to int16 once. Then each output pixel
+// accumulates its nine taps over all channels with 8-channel vector multiply-accumulates, NEON on
+// arm/aarch64 and SSE2 on x86. Only border pixels of each output row check filter taps against
+// input bounds.
+
+constexpr int kDepthwiseConv3x3ChannelBlock = 8;
+
+inline bool Fast3x3FilterKernelSupported(const Shape &input_shape, const Shape &filter_shape,
+                                         int32_t stride_width, int32_t stride_height,
+                                         int32_t dilation_width_factor,
+                                         int32_t dilation_height_factor, int32_t pad_width,
+                                         int32_t pad_height, int32_t depth_multiplier,
+                                         const Shape &output_shape, int32_t output_shift)
+{
+  UNUSED_RELEASE(output_shape);
+  UNUSED_RELEASE(output_shift);
+  const int32_t input_depth = input_shape.Dims(3);
+  const int32_t filter_height = filter_shape.Dims(1);
+  const int32_t filter_width = filter_shape.Dims(2);
+
+  return filter_height == 3 && filter_width == 3 && depth_multiplier == 1 &&
+         stride_width == stride_height && (stride_width == 1 || stride_width == 2) &&
+         dilation_width_factor == 1 && dilation_height_factor == 1 && pad_width <= 1 &&
+         pad_height <= 1 && input_depth % kDepthwiseConv3x3ChannelBlock == 0;
+}
+
+// Accumulates (input + input_offset) * filter of one tap into the channels of a pixel
+inline void QuantizedDepthwiseConv3x3AccumTap(const uint8_t *input_ptr, int16_t input_offset,
+                                              const int16_t *filter_ptr, int depth,
+                                              int32_t *acc_ptr)
+{
+  int c = 0;
+#if defined(USE_NEON)
+  const int16x8_t input_offset_vec = vdupq_n_s16(input_offset);
+  for (; c <= depth - 8; c += 8)
+  {
+    const int16x8_t input_s16 = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(input_ptr + c)));
+    const int16x8_t input = vaddq_s16(input_s16, input_offset_vec);
+    const int16x8_t filter = vld1q_s16(filter_ptr + c);
+    int32x4_t acc0 = vld1q_s32(acc_ptr + c);
+    int32x4_t acc1 = vld1q_s32(acc_ptr + c + 4);
+    acc0 = vmlal_s16(acc0, vget_low_s16(input), vget_low_s16(filter));
+    acc1 = vmlal_s16(acc1, vget_high_s16(input), vget_high_s16(filter));
+    vst1q_s32(acc_ptr + c, acc0);
+    vst1q_s32(acc_ptr + c + 4, acc1);
+  }
+#elif defined(CKER_DEPTHWISE_CONV_3X3_USE_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i input_offset_vec = _mm_set1_epi16(input_offset);
+  for (; c <= depth - 8; c += 8)
+  {
+    __m128i input = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(input_ptr + c));
+    input = _mm_add_epi16(_mm_unpacklo_epi8(input, zero), input_offset_vec);
+    const __m128i filter = _mm_loadu_si128(reinterpret_cast<const __m128i *>(filter_ptr + c));
+    // Both operands are within [-255, 255], so low and high halves make exact int32 products
+    const __m128i prod_lo = _mm_mullo_epi16(input, filter);
+    const __m128i prod_hi = _mm_mulhi_epi16(input, filter);
+    __m128i *acc_vec_ptr = reinterpret_cast<__m128i *>(acc_ptr + c);
+    _mm_storeu_si128(acc_vec_ptr, _mm_add_epi32(_mm_loadu_si128(acc_vec_ptr),
+                                                _mm_unpacklo_epi16(prod_lo, prod_hi)));
+    _mm_storeu_si128(acc_vec_ptr + 1, _mm_add_epi32(_mm_loadu_si128(acc_vec_ptr + 1),
+                                                    _mm_unpackhi_epi16(prod_lo, prod_hi)));
+  }
+#endif
+  for (; c < depth; ++c)
+  {
+    acc_ptr[c] += (static_cast<int32_t>(input_ptr[c]) + input_offset) * filter_ptr[c];
+  }
+}
+
+// Requantizes int32 accumulators of a pixel into uint8 outputs
+inline void QuantizedDepthwiseConv3x3StorePixel(const int32_t *acc_ptr, int depth,
+                                                int32_t output_multiplier, int output_shift,
+                                                int32_t output_offset,
+                                                int32_t output_activation_min,
+                                                int32_t output_activation_max,
+                                                uint8_t *output_ptr)
+{
+  int c = 0;
+#ifdef USE_NEON
+  using gemmlowp::RoundingDivideByPOT;
+  const bool shift_left = (output_shift > 0);
+  const int32_t multiplier_power_of_two = shift_left ? (1 << output_shift) : 1;
+  const int32x4_t output_offset_vec = vdupq_n_s32(output_offset);
+  const int32x4_t output_activation_min_vec = vdupq_n_s32(output_activation_min);
+  const int32x4_t output_activation_max_vec = vdupq_n_s32(output_activation_max);
+  for (; c <= depth - 8; c += 8)
+  {
+    int32x4_t acc[2];
+    for (int j = 0; j < 2; j++)
+    {
+      acc[j] = vld1q_s32(acc_ptr + c + 4 * j);
+      if (!shift_left)
+      {
+        acc[j] = vqrdmulhq_n_s32(acc[j], output_multiplier);
+        acc[j] = RoundingDivideByPOT(acc[j], -output_shift);
+      }
+      else
+      {
+        acc[j] = vmulq_n_s32(acc[j], multiplier_power_of_two);
+        acc[j] = vqrdmulhq_n_s32(acc[j], output_multiplier);
+      }
+      acc[j] = vaddq_s32(acc[j], output_offset_vec);
+      acc[j] = vmaxq_s32(acc[j], output_activation_min_vec);
+      acc[j] = vminq_s32(acc[j], output_activation_max_vec);
+    }
+    const int16x8_t res_s16 = vcombine_s16(vqmovn_s32(acc[0]), vqmovn_s32(acc[1]));
+    vst1_u8(output_ptr + c, vqmovun_s16(res_s16));
+  }
+#endif // USE_NEON
+  for (; c < depth; ++c)
+  {
+    int32_t acc = MultiplyByQuantizedMultiplier(acc_ptr[c], output_multiplier, output_shift);
+    acc += output_offset;
+    acc = std::max(acc, output_activation_min);
+    acc = std::min(acc, output_activation_max);
+    output_ptr[c] = static_cast<uint8_t>(acc);
+  }
+}
+
+template <int kStride>
+void DepthwiseConv3x3FilterImpl(const DepthwiseConvParams &params, const Shape &input_shape,
+                                const uint8_t *input_data, const Shape &filter_shape,
+                                const uint8_t *filter_data, const int32_t *bias_data,
+                                const Shape &output_shape, uint8_t *output_data)
+{
+  constexpr int kFilterSize = 3;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int16_t input_offset = static_cast<int16_t>(params.input_offset);
+  const int32_t filter_offset = params.weights_offset;
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+
+  // Filter values with filter offset, laid out as [tap][channel]
+  std::vector<int16_t> filter(kFilterSize * kFilterSize * depth);
+  for (size_t i = 0; i < filter.size(); ++i)
+  {
+    filter[i] = static_cast<int16_t>(filter_data[i] + filter_offset);
+  }
+  std::vector<int32_t> acc(depth);
+
+  // Output columns whose filter taps are all within the input
+  const int interior_start = std::min(output_width, (pad_width + kStride - 1) / kStride);
+  const int interior_limit = input_width + pad_width - (kFilterSize - 1);
+  const int interior_end = std::max(
+      interior_start,
+      std::min(output_width, interior_limit > 0 ? (interior_limit - 1) / kStride + 1 : 0));
+
+  const int input_row_stride = input_width * depth;
+  for (int b = 0; b < batches; ++b)
+  {
+    const uint8_t *input_batch_ptr = input_data + b * input_height * input_row_stride;
+    for (int out_y = 0; out_y < output_height; ++out_y)
+    {
+      const int in_y_origin = out_y * kStride - pad_height;
+      const int filter_y_start = std::max(0, -in_y_origin);
+      const int filter_y_end = std::min(kFilterSize, input_height - in_y_origin);
+      uint8_t *output_row_ptr = output_data + ((b * output_height + out_y) * output_width) * depth;
+
+      auto accum_pixel = [&](int out_x, int filter_x_start, int filter_x_end) {
+        const int in_x_origin = out_x * kStride - pad_width;
+        if (bias_data)
+        {
+          std::copy(bias_data, bias_data + depth, acc.begin());
+        }
+        else
+        {
+          std::fill(acc.begin(), acc.end(), 0);
+        }
+        for (int filter_y = filter_y_start; filter_y < filter_y_end; ++filter_y)
+        {
+          const uint8_t *input_row_ptr =
+              input_batch_ptr + (in_y_origin + filter_y) * input_row_stride;
+          for (int filter_x = filter_x_start; filter_x < filter_x_end; ++filter_x)
+          {
+            QuantizedDepthwiseConv3x3AccumTap(
+                input_row_ptr + (in_x_origin + filter_x) * depth, input_offset,
+                filter.data() + (filter_y * kFilterSize + filter_x) * depth, depth, acc.data());
+          }
+        }
+        QuantizedDepthwiseConv3x3StorePixel(
+            acc.data(), depth, params.output_multiplier, params.output_shift,
+            params.output_offset, params.quantized_activation_min,
+            params.quantized_activation_max, output_row_ptr + out_x * depth);
+      };
+
+      auto accum_border_pixel = [&](int out_x) {
+        const int in_x_origin = out_x * kStride - pad_width;
+        accum_pixel(out_x, std::max(0, -in_x_origin),
+                    std::min(kFilterSize, input_width - in_x_origin));
+      };
+
+      for (int out_x = 0; out_x < interior_start; ++out_x)
+      {
+        accum_border_pixel(out_x);
+      }
+      for (int out_x = interior_start; out_x < interior_end; ++out_x)
+      {
+        accum_pixel(out_x, 0, kFilterSize);
+      }
+      for (int out_x = interior_end; out_x < output_width; ++out_x)
+      {
+        accum_border_pixel(out_x);
+      }
+    }
+  }
+}
+
+inline void DepthwiseConv3x3Filter(const DepthwiseConvParams &params, const Shape &input_shape,
+                                   const uint8_t *input_data, const Shape &filter_shape,
+                                   const uint8_t *filter_data, const Shape &bias_shape,
+                                   const int32_t *bias_data, const Shape &output_shape,
+                                   uint8_t *output_data)
+{
+  assert(bias_shape.FlatSize() == output_shape.Dims(3));
+  UNUSED_RELEASE(bias_shape);
+  assert(params.stride_width == params.stride_height);
+  if (params.stride_width == 1)
+  {
+    DepthwiseConv3x3FilterImpl<1>(params, input_shape, input_data, filter_shape, filter_data,
+                                  bias_data, output_shape, output_data);
+  }
+  else
+  {
+    assert(params.stride_width == 2);
+    DepthwiseConv3x3FilterImpl<2>(params, input_shape, input_data, filter_shape, filter_data,
+                                  bias_data, output_shape, output_data);
+  }
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#ifdef CKER_DEPTHWISE_CONV_3X3_USE_SSE2
+#undef CKER_DEPTHWISE_CONV_3X3_USE_SSE2
+#endif
+
+#endif // __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_3X3_FILTER_UINT8_H__
@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_FLOAT_H__
+#define __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_FLOAT_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/neon/neon_check.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Implementation of float DepthwiseConv
+//
+// Output pixels are computed one by one with all output channels at once, so the innermost loops
+// run over contiguous channels of input, filter and output. Each output row is split into left
+// border, interior and right border. The interior pixels read all filter taps without bounds
+// checks, and their loops over the filter are unrolled for the specialized filter sizes.
+
+struct FloatDepthwiseConvContext
+{
+  int input_height;
+  int input_width;
+  int input_depth;
+  int filter_height;
+  int filter_width;
+  int output_height;
+  int output_width;
+  int output_depth;
+  int stride_width;
+  int stride_height;
+  int dilation_width_factor;
+  int dilation_height_factor;
+  int pad_width;
+  int pad_height;
+  int depth_multiplier;
+  float output_activation_min;
+  float output_activation_max;
+  const float *input_data;
+  const float *filter_data;
+  const float *bias_data;
+  float *output_data;
+};
+
+// Accumulates one filter tap into the output channels of a pixel when depth_multiplier is 1
+inline void FloatDepthwiseConvAccumTap(const float *input_ptr, const float *filter_ptr, int depth,
+                                       float *acc_ptr)
+{
+  int c = 0;
+#ifdef USE_NEON
+  for (; c <= depth - 16; c += 16)
+  {
+    float32x4_t acc[4];
+    for (int i = 0; i < 4; i++)
+    {
+      acc[i] = vld1q_f32(acc_ptr + c + 4 * i);
+    }
+    for (int i = 0; i < 4; i++)
+    {
+      acc[i] = vmlaq_f32(acc[i], vld1q_f32(input_ptr + c + 4 * i),
+                         vld1q_f32(filter_ptr + c + 4 * i));
+    }
+    for (int i = 0; i < 4; i++)
+    {
+      vst1q_f32(acc_ptr + c + 4 * i, acc[i]);
+    }
+  }
+  for (; c <= depth - 4; c += 4)
+  {
+    float32x4_t acc = vld1q_f32(acc_ptr + c);
+    acc = vmlaq_f32(acc, vld1q_f32(input_ptr + c), vld1q_f32(filter_ptr + c));
+    vst1q_f32(acc_ptr + c, acc);
+  }
+#endif // USE_NEON
+  for (; c < depth; ++c)
+  {
+    acc_ptr[c] += input_ptr[c] * filter_ptr[c];
+  }
+}
+
+// Accumulates one filter tap into the output channels of a pixel for any depth_multiplier
+inline void FloatDepthwiseConvAccumTapGeneric(const float *input_ptr, const float *filter_ptr,
+                                              int input_depth, int depth_multiplier,
+                                              float *acc_ptr)
+{
+  for (int ic = 0; ic < input_depth; ++ic)
+  {
+    const float input_value = input_ptr[ic];
+    const float *filter_channel_ptr = filter_ptr + ic * depth_multiplier;
+    float *acc_channel_ptr = acc_ptr + ic * depth_multiplier;
+    int m = 0;
+#ifdef USE_NEON
+    const float32x4_t input_dup = vdupq_n_f32(input_value);
+    for (; m <= depth_multiplier - 4; m += 4)
+    {
+      float32x4_t acc = vld1q_f32(acc_channel_ptr + m);
+      acc = vmlaq_f32(acc, input_dup, vld1q_f32(filter_channel_ptr + m));
+      vst1q_f32(acc_channel_ptr + m, acc);
+    }
+#endif // USE_NEON
+    for (; m < depth_multiplier; ++m)
+    {
+      acc_channel_ptr[m] += input_value * filter_channel_ptr[m];
+    }
+  }
+}
+
+inline void FloatDepthwiseConvInitPixel(const float *bias_data, int depth, float *acc_ptr)
+{
+  if (bias_data)
+  {
+    std::copy(bias_data, bias_data + depth, acc_ptr);
+  }
+  else
+  {
+    std::fill(acc_ptr, acc_ptr + depth, 0.f);
+  }
+}
+
+inline void FloatDepthwiseConvClampPixel(float activation_min, float activation_max, int depth,
+                                         float *acc_ptr)
+{
+  int c = 0;
+#ifdef USE_NEON
+  const float32x4_t activation_min_vec = vdupq_n_f32(activation_min);
+  const float32x4_t activation_max_vec = vdupq_n_f32(activation_max);
+  for (; c <= depth - 4; c += 4)
+  {
+    float32x4_t acc = vld1q_f32(acc_ptr + c);
+    acc = vmaxq_f32(acc, activation_min_vec);
+    acc = vminq_f32(acc, activation_max_vec);
+    vst1q_f32(acc_ptr + c, acc);
+  }
+#endif // USE_NEON
+  for (; c < depth; ++c)
+  {
+    acc_ptr[c] = ActivationFunctionWithMinMax(acc_ptr[c], activation_min, activation_max);
+  }
+}
+
+// Computes one output row. Template parameters fix the filter size and strides of specialized
+// kernels, which also require no dilation and depth_multiplier 1. Zero means a runtime value.
+template <int kFilterHeight, int kFilterWidth, int kStride>
+void FloatDepthwiseConvRow(const FloatDepthwiseConvContext &ctx, int batch, int out_y)
+{
+  constexpr bool kSpecialized = kFilterHeight > 0;
+  const int filter_height = kSpecialized ? kFilterHeight : ctx.filter_height;
+  const int filter_width = kSpecialized ? kFilterWidth : ctx.filter_width;
+  const int stride_width = kSpecialized ? kStride : ctx.stride_width;
+  const int stride_height = kSpecialized ? kStride : ctx.stride_height;
+  const int dilation_width = kSpecialized ? 1 : ctx.dilation_width_factor;
+  const int dilation_height = kSpecialized ? 1 : ctx.dilation_height_factor;
+  const int depth_multiplier = kSpecialized ? 1 : ctx.depth_multiplier;
+  const int input_depth = ctx.input_depth;
+  const int output_depth = ctx.output_depth;
+  const int output_width = ctx.output_width;
+
+  // Filter rows within the input
+  const int in_y_origin = out_y * stride_height - ctx.pad_height;
+  const int filter_y_start =
+      std::max(0, (-in_y_origin + dilation_height - 1) / dilation_height);
+  const int filter_y_end = std::min(
+      filter_height, (ctx.input_height - in_y_origin + dilation_height - 1) / dilation_height);
+
+  // Output columns whose filter taps are all within the input
+  const int interior_start =
+      std::min(output_width, (ctx.pad_width + stride_width - 1) / stride_width);
+  const int interior_limit = ctx.input_width + ctx.pad_width - dilation_width * (filter_width - 1);
+  const int interior_end = std::max(
+      interior_start,
+      std::min(output_width, interior_limit > 0 ? (interior_limit - 1) / stride_width + 1 : 0));
+
+  const int input_row_stride = ctx.input_width * input_depth;
+  const float *input_batch_ptr =
+      ctx.input_data + static_cast<size_t>(batch) * ctx.input_height * input_row_stride;
+  float *output_ptr =
+      ctx.output_data +
+      (static_cast<size_t>(batch) * ctx.output_height + out_y) * output_width * output_depth;
+
+  auto accum_pixel = [&](int out_x, int filter_x_start, int filter_x_end) {
+    float *acc_ptr = output_ptr + out_x * output_depth;
+    const int in_x_origin = out_x * stride_width - ctx.pad_width;
+    FloatDepthwiseConvInitPixel(ctx.bias_data, output_depth, acc_ptr);
+    for (int filter_y = filter_y_start; filter_y < filter_y_end; ++filter_y)
+    {
+      const int in_y = in_y_origin + dilation_height * filter_y;
+      const float *input_row_ptr = input_batch_ptr + in_y * input_row_stride;
+      const float *filter_row_ptr = ctx.filter_data + filter_y * filter_width * output_depth;
+      for (int filter_x = filter_x_start; filter_x < filter_x_end; ++filter_x)
+      {
+        const int in_x = in_x_origin + dilation_width * filter_x;
+        const float *input_ptr = input_row_ptr + in_x * input_depth;
+        const float *filter_ptr = filter_row_ptr + filter_x * output_depth;
+        if (depth_multiplier == 1)
+        {
+          FloatDepthwiseConvAccumTap(input_ptr, filter_ptr, output_depth, acc_ptr);
+        }
+        else
+        {
+          FloatDepthwiseConvAccumTapGeneric(input_ptr, filter_ptr, input_depth, depth_multiplier,
+                                            acc_ptr);
+        }
+      }
+    }
+    FloatDepthwiseConvClampPixel(ctx.output_activation_min, ctx.output_activation_max,
+                                 output_depth, acc_ptr);
+  };
+
+  auto accum_border_pixel = [&](int out_x) {
+    const int in_x_origin = out_x * stride_width - ctx.pad_width;
+    const int filter_x_start = std::max(0, (-in_x_origin + dilation_width - 1) / dilation_width);
+    const int filter_x_end = std::min(
+        filter_width, (ctx.input_width - in_x_origin + dilation_width - 1) / dilation_width);
+    accum_pixel(out_x, filter_x_start, filter_x_end);
+  };
+
+  for (int out_x = 0; out_x < interior_start; ++out_x)
+  {
+    accum_border_pixel(out_x);
+  }
+  for (int out_x = interior_start; out_x < interior_end; ++out_x)
+  {
+    accum_pixel(out_x, 0, filter_width);
+  }
+  for (int out_x = interior_end; out_x < output_width; ++out_x)
+  {
+    accum_border_pixel(out_x);
+  }
+}
+
+using FloatDepthwiseConvRowFunc = void (*)(const FloatDepthwiseConvContext &, int, int);
+
+inline FloatDepthwiseConvRowFunc GetFloatDepthwiseConvRowFunc(const FloatDepthwiseConvContext &ctx)
+{
+  if (ctx.depth_multiplier == 1 && ctx.dilation_width_factor == 1 &&
+      ctx.dilation_height_factor == 1 && ctx.stride_width == ctx.stride_height)
+  {
+#define CKER_USE_FLOAT_DEPTHWISECONV_ROW(FILTER_SIZE, STRIDE)                                \
+  if (ctx.filter_height == FILTER_SIZE && ctx.filter_width == FILTER_SIZE &&                 \
+      ctx.stride_width == STRIDE)                                                            \
+  {                                                                                          \
+    return FloatDepthwiseConvRow<FILTER_SIZE, FILTER_SIZE, STRIDE>;                          \
+  }
+
+    CKER_USE_FLOAT_DEPTHWISECONV_ROW(3, 1)
+    CKER_USE_FLOAT_DEPTHWISECONV_ROW(3, 2)
+    CKER_USE_FLOAT_DEPTHWISECONV_ROW(5, 1)
+    CKER_USE_FLOAT_DEPTHWISECONV_ROW(5, 2)
+
+#undef CKER_USE_FLOAT_DEPTHWISECONV_ROW
+  }
+
+  return FloatDepthwiseConvRow<0, 0, 0>;
+}
+
+inline FloatDepthwiseConvContext
+MakeFloatDepthwiseConvContext(const DepthwiseConvParams &params, const Shape &input_shape,
+                              const float *input_data, const Shape &filter_shape,
+                              const float *filter_data, const Shape &bias_shape,
+                              const float *bias_data, const Shape &output_shape,
+                              float *output_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(params.dilation_width_factor >= 1);
+  assert(params.dilation_height_factor >= 1);
+
+  FloatDepthwiseConvContext ctx;
+  ctx.input_height = input_shape.Dims(1);
+  ctx.input_width = input_shape.Dims(2);
+  ctx.input_depth = input_shape.Dims(3);
+  ctx.filter_height = filter_shape.Dims(1);
+  ctx.filter_width = filter_shape.Dims(2);
+  ctx.output_height = output_shape.Dims(1);
+  ctx.output_width = output_shape.Dims(2);
+  ctx.output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  ctx.stride_width = params.stride_width;
+  ctx.stride_height = params.stride_height;
+  ctx.dilation_width_factor = params.dilation_width_factor;
+  ctx.dilation_height_factor = params.dilation_height_factor;
+  ctx.pad_width = params.padding_values.width;
+  ctx.pad_height = params.padding_values.height;
+  ctx.depth_multiplier = params.depth_multiplier;
+  ctx.output_activation_min = params.float_activation_min;
+  ctx.output_activation_max = params.float_activation_max;
+  ctx.input_data = input_data;
+  ctx.filter_data = filter_data;
+  ctx.bias_data = bias_data;
+  ctx.output_data = output_data;
+  assert(ctx.output_depth == ctx.input_depth * ctx.depth_multiplier);
+  assert(bias_shape.FlatSize() == ctx.output_depth);
+  UNUSED_RELEASE(bias_shape);
+  return ctx;
+}
+
+inline void DepthwiseConv(const DepthwiseConvParams &params, const Shape &input_shape,
+                          const float *input_data, const Shape &filter_shape,
+                          const float *filter_data, const Shape &bias_shape, const float *bias_data,
+                          const Shape &output_shape, float *output_data)
+{
+  const auto ctx =
+      MakeFloatDepthwiseConvContext(params, input_shape, input_data, filter_shape, filter_data,
+                                    bias_shape, bias_data, output_shape, output_data);
+  const auto row_func = GetFloatDepthwiseConvRowFunc(ctx);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int out_y = 0; out_y < ctx.output_height; ++out_y)
+    {
+      row_func(ctx, b, out_y);
+    }
+  }
+}
+
+} // namespace optimized
+
+namespace multithreaded
+{
+
+// Runs optimized float DepthwiseConv dividing output rows of all batches among threads
+inline void DepthwiseConv(const DepthwiseConvParams &params, const Shape &input_shape,
+                          const float *input_data, const Shape &filter_shape,
+                          const float *filter_data, const Shape &bias_shape, const float *bias_data,
+                          const Shape &output_shape, float *output_data)
+{
+  const auto ctx = optimized::MakeFloatDepthwiseConvContext(
+      params, input_shape, input_data, filter_shape, filter_data, bias_shape, bias_data,
+      output_shape, output_data);
+  const auto row_func = optimized::GetFloatDepthwiseConvRowFunc(ctx);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_height = ctx.output_height;
+
+  // Cost of one output row, which lets Eigen run small convolutions on the caller thread
+  const double row_values = static_cast<double>(ctx.output_width) * ctx.output_depth;
+  const double taps = static_cast<double>(ctx.filter_height) * ctx.filter_width;
+  const Eigen::TensorOpCost row_cost(row_values * taps * 2 * sizeof(float),
+                                     row_values * sizeof(float), row_values * taps * 2);
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  device.parallelFor(batches * output_height, row_cost, [&](Eigen::Index first, Eigen::Index last) {
+    for (Eigen::Index row = first; row < last; ++row)
+    {
+      row_func(ctx, static_cast<int>(row / output_height), static_cast<int>(row % output_height));
+    }
+  });
+}
+
+} // namespace multithreaded
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_FLOAT_H__
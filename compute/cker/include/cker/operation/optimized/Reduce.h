@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_REDUCE_H__
+#define __NNFW_CKER_OPTIMIZED_REDUCE_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/Shape.h"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+/**
+ * @brief Input of reduction viewed as [outer, reduced, inner] with contiguous axes collapsed
+ */
+struct ReduceSegments
+{
+  int outer_size;
+  int reduce_size;
+  int inner_size;
+};
+
+/**
+ * @brief Collapses the input shape into [outer, reduced, inner]
+ * @return false if the reduced axes are not contiguous after dropping dimensions of size 1
+ */
+inline bool CollapseReduceAxes(const Shape &input_shape, const int *axis, int num_axis,
+                               ReduceSegments *segments)
+{
+  int sizes[3] = {1, 1, 1};
+  bool reduced[3] = {false, false, false};
+  int num_segments = 0;
+  for (int i = 0; i < input_shape.DimensionsCount(); ++i)
+  {
+    const int dim = input_shape.Dims(i);
+    if (dim == 1)
+      continue;
+    const bool is_reduced = std::find(axis, axis + num_axis, i) != axis + num_axis;
+    if (num_segments > 0 && reduced[num_segments - 1] == is_reduced)
+    {
+      sizes[num_segments - 1] *= dim;
+      continue;
+    }
+    // Only kept, reduced, kept segments in this order can be collapsed
+    if (num_segments == 3 || (num_segments == 2 && reduced[0]))
+      return false;
+    sizes[num_segments] = dim;
+    reduced[num_segments] = is_reduced;
+    num_segments++;
+  }
+
+  segments->outer_size = 1;
+  segments->reduce_size = 1;
+  segments->inner_size = 1;
+  int s = 0;
+  if (s < num_segments && !reduced[s])
+    segments->outer_size = sizes[s++];
+  if (s < num_segments && reduced[s])
+    segments->reduce_size = sizes[s++];
+  if (s < num_segments)
+    segments->inner_size = sizes[s++];
+  return true;
+}
+
+// Number of partial accumulators of a row reduction, which lets the compiler vectorize it
+constexpr int kReduceRowLanes = 8;
+// Number of inner elements reduced together by a thread in a column reduction
+constexpr int kReduceColumnBlock = 256;
+
+// Reduces a contiguous row into one accumulator when the accumulator type differs from the input
+template <typename In, typename Out, typename Reducer>
+inline Out ReduceRow(const In *input, int size, Out init_value, const Reducer &reducer,
+                     std::false_type)
+{
+  Out acc = init_value;
+  for (int i = 0; i < size; ++i)
+    acc = reducer(acc, input[i]);
+  return acc;
+}
+
+// Reduces a contiguous row into partial accumulators that are combined at the end
+template <typename T, typename Reducer>
+inline T ReduceRow(const T *input, int size, T init_value, const Reducer &reducer,
+                   std::true_type)
+{
+  T acc[kReduceRowLanes];
+  std::fill(acc, acc + kReduceRowLanes, init_value);
+  int i = 0;
+  for (; i + kReduceRowLanes <= size; i += kReduceRowLanes)
+  {
+    for (int lane = 0; lane < kReduceRowLanes; ++lane)
+      acc[lane] = reducer(acc[lane], input[i + lane]);
+  }
+  for (; i < size; ++i)
+    acc[0] = reducer(acc[0], input[i]);
+
+  T result = init_value;
+  for (int lane = 0; lane < kReduceRowLanes; ++lane)
+    result = reducer(result, acc[lane]);
+  return result;
+}
+
+/**
+ * @brief Reduces [outer, reduced, inner] input to [outer, inner] output
+ *
+ * Reducer is a functor of (Out accumulator, In value) -> Out. A row of the innermost reduction is
+ * reduced into several partial accumulators if In and Out are the same, and a reduction over an
+ * outer axis accumulates whole inner rows. Therefore the order of accumulation may differ from
+ * the sequential one.
+ */
+template <typename In, typename Out, typename Reducer>
+inline void ReduceSegmented(const ReduceSegments &segments, const In *input_data, Out init_value,
+                            const Reducer &reducer, Out *output_data)
+{
+  const int outer_size = segments.outer_size;
+  const int reduce_size = segments.reduce_size;
+  const int inner_size = segments.inner_size;
+  const int inner_block = std::min(inner_size, kReduceColumnBlock);
+  const int num_inner_blocks = (inner_size + inner_block - 1) / inner_block;
+
+  auto reduce_units = [&](int first, int last) {
+    for (int unit = first; unit < last; ++unit)
+    {
+      const int outer = unit / num_inner_blocks;
+      const In *input = input_data + static_cast<size_t>(outer) * reduce_size * inner_size;
+      Out *output = output_data + static_cast<size_t>(outer) * inner_size;
+      if (inner_size == 1)
+      {
+        output[0] = ReduceRow(input, reduce_size, init_value, reducer, std::is_same<In, Out>{});
+      }
+      else
+      {
+        const int begin = (unit % num_inner_blocks) * inner_block;
+        const int end = std::min(begin + inner_block, inner_size);
+        std::fill(output + begin, output + end, init_value);
+        for (int r = 0; r < reduce_size; ++r)
+        {
+          const In *row = input + static_cast<size_t>(r) * inner_size;
+          for (int i = begin; i < end; ++i)
+            output[i] = reducer(output[i], row[i]);
+        }
+      }
+    }
+  };
+
+  const int num_units = outer_size * num_inner_blocks;
+  const double unit_size = static_cast<double>(reduce_size) * inner_block;
+  const Eigen::TensorOpCost cost(unit_size * sizeof(In), inner_block * sizeof(Out), unit_size);
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  device.parallelFor(num_units, cost, [&](Eigen::Index first, Eigen::Index last) {
+    reduce_units(static_cast<int>(first), static_cast<int>(last));
+  });
+}
+
+/**
+ * @brief Reduces input along axis if the axes collapse into [outer, reduced, inner]
+ * @return false if the axes do not collapse, where the caller should use the generic reduction
+ */
+template <typename In, typename Out, typename Reducer>
+inline bool ReduceContiguous(const Shape &input_shape, const In *input_data, const int *axis,
+                             int num_axis, Out init_value, const Reducer &reducer,
+                             Out *output_data, ReduceSegments *segments)
+{
+  if (!CollapseReduceAxes(input_shape, axis, num_axis, segments))
+    return false;
+  // Output is empty, while empty reduced axes leave the output filled with init_value
+  if (segments->outer_size == 0 || segments->inner_size == 0)
+    return true;
+  ReduceSegmented(*segments, input_data, init_value, reducer, output_data);
+  return true;
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_REDUCE_H__
@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_RESIZE_H__
+#define __NNFW_CKER_OPTIMIZED_RESIZE_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/Shape.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Fraction bits of the fixed-point interpolation weights of integer types
+constexpr int kResizeFractionBits = 10;
+constexpr int32_t kResizeFractionOne = 1 << kResizeFractionBits;
+
+// Channels from which a pixel is interpolated with vector instructions
+constexpr int32_t kResizeVectorDepth = 4;
+
+using ResizeVector = Eigen::Map<Eigen::ArrayXf>;
+using ConstResizeVector = Eigen::Map<const Eigen::ArrayXf>;
+
+// Sources of each output coordinate along one axis, which are computed once for a shape
+struct ResizeAxisTable
+{
+  int32_t input_size = 0;
+  int32_t output_size = 0;
+  bool align_corners = false;
+  bool half_pixel_centers = false;
+  // Source coordinates to interpolate, and the weight of upper
+  // @note lerp is 0 if lower and upper are the same
+  std::vector<int32_t> lower;
+  std::vector<int32_t> upper;
+  std::vector<float> lerp;
+  std::vector<int32_t> fixed_lerp;
+  // Positive if each source is repeated factor times in order, as upsampling by integer factor
+  int32_t factor = 0;
+
+  bool matches(int32_t in_size, int32_t out_size, bool corners, bool half_pixel) const
+  {
+    return input_size == in_size && output_size == out_size && align_corners == corners &&
+           half_pixel_centers == half_pixel && static_cast<int32_t>(lower.size()) == out_size;
+  }
+};
+
+inline float ResizeScale(int32_t input_size, int32_t output_size, bool align_corners)
+{
+  if (align_corners && output_size > 1)
+    return static_cast<float>(input_size - 1) / (output_size - 1);
+  return static_cast<float>(input_size) / output_size;
+}
+
+inline void InitResizeAxisTable(int32_t input_size, int32_t output_size, bool align_corners,
+                                bool half_pixel_centers, ResizeAxisTable *table)
+{
+  table->input_size = input_size;
+  table->output_size = output_size;
+  table->align_corners = align_corners;
+  table->half_pixel_centers = half_pixel_centers;
+  table->lower.resize(output_size);
+  table->upper.resize(output_size);
+  table->lerp.assign(output_size, 0.0f);
+  table->fixed_lerp.assign(output_size, 0);
+  table->factor = 0;
+}
+
+inline void BuildBilinearAxisTable(int32_t input_size, int32_t output_size, bool align_corners,
+                                   bool half_pixel_centers, ResizeAxisTable *table)
+{
+  InitResizeAxisTable(input_size, output_size, align_corners, half_pixel_centers, table);
+  const float scale = ResizeScale(input_size, output_size, align_corners);
+  for (int32_t i = 0; i < output_size; ++i)
+  {
+    const float in = half_pixel_centers ? (i + 0.5f) * scale - 0.5f : i * scale;
+    const int32_t lower =
+        std::min(std::max(static_cast<int32_t>(std::floor(in)), 0), input_size - 1);
+    const int32_t upper = std::min(static_cast<int32_t>(std::ceil(in)), input_size - 1);
+    table->lower[i] = lower;
+    table->upper[i] = std::max(upper, lower);
+    if (table->upper[i] != lower)
+    {
+      table->lerp[i] = in - lower;
+      table->fixed_lerp[i] = static_cast<int32_t>(std::round(table->lerp[i] * kResizeFractionOne));
+    }
+  }
+}
+
+inline void BuildNearestAxisTable(int32_t input_size, int32_t output_size, bool align_corners,
+                                  bool half_pixel_centers, ResizeAxisTable *table)
+{
+  InitResizeAxisTable(input_size, output_size, align_corners, half_pixel_centers, table);
+  const float scale = ResizeScale(input_size, output_size, align_corners);
+  const float offset = half_pixel_centers ? 0.5f : 0.0f;
+  for (int32_t i = 0; i < output_size; ++i)
+  {
+    const float in = (i + offset) * scale;
+    int32_t index = align_corners ? static_cast<int32_t>(std::round(in))
+                                  : static_cast<int32_t>(std::floor(in));
+    index = std::min(index, input_size - 1);
+    if (half_pixel_centers)
+      index = std::max(index, 0);
+    table->lower[i] = index;
+    table->upper[i] = index;
+  }
+
+  if (output_size % input_size == 0)
+  {
+    const int32_t factor = output_size / input_size;
+    bool repeated = true;
+    for (int32_t i = 0; i < output_size && repeated; ++i)
+      repeated = table->lower[i] == i / factor;
+    table->factor = repeated ? factor : 0;
+  }
+}
+
+// Interpolates one input row along width into output_width * depth values
+inline void InterpolateResizeRow(const ResizeAxisTable &x_table, int32_t depth,
+                                 const float *input_row, float *row)
+{
+  for (int32_t x = 0; x < x_table.output_size; ++x, row += depth)
+  {
+    const float *a = input_row + x_table.lower[x] * depth;
+    const float lerp = x_table.lerp[x];
+    if (lerp == 0.0f)
+    {
+      std::memcpy(row, a, depth * sizeof(float));
+      continue;
+    }
+    const float *b = input_row + x_table.upper[x] * depth;
+    if (depth < kResizeVectorDepth)
+    {
+      for (int32_t c = 0; c < depth; ++c)
+        row[c] = a[c] + (b[c] - a[c]) * lerp;
+      continue;
+    }
+    const ConstResizeVector a_vec(a, depth);
+    ResizeVector(row, depth) = a_vec + (ConstResizeVector(b, depth) - a_vec) * lerp;
+  }
+}
+
+// Same as above, keeping values in kResizeFractionBits fixed point
+template <typename T>
+inline void InterpolateResizeRow(const ResizeAxisTable &x_table, int32_t depth, const T *input_row,
+                                 int32_t *row)
+{
+  for (int32_t x = 0; x < x_table.output_size; ++x, row += depth)
+  {
+    const T *a = input_row + x_table.lower[x] * depth;
+    const T *b = input_row + x_table.upper[x] * depth;
+    const int32_t lerp = x_table.fixed_lerp[x];
+    for (int32_t c = 0; c < depth; ++c)
+      row[c] = a[c] * kResizeFractionOne + (b[c] - a[c]) * lerp;
+  }
+}
+
+inline float ResizeLerp(const ResizeAxisTable &table, int32_t i, float) { return table.lerp[i]; }
+
+inline int32_t ResizeLerp(const ResizeAxisTable &table, int32_t i, int32_t)
+{
+  return table.fixed_lerp[i];
+}
+
+// Interpolates two interpolated rows along height
+// @note bottom is not read if lerp is 0
+inline void BlendResizeRows(const float *top, const float *bottom, float lerp, int32_t size,
+                            float *output)
+{
+  if (lerp == 0.0f)
+  {
+    std::memcpy(output, top, size * sizeof(float));
+    return;
+  }
+  const ConstResizeVector top_vec(top, size);
+  ResizeVector(output, size) = top_vec + (ConstResizeVector(bottom, size) - top_vec) * lerp;
+}
+
+template <typename T>
+inline void BlendResizeRows(const int32_t *top, const int32_t *bottom, int32_t lerp, int32_t size,
+                            T *output)
+{
+  constexpr int shift = 2 * kResizeFractionBits;
+  constexpr int32_t rounding = 1 << (shift - 1);
+  if (lerp == 0)
+  {
+    for (int32_t i = 0; i < size; ++i)
+      output[i] = static_cast<T>((top[i] * kResizeFractionOne + rounding) >> shift);
+    return;
+  }
+  for (int32_t i = 0; i < size; ++i)
+    output[i] = static_cast<T>(
+        (top[i] * kResizeFractionOne + (bottom[i] - top[i]) * lerp + rounding) >> shift);
+}
+
+// Resizes NHWC input by bilinear interpolation, where RowT is the type of interpolated rows
+// Each input row is interpolated along width once and kept while output rows use it.
+template <typename T, typename RowT>
+inline void ResizeBilinear(const ResizeAxisTable &y_table, const ResizeAxisTable &x_table,
+                           const Shape &input_shape, const T *input_data,
+                           const Shape &output_shape, T *output_data)
+{
+  const int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int32_t depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int32_t input_height = input_shape.Dims(1);
+  const int32_t output_height = y_table.output_size;
+  const int32_t input_row_size = input_shape.Dims(2) * depth;
+  const int32_t row_size = x_table.output_size * depth;
+  assert(output_shape.Dims(1) == output_height && output_shape.Dims(2) == x_table.output_size);
+  UNUSED_RELEASE(output_shape);
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  const Eigen::TensorOpCost cost(2 * input_row_size * sizeof(T), row_size * sizeof(T),
+                                 6 * row_size);
+  device.parallelFor(batches * output_height, cost, [&](Eigen::Index first, Eigen::Index last) {
+    std::vector<RowT> rows(2 * row_size);
+    RowT *top = rows.data();
+    RowT *bottom = rows.data() + row_size;
+    // Indices of input rows over batches in top and bottom
+    int32_t top_index = -1;
+    int32_t bottom_index = -1;
+    for (Eigen::Index r = first; r < last; ++r)
+    {
+      const int32_t batch = static_cast<int32_t>(r / output_height);
+      const int32_t y = static_cast<int32_t>(r % output_height);
+      const int32_t y0 = batch * input_height + y_table.lower[y];
+      const int32_t y1 = batch * input_height + y_table.upper[y];
+      if (y0 != top_index)
+      {
+        if (y0 == bottom_index)
+        {
+          std::swap(top, bottom);
+          std::swap(top_index, bottom_index);
+        }
+        else
+        {
+          InterpolateResizeRow(x_table, depth,
+                               input_data + static_cast<size_t>(y0) * input_row_size, top);
+          top_index = y0;
+        }
+      }
+      if (y1 != y0 && y1 != bottom_index)
+      {
+        InterpolateResizeRow(x_table, depth,
+                             input_data + static_cast<size_t>(y1) * input_row_size, bottom);
+        bottom_index = y1;
+      }
+      BlendResizeRows(top, bottom, ResizeLerp(y_table, y, RowT()), row_size,
+                      output_data + r * row_size);
+    }
+  });
+}
+
+// Copies source pixels of one output row
+template <typename T>
+inline void GatherResizeRow(const ResizeAxisTable &x_table, int32_t depth, const T *input_row,
+                            T *row)
+{
+  if (x_table.factor > 0)
+  {
+    // Upsampling by integer factor repeats each input pixel
+    const int32_t factor = x_table.factor;
+    for (int32_t x = 0; x < x_table.input_size; ++x, input_row += depth)
+    {
+      if (depth == 1)
+      {
+        std::fill_n(row, factor, *input_row);
+        row += factor;
+        continue;
+      }
+      for (int32_t i = 0; i < factor; ++i, row += depth)
+        std::memcpy(row, input_row, depth * sizeof(T));
+    }
+    return;
+  }
+
+  if (depth == 1)
+  {
+    for (int32_t x = 0; x < x_table.output_size; ++x)
+      row[x] = input_row[x_table.lower[x]];
+    return;
+  }
+  for (int32_t x = 0; x < x_table.output_size; ++x, row += depth)
+    std::memcpy(row, input_row + x_table.lower[x] * depth, depth * sizeof(T));
+}
+
+// Resizes NHWC input by nearest neighbor
+// An output row of the same source row as the previous one is copied from it.
+template <typename T>
+inline void ResizeNearestNeighbor(const ResizeAxisTable &y_table, const ResizeAxisTable &x_table,
+                                  const Shape &input_shape, const T *input_data,
+                                  const Shape &output_shape, T *output_data)
+{
+  const int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int32_t depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int32_t input_height = input_shape.Dims(1);
+  const int32_t output_height = y_table.output_size;
+  const int32_t input_row_size = input_shape.Dims(2) * depth;
+  const int32_t row_size = x_table.output_size * depth;
+  assert(output_shape.Dims(1) == output_height && output_shape.Dims(2) == x_table.output_size);
+  UNUSED_RELEASE(output_shape);
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  const Eigen::TensorOpCost cost(row_size * sizeof(T), row_size * sizeof(T), row_size);
+  device.parallelFor(batches * output_height, cost, [&](Eigen::Index first, Eigen::Index last) {
+    int32_t last_source = -1;
+    for (Eigen::Index r = first; r < last; ++r)
+    {
+      const int32_t batch = static_cast<int32_t>(r / output_height);
+      const int32_t source = batch * input_height + y_table.lower[r % output_height];
+      T *row = output_data + r * row_size;
+      if (source == last_source)
+        std::memcpy(row, row - row_size, row_size * sizeof(T));
+      else
+        GatherResizeRow(x_table, depth,
+                        input_data + static_cast<size_t>(source) * input_row_size, row);
+      last_source = source;
+    }
+  });
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_RESIZE_H__
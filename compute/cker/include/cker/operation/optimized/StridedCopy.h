@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_STRIDED_COPY_H__
+#define __NNFW_CKER_OPTIMIZED_STRIDED_COPY_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/Shape.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+constexpr int kStridedCopyMaxDims = 8;
+// Copies smaller than this are done on the calling thread
+constexpr int64_t kStridedCopyParallelBytes = 1 << 16;
+
+/**
+ * @brief Box of elements to copy, where strides are in elements and input strides may be negative
+ *
+ * Dimension 0 is the outermost. Offsets of the first element are kept by the caller.
+ */
+struct StridedCopyDims
+{
+  int rank = 0;
+  int32_t count[kStridedCopyMaxDims];
+  int64_t input_stride[kStridedCopyMaxDims];
+  int64_t output_stride[kStridedCopyMaxDims];
+
+  void push(int32_t n, int64_t in_stride, int64_t out_stride)
+  {
+    assert(rank < kStridedCopyMaxDims);
+    count[rank] = n;
+    input_stride[rank] = in_stride;
+    output_stride[rank] = out_stride;
+    rank++;
+  }
+
+  int64_t size() const
+  {
+    int64_t size = 1;
+    for (int i = 0; i < rank; ++i)
+      size *= count[i];
+    return size;
+  }
+};
+
+// Strides of a row-major tensor of shape
+inline void ContiguousStrides(const Shape &shape, int64_t *strides)
+{
+  int64_t stride = 1;
+  for (int i = shape.DimensionsCount() - 1; i >= 0; --i)
+  {
+    strides[i] = stride;
+    stride *= shape.Dims(i);
+  }
+}
+
+/**
+ * @brief Drops dimensions of count 1 and merges dimensions that are contiguous in both tensors
+ *
+ * After this, the innermost dimension is the longest run of elements, which is a single memcpy
+ * if both of its strides are 1. A box of one element becomes rank 0.
+ */
+inline void CollapseStridedCopyDims(StridedCopyDims *dims)
+{
+  StridedCopyDims collapsed;
+  for (int i = 0; i < dims->rank; ++i)
+  {
+    if (dims->count[i] == 1)
+      continue;
+    const int last = collapsed.rank - 1;
+    if (last >= 0 &&
+        collapsed.input_stride[last] == dims->input_stride[i] * dims->count[i] &&
+        collapsed.output_stride[last] == dims->output_stride[i] * dims->count[i])
+    {
+      collapsed.count[last] *= dims->count[i];
+      collapsed.input_stride[last] = dims->input_stride[i];
+      collapsed.output_stride[last] = dims->output_stride[i];
+      continue;
+    }
+    collapsed.push(dims->count[i], dims->input_stride[i], dims->output_stride[i]);
+  }
+  *dims = collapsed;
+}
+
+/**
+ * @brief Calls fn(input_offset, output_offset) at each position of the outer dimensions
+ *
+ * All dimensions but the innermost are outer. Positions are split over threads if the copy
+ * moves at least kStridedCopyParallelBytes.
+ */
+template <typename Fn>
+inline void ForEachStridedRun(const StridedCopyDims &dims, int64_t run_bytes, Fn fn)
+{
+  const int outer_rank = dims.rank - 1;
+  int64_t outer_size = 1;
+  for (int i = 0; i < outer_rank; ++i)
+    outer_size *= dims.count[i];
+
+  auto run_range = [&](int64_t first, int64_t last) {
+    if (first >= last)
+      return;
+    // Index of first over the outer dimensions
+    int32_t index[kStridedCopyMaxDims];
+    int64_t input_offset = 0;
+    int64_t output_offset = 0;
+    int64_t rest = first;
+    for (int i = outer_rank - 1; i >= 0; --i)
+    {
+      index[i] = static_cast<int32_t>(rest % dims.count[i]);
+      rest /= dims.count[i];
+      input_offset += index[i] * dims.input_stride[i];
+      output_offset += index[i] * dims.output_stride[i];
+    }
+    for (int64_t p = first; p < last; ++p)
+    {
+      fn(input_offset, output_offset);
+      for (int i = outer_rank - 1; i >= 0; --i)
+      {
+        input_offset += dims.input_stride[i];
+        output_offset += dims.output_stride[i];
+        if (++index[i] < dims.count[i])
+          break;
+        input_offset -= dims.count[i] * dims.input_stride[i];
+        output_offset -= dims.count[i] * dims.output_stride[i];
+        index[i] = 0;
+      }
+    }
+  };
+
+  if (outer_size == 1 || outer_size * run_bytes < kStridedCopyParallelBytes)
+  {
+    run_range(0, outer_size);
+    return;
+  }
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  const Eigen::TensorOpCost cost(run_bytes, run_bytes, 0);
+  device.parallelFor(outer_size, cost, [&](Eigen::Index first, Eigen::Index last) {
+    run_range(first, last);
+  });
+}
+
+/**
+ * @brief Copies the box of dims from input to output
+ *
+ * Runs that are contiguous in both tensors are copied with memcpy, and any other innermost
+ * dimension, including one of negative stride, is copied element by element.
+ */
+template <typename T>
+inline void StridedCopy(StridedCopyDims dims, const T *input_data, T *output_data)
+{
+  CollapseStridedCopyDims(&dims);
+  for (int i = 0; i < dims.rank; ++i)
+  {
+    if (dims.count[i] <= 0)
+      return;
+  }
+  if (dims.rank == 0)
+  {
+    *output_data = *input_data;
+    return;
+  }
+
+  const int inner = dims.rank - 1;
+  const int32_t run = dims.count[inner];
+  const int64_t input_stride = dims.input_stride[inner];
+  const int64_t output_stride = dims.output_stride[inner];
+  const int64_t run_bytes = run * static_cast<int64_t>(sizeof(T));
+  if (input_stride == 1 && output_stride == 1)
+  {
+    ForEachStridedRun(dims, run_bytes, [&](int64_t input_offset, int64_t output_offset) {
+      std::memcpy(output_data + output_offset, input_data + input_offset, run_bytes);
+    });
+    return;
+  }
+  ForEachStridedRun(dims, run_bytes, [&](int64_t input_offset, int64_t output_offset) {
+    const T *in = input_data + input_offset;
+    T *out = output_data + output_offset;
+    for (int32_t i = 0; i < run; ++i, in += input_stride, out += output_stride)
+      *out = *in;
+  });
+}
+
+// Fills count elements with value, with memset if every byte of value is the same
+template <typename T> inline void FillRun(T *output_data, int64_t count, T value)
+{
+  const auto *bytes = reinterpret_cast<const uint8_t *>(&value);
+  if (std::all_of(bytes, bytes + sizeof(T), [&](uint8_t byte) { return byte == bytes[0]; }))
+  {
+    std::memset(output_data, bytes[0], count * sizeof(T));
+    return;
+  }
+  std::fill_n(output_data, count, value);
+}
+
+// Copies a contiguous block after itself until count copies fill output, doubling each memcpy
+template <typename T> inline void RepeatRun(T *data, int64_t size, int64_t count)
+{
+  int64_t filled = 1;
+  while (filled < count)
+  {
+    const int64_t n = std::min(filled, count - filled);
+    std::memcpy(data + filled * size, data, n * size * sizeof(T));
+    filled += n;
+  }
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_STRIDED_COPY_H__
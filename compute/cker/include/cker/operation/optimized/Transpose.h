@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_TRANSPOSE_H__
+#define __NNFW_CKER_OPTIMIZED_TRANSPOSE_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/neon/neon_check.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#if !defined(USE_NEON) && defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+constexpr int kTransposeMaxDims = 6;
+// Side of the square tile of a transpose whose innermost axis moves, in elements
+constexpr int kTransposeTile = 32;
+
+/**
+ * @brief Transpose with dimensions of size 1 removed and adjacent dimensions merged
+ *
+ * Input dimensions that stay adjacent and in order in the output are merged, so that
+ * e.g. NHWC to NCHW becomes [N, HW, C] with perm {0, 2, 1}.
+ */
+struct TransposeDims
+{
+  int rank;
+  int dims[kTransposeMaxDims];
+  int perm[kTransposeMaxDims];
+};
+
+inline void CollapseTransposeDims(const Shape &input_shape, const TransposeParams &params,
+                                  TransposeDims *collapsed)
+{
+  const int rank = params.perm_count;
+  assert(rank <= kTransposeMaxDims);
+  assert(input_shape.DimensionsCount() == rank);
+
+  // Input axes of size 1 are dropped, and the others are renumbered
+  int new_axis[kTransposeMaxDims];
+  int dims[kTransposeMaxDims];
+  int kept = 0;
+  for (int i = 0; i < rank; ++i)
+  {
+    new_axis[i] = input_shape.Dims(i) == 1 ? -1 : kept;
+    if (new_axis[i] >= 0)
+      dims[kept++] = input_shape.Dims(i);
+  }
+  int perm[kTransposeMaxDims];
+  int num_perm = 0;
+  for (int i = 0; i < rank; ++i)
+  {
+    if (new_axis[params.perm[i]] >= 0)
+      perm[num_perm++] = new_axis[params.perm[i]];
+  }
+  assert(num_perm == kept);
+
+  // Output axes that are consecutive input axes form a group
+  int group_first[kTransposeMaxDims];
+  int group_size[kTransposeMaxDims];
+  int num_groups = 0;
+  for (int i = 0; i < num_perm; ++i)
+  {
+    if (i > 0 && perm[i] == perm[i - 1] + 1)
+    {
+      group_size[num_groups - 1] *= dims[perm[i]];
+      continue;
+    }
+    group_first[num_groups] = perm[i];
+    group_size[num_groups] = dims[perm[i]];
+    num_groups++;
+  }
+
+  if (num_groups == 0)
+  {
+    collapsed->rank = 1;
+    collapsed->dims[0] = 1;
+    collapsed->perm[0] = 0;
+    return;
+  }
+  // Groups are numbered in the order of their first input axis
+  collapsed->rank = num_groups;
+  for (int g = 0; g < num_groups; ++g)
+  {
+    int order = 0;
+    for (int h = 0; h < num_groups; ++h)
+    {
+      if (group_first[h] < group_first[g])
+        order++;
+    }
+    collapsed->dims[order] = group_size[g];
+    collapsed->perm[g] = order;
+  }
+}
+
+// Transposes a 4x4 block from rows of input to rows of output
+template <typename T>
+inline void Transpose4x4(const T *input, int input_stride, T *output, int output_stride)
+{
+  for (int r = 0; r < 4; ++r)
+  {
+    for (int c = 0; c < 4; ++c)
+      output[c * output_stride + r] = input[r * input_stride + c];
+  }
+}
+
+#if defined(USE_NEON) || defined(__SSE__)
+// 32-bit values are only moved, so that they are shuffled as float lanes whatever their type is
+template <>
+inline void Transpose4x4<uint32_t>(const uint32_t *input, int input_stride, uint32_t *output,
+                                   int output_stride)
+{
+  const float *in = reinterpret_cast<const float *>(input);
+  float *out = reinterpret_cast<float *>(output);
+#ifdef USE_NEON
+  const float32x4x2_t t01 = vtrnq_f32(vld1q_f32(in), vld1q_f32(in + input_stride));
+  const float32x4x2_t t23 =
+      vtrnq_f32(vld1q_f32(in + 2 * input_stride), vld1q_f32(in + 3 * input_stride));
+  vst1q_f32(out, vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0])));
+  vst1q_f32(out + output_stride, vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1])));
+  vst1q_f32(out + 2 * output_stride,
+            vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0])));
+  vst1q_f32(out + 3 * output_stride,
+            vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1])));
+#else
+  __m128 r0 = _mm_loadu_ps(in);
+  __m128 r1 = _mm_loadu_ps(in + input_stride);
+  __m128 r2 = _mm_loadu_ps(in + 2 * input_stride);
+  __m128 r3 = _mm_loadu_ps(in + 3 * input_stride);
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+  _mm_storeu_ps(out, r0);
+  _mm_storeu_ps(out + output_stride, r1);
+  _mm_storeu_ps(out + 2 * output_stride, r2);
+  _mm_storeu_ps(out + 3 * output_stride, r3);
+#endif
+}
+#endif
+
+// Transposes rows x cols of input into cols x rows of output
+template <typename T>
+inline void TransposeTile(const T *input, int input_stride, int rows, int cols, T *output,
+                          int output_stride)
+{
+  int r = 0;
+  for (; r + 4 <= rows; r += 4)
+  {
+    int c = 0;
+    for (; c + 4 <= cols; c += 4)
+    {
+      Transpose4x4(input + r * input_stride + c, input_stride, output + c * output_stride + r,
+                   output_stride);
+    }
+    for (; c < cols; ++c)
+    {
+      for (int k = 0; k < 4; ++k)
+        output[c * output_stride + r + k] = input[(r + k) * input_stride + c];
+    }
+  }
+  for (; r < rows; ++r)
+  {
+    for (int c = 0; c < cols; ++c)
+      output[c * output_stride + r] = input[r * input_stride + c];
+  }
+}
+
+/**
+ * @brief Transposes input of collapsed dimensions on the thread pool
+ *
+ * If the innermost input axis stays innermost, whole rows are copied. Otherwise the plane of the
+ * innermost input axis and the innermost output axis is transposed tile by tile, so that both
+ * the reads and the writes of a tile stay in cache.
+ */
+template <typename T>
+inline void TransposeCollapsed(const TransposeDims &collapsed, const T *input_data, T *output_data)
+{
+  const int rank = collapsed.rank;
+  const int *dims = collapsed.dims;
+  const int *perm = collapsed.perm;
+
+  size_t input_strides[kTransposeMaxDims];
+  size_t output_strides[kTransposeMaxDims];
+  int output_dims[kTransposeMaxDims];
+  size_t flat_size = 1;
+  for (int i = rank - 1; i >= 0; --i)
+  {
+    input_strides[i] = flat_size;
+    flat_size *= dims[i];
+  }
+  for (int i = rank - 1, stride = 1; i >= 0; --i)
+  {
+    output_dims[i] = dims[perm[i]];
+    output_strides[i] = stride;
+    stride *= output_dims[i];
+  }
+
+  if (rank == 1)
+  {
+    memcpy(output_data, input_data, flat_size * sizeof(T));
+    return;
+  }
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+
+  if (perm[rank - 1] == rank - 1)
+  {
+    const int row_size = dims[rank - 1];
+    const int num_rows = flat_size / row_size;
+    auto copy_rows = [&](int first, int last) {
+      for (int row = first; row < last; ++row)
+      {
+        // Output row index is decoded into the offset of the input row
+        size_t input_offset = 0;
+        for (int i = rank - 2, rest = row; i >= 0; --i)
+        {
+          input_offset += (rest % output_dims[i]) * input_strides[perm[i]];
+          rest /= output_dims[i];
+        }
+        memcpy(output_data + static_cast<size_t>(row) * row_size, input_data + input_offset,
+               row_size * sizeof(T));
+      }
+    };
+    const Eigen::TensorOpCost cost(row_size * sizeof(T), row_size * sizeof(T), rank);
+    device.parallelFor(num_rows, cost, [&](Eigen::Index first, Eigen::Index last) {
+      copy_rows(static_cast<int>(first), static_cast<int>(last));
+    });
+    return;
+  }
+
+  // Plane of input axis row_axis, which is innermost in output, and the innermost input axis
+  const int row_axis = perm[rank - 1];
+  int col_position = 0;
+  while (perm[col_position] != rank - 1)
+    col_position++;
+  const int num_plane_rows = dims[row_axis];
+  const int num_plane_cols = dims[rank - 1];
+  const int input_row_stride = input_strides[row_axis];
+  const int output_col_stride = output_strides[col_position];
+
+  // Other output axes are walked outside of the plane
+  int outer_positions[kTransposeMaxDims];
+  int num_outer = 0;
+  for (int i = 0; i < rank - 1; ++i)
+  {
+    if (i != col_position)
+      outer_positions[num_outer++] = i;
+  }
+  const int num_row_tiles = (num_plane_rows + kTransposeTile - 1) / kTransposeTile;
+
+  auto transpose_units = [&](int first, int last) {
+    for (int unit = first; unit < last; ++unit)
+    {
+      const int row_begin = (unit % num_row_tiles) * kTransposeTile;
+      const int rows = std::min(kTransposeTile, num_plane_rows - row_begin);
+      size_t input_offset = static_cast<size_t>(row_begin) * input_row_stride;
+      size_t output_offset = row_begin;
+      for (int o = num_outer - 1, rest = unit / num_row_tiles; o >= 0; --o)
+      {
+        const int position = outer_positions[o];
+        const int index = rest % output_dims[position];
+        rest /= output_dims[position];
+        input_offset += index * input_strides[perm[position]];
+        output_offset += index * output_strides[position];
+      }
+      for (int col_begin = 0; col_begin < num_plane_cols; col_begin += kTransposeTile)
+      {
+        const int cols = std::min(kTransposeTile, num_plane_cols - col_begin);
+        TransposeTile(input_data + input_offset + col_begin, input_row_stride, rows, cols,
+                      output_data + output_offset + static_cast<size_t>(col_begin) *
+                                                        output_col_stride,
+                      output_col_stride);
+      }
+    }
+  };
+
+  const int num_units = flat_size / num_plane_rows / num_plane_cols * num_row_tiles;
+  const double unit_size = static_cast<double>(kTransposeTile) * num_plane_cols;
+  const Eigen::TensorOpCost cost(unit_size * sizeof(T), unit_size * sizeof(T), unit_size);
+  device.parallelFor(num_units, cost, [&](Eigen::Index first, Eigen::Index last) {
+    transpose_units(static_cast<int>(first), static_cast<int>(last));
+  });
+}
+
+/**
+ * @brief Transposes input up to rank kTransposeMaxDims
+ *
+ * Values are only moved, so that the kernel is instantiated per size of element.
+ */
+template <typename T>
+inline void Transpose(const TransposeParams &params, const Shape &input_shape, const T *input_data,
+                      const Shape &output_shape, T *output_data)
+{
+  UNUSED_RELEASE(output_shape);
+  assert(input_shape.FlatSize() == output_shape.FlatSize());
+  if (input_shape.FlatSize() == 0)
+    return;
+
+  TransposeDims collapsed;
+  CollapseTransposeDims(input_shape, params, &collapsed);
+  switch (sizeof(T))
+  {
+    case 1:
+      TransposeCollapsed(collapsed, reinterpret_cast<const uint8_t *>(input_data),
+                         reinterpret_cast<uint8_t *>(output_data));
+      break;
+    case 2:
+      TransposeCollapsed(collapsed, reinterpret_cast<const uint16_t *>(input_data),
+                         reinterpret_cast<uint16_t *>(output_data));
+      break;
+    case 4:
+      TransposeCollapsed(collapsed, reinterpret_cast<const uint32_t *>(input_data),
+                         reinterpret_cast<uint32_t *>(output_data));
+      break;
+    case 8:
+      TransposeCollapsed(collapsed, reinterpret_cast<const uint64_t *>(input_data),
+                         reinterpret_cast<uint64_t *>(output_data));
+      break;
+    default:
+      throw std::runtime_error{"Transpose: unsupported element size"};
+  }
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_TRANSPOSE_H__
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Packs OHWI filter into [input_depth, filter_height * filter_width * output_depth] matrix so
+// that one GEMM with input pixels gives the contributions of each input pixel to all outputs
+inline void TransposeConvPackFilter(const Shape &filter_shape, const float *filter_data,
+                                    float *packed_filter_data)
+{
+  const int output_depth = filter_shape.Dims(0);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int input_depth = filter_shape.Dims(3);
+  const int filter_spatial = filter_height * filter_width;
+
+  for (int out_c = 0; out_c < output_depth; ++out_c)
+  {
+    for (int k = 0; k < filter_spatial; ++k)
+    {
+      const float *src = filter_data + (out_c * filter_spatial + k) * input_depth;
+      float *dst = packed_filter_data + k * output_depth + out_c;
+      for (int in_c = 0; in_c < input_depth; ++in_c)
+      {
+        dst[in_c * filter_spatial * output_depth] = src[in_c];
+      }
+    }
+  }
+}
+
+struct TransposeConvCol2ImContext
+{
+  const float *col_data;
+  const float *bias_data;
+  float *output_data;
+  int input_height;
+  int input_width;
+  int filter_height;
+  int filter_width;
+  int output_height;
+  int output_width;
+  int output_depth;
+  int stride_height;
+  int stride_width;
+  int pad_height;
+  int pad_width;
+  float activation_min;
+  float activation_max;
+};
+
+// Gathers one output row from the GEMM result, then applies bias and activation on the row
+// while it is still in cache
+inline void TransposeConvCol2ImRow(const TransposeConvCol2ImContext &ctx, int batch, int out_y)
+{
+  const int output_depth = ctx.output_depth;
+  const int col_pixel_size = ctx.filter_height * ctx.filter_width * output_depth;
+  const int row_size = ctx.output_width * output_depth;
+  float *output_row =
+      ctx.output_data + (batch * ctx.output_height + out_y) * ctx.output_width * output_depth;
+
+  if (ctx.bias_data)
+  {
+    for (int out_x = 0; out_x < ctx.output_width; ++out_x)
+    {
+      std::copy(ctx.bias_data, ctx.bias_data + output_depth, output_row + out_x * output_depth);
+    }
+  }
+  else
+  {
+    std::fill(output_row, output_row + row_size, 0.0f);
+  }
+
+  for (int filter_y = 0; filter_y < ctx.filter_height; ++filter_y)
+  {
+    const int in_y_scaled = out_y + ctx.pad_height - filter_y;
+    if (in_y_scaled < 0 || in_y_scaled % ctx.stride_height != 0)
+      continue;
+    const int in_y = in_y_scaled / ctx.stride_height;
+    if (in_y >= ctx.input_height)
+      continue;
+
+    const float *col_row =
+        ctx.col_data + (batch * ctx.input_height + in_y) * ctx.input_width * col_pixel_size;
+    for (int in_x = 0; in_x < ctx.input_width; ++in_x)
+    {
+      const float *col_taps =
+          col_row + in_x * col_pixel_size + filter_y * ctx.filter_width * output_depth;
+      const int out_x_origin = in_x * ctx.stride_width - ctx.pad_width;
+      const int filter_x_begin = std::max(0, -out_x_origin);
+      const int filter_x_end = std::min(ctx.filter_width, ctx.output_width - out_x_origin);
+      for (int filter_x = filter_x_begin; filter_x < filter_x_end; ++filter_x)
+      {
+        const float *src = col_taps + filter_x * output_depth;
+        float *dst = output_row + (out_x_origin + filter_x) * output_depth;
+        for (int c = 0; c < output_depth; ++c)
+        {
+          dst[c] += src[c];
+        }
+      }
+    }
+  }
+
+  for (int i = 0; i < row_size; ++i)
+  {
+    output_row[i] = ActivationFunctionWithMinMax(output_row[i], ctx.activation_min,
+                                                 ctx.activation_max);
+  }
+}
+
+} // namespace optimized
+
+namespace multithreaded
+{
+
+// Computes TransposeConv as GEMM of input pixels and packed filter followed by col2im
+// @note packed_filter_data should be packed by optimized::TransposeConvPackFilter and col_data
+//       should hold batches * input_height * input_width * filter_height * filter_width *
+//       output_depth floats
+inline void TransposeConv(const TransposeConvParams &params, const Shape &input_shape,
+                          const float *input_data, const Shape &filter_shape,
+                          const float *packed_filter_data, const Shape &bias_shape,
+                          const float *bias_data, const Shape &output_shape, float *output_data,
+                          float *col_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  UNUSED_RELEASE(bias_shape);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+
+  // col[pixel][filter_y][filter_x][out_c] = input[pixel][:] * packed_filter[:][...]
+  const int input_pixels = batches * input_height * input_width;
+  const int col_pixel_size = filter_height * filter_width * output_depth;
+  Eigen::array<Eigen::IndexPair<Eigen::DenseIndex>, 1> dim_pair;
+  dim_pair[0] = Eigen::IndexPair<Eigen::DenseIndex>(1, 0);
+  eigen_support::EigenMatrix col(col_data, input_pixels, col_pixel_size);
+  eigen_support::ConstEigenMatrix input(input_data, input_pixels, input_depth);
+  eigen_support::ConstEigenMatrix filter(packed_filter_data, input_depth, col_pixel_size);
+  eigen_support::MatMulConvFunctor<Eigen::ThreadPoolDevice, float>()(device, col, input, filter,
+                                                                     dim_pair);
+
+  optimized::TransposeConvCol2ImContext ctx;
+  ctx.col_data = col_data;
+  ctx.bias_data = bias_data;
+  ctx.output_data = output_data;
+  ctx.input_height = input_height;
+  ctx.input_width = input_width;
+  ctx.filter_height = filter_height;
+  ctx.filter_width = filter_width;
+  ctx.output_height = output_height;
+  ctx.output_width = output_width;
+  ctx.output_depth = output_depth;
+  ctx.stride_height = params.stride_height;
+  ctx.stride_width = params.stride_width;
+  ctx.pad_height = params.padding_values.height;
+  ctx.pad_width = params.padding_values.width;
+  ctx.activation_min = params.float_activation_min;
+  ctx.activation_max = params.float_activation_max;
+
+  // Each output row is gathered by only one thread, so rows need no synchronization
+  const double row_values = static_cast<double>(output_width) * output_depth;
+  const double taps = static_cast<double>(filter_height) * filter_width /
+                      (params.stride_height * params.stride_width);
+  const Eigen::TensorOpCost row_cost(row_values * taps * sizeof(float),
+                                     row_values * sizeof(float), row_values * (taps + 1));
+  device.parallelFor(batches * output_height, row_cost, [&](Eigen::Index first, Eigen::Index last) {
+    for (Eigen::Index row = first; row < last; ++row)
+    {
+      optimized::TransposeConvCol2ImRow(ctx, static_cast<int>(row / output_height),
+                                        static_cast<int>(row % output_height));
+    }
+  });
+}
+
+} // namespace multithreaded
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/operation/Common.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Winograd F(2x2, 3x3): each 2x2 output tile is computed from a 4x4 input tile, so one
+// convolution becomes 16 independent [tiles x input_depth] * [input_depth x output_depth] GEMMs
+constexpr int kWinogradTileSize = 4;
+constexpr int kWinogradOutputTileSize = 2;
+constexpr int kWinogradPoints = kWinogradTileSize * kWinogradTileSize;
+
+// Below this depth the transforms cost more than the multiplications saved by the GEMMs
+constexpr int kWinogradMinDepth = 32;
+
+// Upper bound of the transformed input and GEMM result floats per tile block
+constexpr int kWinogradBlockScratchSize = 1024 * 1024;
+
+inline bool IsWinogradApplicable(const Shape &filter_shape, int stride_width, int stride_height,
+                                 int dilation_width_factor, int dilation_height_factor)
+{
+  return filter_shape.DimensionsCount() == 4 && filter_shape.Dims(1) == 3 &&
+         filter_shape.Dims(2) == 3 && stride_width == 1 && stride_height == 1 &&
+         dilation_width_factor == 1 && dilation_height_factor == 1 &&
+         filter_shape.Dims(0) >= kWinogradMinDepth && filter_shape.Dims(3) >= kWinogradMinDepth;
+}
+
+// The tile count is kept odd so that 16 point planes of power-of-two depth do not map to the same
+// cache sets
+inline int WinogradTilesPerBlock(int input_depth, int output_depth)
+{
+  return (kWinogradBlockScratchSize / (kWinogradPoints * (input_depth + output_depth))) | 1;
+}
+
+// Transforms OHWI 3x3 filter into G * g * G^T, stored as [16][input_depth][output_depth]
+inline void WinogradTransformFilter(const Shape &filter_shape, const float *filter_data,
+                                    float *transformed_filter_data)
+{
+  const int output_depth = filter_shape.Dims(0);
+  const int input_depth = filter_shape.Dims(3);
+  const int point_stride = input_depth * output_depth;
+
+  for (int out_c = 0; out_c < output_depth; ++out_c)
+  {
+    for (int in_c = 0; in_c < input_depth; ++in_c)
+    {
+      float g[3][3];
+      for (int y = 0; y < 3; ++y)
+      {
+        for (int x = 0; x < 3; ++x)
+        {
+          g[y][x] = filter_data[((out_c * 3 + y) * 3 + x) * input_depth + in_c];
+        }
+      }
+
+      // tmp = G * g
+      float tmp[4][3];
+      for (int x = 0; x < 3; ++x)
+      {
+        tmp[0][x] = g[0][x];
+        tmp[1][x] = 0.5f * (g[0][x] + g[1][x] + g[2][x]);
+        tmp[2][x] = 0.5f * (g[0][x] - g[1][x] + g[2][x]);
+        tmp[3][x] = g[2][x];
+      }
+
+      // u = tmp * G^T
+      float *dst = transformed_filter_data + in_c * output_depth + out_c;
+      for (int y = 0; y < 4; ++y)
+      {
+        dst[(y * 4 + 0) * point_stride] = tmp[y][0];
+        dst[(y * 4 + 1) * point_stride] = 0.5f * (tmp[y][0] + tmp[y][1] + tmp[y][2]);
+        dst[(y * 4 + 2) * point_stride] = 0.5f * (tmp[y][0] - tmp[y][1] + tmp[y][2]);
+        dst[(y * 4 + 3) * point_stride] = tmp[y][2];
+      }
+    }
+  }
+}
+
+struct WinogradTileContext
+{
+  int input_height;
+  int input_width;
+  int input_depth;
+  int output_height;
+  int output_width;
+  int output_depth;
+  int tiles_height;
+  int tiles_width;
+  int pad_height;
+  int pad_width;
+  int block_tiles;
+};
+
+// Computes B^T * d * B of the 4x4 input tile for all channels, writing [16][block_tiles][depth]
+// @note Taps outside of the input read from zero_data that holds input_depth zeros
+inline void WinogradTransformInputTile(const WinogradTileContext &ctx, const float *input_data,
+                                       const float *zero_data, int tile, int block_tile,
+                                       float *transformed_input_data)
+{
+  const int tiles_per_batch = ctx.tiles_height * ctx.tiles_width;
+  const int batch = tile / tiles_per_batch;
+  const int in_y_origin =
+      (tile % tiles_per_batch) / ctx.tiles_width * kWinogradOutputTileSize - ctx.pad_height;
+  const int in_x_origin = (tile % ctx.tiles_width) * kWinogradOutputTileSize - ctx.pad_width;
+  const int depth = ctx.input_depth;
+
+  const float *taps[kWinogradPoints];
+  for (int y = 0; y < kWinogradTileSize; ++y)
+  {
+    const int in_y = in_y_origin + y;
+    for (int x = 0; x < kWinogradTileSize; ++x)
+    {
+      const int in_x = in_x_origin + x;
+      const bool inside =
+          in_y >= 0 && in_y < ctx.input_height && in_x >= 0 && in_x < ctx.input_width;
+      taps[y * kWinogradTileSize + x] =
+          inside ? input_data + ((batch * ctx.input_height + in_y) * ctx.input_width + in_x) * depth
+                 : zero_data;
+    }
+  }
+
+  const int point_stride = ctx.block_tiles * depth;
+  float *dst = transformed_input_data + block_tile * depth;
+  for (int c = 0; c < depth; ++c)
+  {
+    // tmp = B^T * d
+    float tmp[4][4];
+    for (int x = 0; x < 4; ++x)
+    {
+      const float d0 = taps[0 * 4 + x][c];
+      const float d1 = taps[1 * 4 + x][c];
+      const float d2 = taps[2 * 4 + x][c];
+      const float d3 = taps[3 * 4 + x][c];
+      tmp[0][x] = d0 - d2;
+      tmp[1][x] = d1 + d2;
+      tmp[2][x] = d2 - d1;
+      tmp[3][x] = d1 - d3;
+    }
+
+    // v = tmp * B
+    for (int y = 0; y < 4; ++y)
+    {
+      dst[(y * 4 + 0) * point_stride + c] = tmp[y][0] - tmp[y][2];
+      dst[(y * 4 + 1) * point_stride + c] = tmp[y][1] + tmp[y][2];
+      dst[(y * 4 + 2) * point_stride + c] = tmp[y][2] - tmp[y][1];
+      dst[(y * 4 + 3) * point_stride + c] = tmp[y][1] - tmp[y][3];
+    }
+  }
+}
+
+// Multiplies [block_tiles][input_depth] transformed input by [input_depth][output_depth]
+// transformed filter of one transform point
+inline void WinogradPointGemm(const WinogradTileContext &ctx, const float *transformed_input_data,
+                              const float *transformed_filter_data, int point, float *gemm_data)
+{
+  using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  Eigen::Map<const RowMajorMatrix> v(transformed_input_data +
+                                         point * ctx.block_tiles * ctx.input_depth,
+                                     ctx.block_tiles, ctx.input_depth);
+  Eigen::Map<const RowMajorMatrix> u(transformed_filter_data +
+                                         point * ctx.input_depth * ctx.output_depth,
+                                     ctx.input_depth, ctx.output_depth);
+  Eigen::Map<RowMajorMatrix> m(gemm_data + point * ctx.block_tiles * ctx.output_depth,
+                               ctx.block_tiles, ctx.output_depth);
+  m.noalias() = v * u;
+}
+
+// Computes A^T * m * A of the GEMM results and writes the valid part of the 2x2 output tile
+// after bias, activation and epilogue
+inline void WinogradTransformOutputTile(const WinogradTileContext &ctx, const float *gemm_data,
+                                        const float *bias_data, float activation_min,
+                                        float activation_max, const FusedEpilogueParams &epilogue,
+                                        int tile, int block_tile, float *output_data)
+{
+  const int tiles_per_batch = ctx.tiles_height * ctx.tiles_width;
+  const int batch = tile / tiles_per_batch;
+  const int out_y_origin = (tile % tiles_per_batch) / ctx.tiles_width * kWinogradOutputTileSize;
+  const int out_x_origin = (tile % ctx.tiles_width) * kWinogradOutputTileSize;
+  const int rows = std::min(kWinogradOutputTileSize, ctx.output_height - out_y_origin);
+  const int cols = std::min(kWinogradOutputTileSize, ctx.output_width - out_x_origin);
+  const int depth = ctx.output_depth;
+
+  float *dst[kWinogradOutputTileSize][kWinogradOutputTileSize];
+  for (int y = 0; y < rows; ++y)
+  {
+    for (int x = 0; x < cols; ++x)
+    {
+      dst[y][x] = output_data +
+                  ((batch * ctx.output_height + out_y_origin + y) * ctx.output_width +
+                   out_x_origin + x) *
+                      depth;
+    }
+  }
+
+  const int point_stride = ctx.block_tiles * depth;
+  const float *src = gemm_data + block_tile * depth;
+  for (int c = 0; c < depth; ++c)
+  {
+    float m[4][4];
+    for (int p = 0; p < kWinogradPoints; ++p)
+    {
+      m[p / 4][p % 4] = src[p * point_stride + c];
+    }
+
+    // tmp = A^T * m
+    float tmp[2][4];
+    for (int x = 0; x < 4; ++x)
+    {
+      tmp[0][x] = m[0][x] + m[1][x] + m[2][x];
+      tmp[1][x] = m[1][x] - m[2][x] - m[3][x];
+    }
+
+    // y = tmp * A
+    const float bias = bias_data ? bias_data[c] : 0.0f;
+    float y[2][2];
+    for (int i = 0; i < 2; ++i)
+    {
+      y[i][0] = tmp[i][0] + tmp[i][1] + tmp[i][2] + bias;
+      y[i][1] = tmp[i][1] - tmp[i][2] - tmp[i][3] + bias;
+    }
+
+    for (int i = 0; i < rows; ++i)
+    {
+      for (int j = 0; j < cols; ++j)
+      {
+        dst[i][j][c] = ActivationFunctionWithMinMax(y[i][j], activation_min, activation_max);
+      }
+    }
+  }
+
+  if (epilogue.type == FusedEpilogueType::kNone)
+    return;
+  for (int i = 0; i < rows; ++i)
+  {
+    for (int j = 0; j < cols; ++j)
+    {
+      ApplyFusedEpilogue(epilogue, 0, depth, dst[i][j] - output_data, dst[i][j]);
+    }
+  }
+}
+
+} // namespace optimized
+
+namespace multithreaded
+{
+
+// Computes 3x3 stride 1 Conv with Winograd F(2x2, 3x3)
+// @note transformed_filter_data should be transformed by optimized::WinogradTransformFilter,
+//       zero_data should hold input_depth zeros, and transformed_input_data and gemm_data should
+//       hold 16 * WinogradTilesPerBlock() * input_depth and output_depth floats respectively
+inline void WinogradConv(const ConvParams &params, const Shape &input_shape,
+                         const float *input_data, const Shape &filter_shape,
+                         const float *transformed_filter_data, const Shape &bias_shape,
+                         const float *bias_data, const Shape &output_shape, float *output_data,
+                         const float *zero_data, float *transformed_input_data, float *gemm_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(params.stride_width == 1 && params.stride_height == 1);
+  UNUSED_RELEASE(bias_shape);
+
+  optimized::WinogradTileContext ctx;
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  ctx.input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  ctx.output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  ctx.input_height = input_shape.Dims(1);
+  ctx.input_width = input_shape.Dims(2);
+  ctx.output_height = output_shape.Dims(1);
+  ctx.output_width = output_shape.Dims(2);
+  ctx.tiles_height = (ctx.output_height + optimized::kWinogradOutputTileSize - 1) /
+                     optimized::kWinogradOutputTileSize;
+  ctx.tiles_width = (ctx.output_width + optimized::kWinogradOutputTileSize - 1) /
+                    optimized::kWinogradOutputTileSize;
+  ctx.pad_height = params.padding_values.height;
+  ctx.pad_width = params.padding_values.width;
+  assert(bias_data == nullptr || bias_shape.FlatSize() == ctx.output_depth);
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  const int input_depth = ctx.input_depth;
+  const int output_depth = ctx.output_depth;
+  const int total_tiles = batches * ctx.tiles_height * ctx.tiles_width;
+  const int max_block_tiles = optimized::WinogradTilesPerBlock(input_depth, output_depth);
+
+  for (int block_begin = 0; block_begin < total_tiles; block_begin += max_block_tiles)
+  {
+    ctx.block_tiles = std::min(max_block_tiles, total_tiles - block_begin);
+
+    const Eigen::TensorOpCost input_cost(optimized::kWinogradPoints * input_depth * sizeof(float),
+                                         optimized::kWinogradPoints * input_depth * sizeof(float),
+                                         optimized::kWinogradPoints * 4 * input_depth);
+    device.parallelFor(ctx.block_tiles, input_cost, [&](Eigen::Index first, Eigen::Index last) {
+      for (Eigen::Index t = first; t < last; ++t)
+      {
+        optimized::WinogradTransformInputTile(ctx, input_data, zero_data,
+                                              block_begin + static_cast<int>(t),
+                                              static_cast<int>(t), transformed_input_data);
+      }
+    });
+
+    // 16 independent GEMMs, one per transform point
+    const double gemm_flops = 2.0 * ctx.block_tiles * input_depth * output_depth;
+    const Eigen::TensorOpCost gemm_cost(
+        (ctx.block_tiles * input_depth + input_depth * output_depth) * sizeof(float),
+        ctx.block_tiles * output_depth * sizeof(float), gemm_flops);
+    device.parallelFor(optimized::kWinogradPoints, gemm_cost,
+                       [&](Eigen::Index first, Eigen::Index last) {
+                         for (Eigen::Index p = first; p < last; ++p)
+                         {
+                           optimized::WinogradPointGemm(ctx, transformed_input_data,
+                                                        transformed_filter_data,
+                                                        static_cast<int>(p), gemm_data);
+                         }
+                       });
+
+    const Eigen::TensorOpCost output_cost(
+        optimized::kWinogradPoints * output_depth * sizeof(float),
+        optimized::kWinogradOutputTileSize * optimized::kWinogradOutputTileSize * output_depth *
+            sizeof(float),
+        optimized::kWinogradPoints * 2 * output_depth);
+    device.parallelFor(ctx.block_tiles, output_cost, [&](Eigen::Index first, Eigen::Index last) {
+      for (Eigen::Index t = first; t < last; ++t)
+      {
+        optimized::WinogradTransformOutputTile(
+            ctx, gemm_data, bias_data, params.float_activation_min, params.float_activation_max,
+            params.epilogue, block_begin + static_cast<int>(t), static_cast<int>(t), output_data);
+      }
+    });
+  }
+}
+
+} // namespace multithreaded
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
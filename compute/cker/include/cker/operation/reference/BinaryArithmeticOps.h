@@ -100,7 +100,7 @@ inline void BroadcastBinaryArithmeticOpSlowQuant8(
         for (int c = 0; c < extended_output_shape.Dims(3); ++c)
         {
           output_data[Offset(extended_output_shape, b, y, x, c)] =
-              ActivationFunctionWithMinMax<uint8_t>(
+              ActivationFunctionWithMinMax<T>(
                   fn(params, input1_data[SubscriptToIndex(desc1, b, y, x, c)],
                      input2_data[SubscriptToIndex(desc2, b, y, x, c)]),
                   params.quantized_activation_min, params.quantized_activation_max);
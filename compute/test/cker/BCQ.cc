@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BCQFullyConnected.h>
+#include <cker/operation/BCQGather.h>
+
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+
+// Two clusters with different qbits over a hidden size that is not a multiple of 32
+struct BCQWeights
+{
+  int hidden_size = 45;
+  int words = 2;
+  std::vector<int32_t> clusters{3, 5, 1, 4};
+  int rows = 9;
+  std::vector<int32_t> binary;
+  std::vector<float> scales;
+  // Dequantized [rows, hidden_size] matrix
+  std::vector<float> dense;
+
+  BCQWeights()
+  {
+    cker_test::LinearCongruential random{7};
+
+    dense.assign(rows * hidden_size, 0.f);
+    int row = 0;
+    for (size_t c = 0; c < clusters.size() / 2; ++c)
+    {
+      for (int r = 0; r < clusters[c * 2 + 1]; ++r, ++row)
+      {
+        for (int q = 0; q < clusters[c * 2]; ++q)
+        {
+          const float alpha = static_cast<float>(random.next() >> 24) / 256.f + 0.1f;
+          scales.push_back(alpha);
+          for (int w = 0; w < words; ++w)
+          {
+            const uint32_t bits = random.next();
+            binary.push_back(static_cast<int32_t>(bits));
+            for (int j = 0; j < 32 && w * 32 + j < hidden_size; ++j)
+            {
+              dense[row * hidden_size + w * 32 + j] += ((bits >> j) & 1u) ? alpha : -alpha;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  nnfw::cker::Shape scales_shape() const { return {static_cast<int>(scales.size())}; }
+  nnfw::cker::Shape binary_shape() const
+  {
+    return {static_cast<int>(binary.size()) / words, words};
+  }
+  nnfw::cker::Shape clusters_shape() const { return {static_cast<int>(clusters.size()) / 2, 2}; }
+};
+
+} // namespace
+
+TEST(CKer_Operation, BCQFullyConnected)
+{
+  BCQWeights weights;
+  const int batches = 3;
+
+  std::vector<float> input(weights.hidden_size * batches);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(static_cast<int>(i % 11) - 5) * 0.25f;
+  std::vector<float> bias(weights.rows);
+  for (int i = 0; i < weights.rows; ++i)
+    bias[i] = 0.5f * i - 2.f;
+
+  nnfw::cker::BCQFullyConnectedParams params;
+  params.weights_hidden_size = weights.hidden_size;
+  params.float_activation_min = -10.f;
+  params.float_activation_max = 10.f;
+
+  std::vector<float> output(weights.rows * batches);
+  nnfw::cker::BCQTempArena arena;
+  nnfw::cker::BCQFullyConnected(
+      params, nnfw::cker::Shape{weights.hidden_size, batches}, input.data(),
+      weights.scales_shape(), weights.scales.data(), weights.binary_shape(),
+      weights.binary.data(), nnfw::cker::Shape{weights.rows}, bias.data(),
+      weights.clusters_shape(), weights.clusters.data(), nnfw::cker::Shape{weights.rows, batches},
+      output.data(), arena);
+
+  for (int r = 0; r < weights.rows; ++r)
+  {
+    for (int b = 0; b < batches; ++b)
+    {
+      float expected = bias[r];
+      for (int i = 0; i < weights.hidden_size; ++i)
+        expected += weights.dense[r * weights.hidden_size + i] * input[i * batches + b];
+      expected = std::min(10.f, std::max(-10.f, expected));
+      EXPECT_NEAR(output[r * batches + b], expected, 1e-4f);
+    }
+  }
+}
+
+TEST(CKer_Operation, BCQGather)
+{
+  BCQWeights weights;
+
+  // axis 0 gathers rows
+  {
+    const std::vector<int32_t> indices{8, 0, 5};
+    nnfw::cker::BCQGatherParams params;
+    params.input_hidden_size = weights.hidden_size;
+    params.axis = 0;
+
+    std::vector<float> output(indices.size() * weights.hidden_size);
+    nnfw::cker::BCQGather<int32_t>(
+        params, weights.scales_shape(), weights.scales.data(), weights.binary_shape(),
+        weights.binary.data(), nnfw::cker::Shape{3}, indices.data(), weights.clusters_shape(),
+        weights.clusters.data(), nnfw::cker::Shape{3, weights.hidden_size}, output.data());
+
+    for (size_t i = 0; i < indices.size(); ++i)
+      for (int j = 0; j < weights.hidden_size; ++j)
+        EXPECT_NEAR(output[i * weights.hidden_size + j],
+                    weights.dense[indices[i] * weights.hidden_size + j], 1e-5f);
+  }
+
+  // axis 1 gathers columns
+  {
+    const std::vector<int64_t> indices{44, 3, 32, 31};
+    nnfw::cker::BCQGatherParams params;
+    params.input_hidden_size = weights.hidden_size;
+    params.axis = 1;
+
+    std::vector<float> output(weights.rows * indices.size());
+    nnfw::cker::BCQGather<int64_t>(
+        params, weights.scales_shape(), weights.scales.data(), weights.binary_shape(),
+        weights.binary.data(), nnfw::cker::Shape{4}, indices.data(), weights.clusters_shape(),
+        weights.clusters.data(), nnfw::cker::Shape{weights.rows, 4}, output.data());
+
+    for (int r = 0; r < weights.rows; ++r)
+      for (size_t i = 0; i < indices.size(); ++i)
+        EXPECT_NEAR(output[r * indices.size() + i],
+                    weights.dense[r * weights.hidden_size + indices[i]], 1e-5f);
+  }
+
+  // Out of range index
+  {
+    const std::vector<int32_t> indices{9};
+    nnfw::cker::BCQGatherParams params;
+    params.input_hidden_size = weights.hidden_size;
+    params.axis = 0;
+
+    std::vector<float> output(weights.hidden_size);
+    EXPECT_ANY_THROW(nnfw::cker::BCQGather<int32_t>(
+        params, weights.scales_shape(), weights.scales.data(), weights.binary_shape(),
+        weights.binary.data(), nnfw::cker::Shape{1}, indices.data(), weights.clusters_shape(),
+        weights.clusters.data(), nnfw::cker::Shape{1, weights.hidden_size}, output.data()));
+  }
+}
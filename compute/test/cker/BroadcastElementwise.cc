@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/Comparison.h>
+#include <cker/operation/SqDiff.h>
+
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+
+using cker_test::makeData;
+using nnfw::cker::Shape;
+
+// Computes the element of broadcast input at output index by N-d subscripts
+int broadcastIndex(const Shape &input_shape, const Shape &output_shape, int output_index)
+{
+  const int rank = output_shape.DimensionsCount();
+  const int rank_diff = rank - input_shape.DimensionsCount();
+  int index = 0;
+  int stride = 1;
+  for (int i = rank - 1; i >= 0; --i)
+  {
+    const int subscript = output_index % output_shape.Dims(i);
+    output_index /= output_shape.Dims(i);
+    const int input_dim = i < rank_diff ? 1 : input_shape.Dims(i - rank_diff);
+    if (input_dim != 1)
+      index += subscript * stride;
+    stride *= input_dim;
+  }
+  return index;
+}
+
+struct BroadcastCase
+{
+  Shape input1_shape;
+  Shape input2_shape;
+  Shape output_shape;
+};
+
+// input1_shape, input2_shape, output_shape
+const BroadcastCase kCases[] = {
+    // no broadcast
+    {Shape{2, 3, 4}, Shape{2, 3, 4}, Shape{2, 3, 4}},
+    // scalar
+    {Shape{2, 3, 4}, Shape{1}, Shape{2, 3, 4}},
+    {Shape{1}, Shape{3, 5}, Shape{3, 5}},
+    // row
+    {Shape{4, 3, 8}, Shape{8}, Shape{4, 3, 8}},
+    // column
+    {Shape{4, 6, 1}, Shape{4, 6, 7}, Shape{4, 6, 7}},
+    // mixed, beyond 4-D
+    {Shape{2, 1, 3, 1, 5}, Shape{1, 4, 3, 6, 1}, Shape{2, 4, 3, 6, 5}},
+    {Shape{3, 1, 2, 1, 1, 4}, Shape{1, 5, 1, 2, 3, 1}, Shape{3, 5, 2, 2, 3, 4}},
+    // single element
+    {Shape{1, 1}, Shape{1, 1}, Shape{1, 1}},
+};
+
+} // namespace
+
+TEST(CKer_Operation, BroadcastElementwise)
+{
+  for (const auto &c : kCases)
+  {
+    const auto input1 = makeData<int32_t>(c.input1_shape.FlatSize(), 1);
+    const auto input2 = makeData<int32_t>(c.input2_shape.FlatSize(), 2);
+    const int output_size = c.output_shape.FlatSize();
+
+    std::vector<int32_t> output(output_size);
+    nnfw::cker::optimized::BroadcastElementwise(
+        c.input1_shape, input1.data(), c.input2_shape, input2.data(), c.output_shape, output.data(),
+        [](int32_t a, int32_t b) { return a * 1000 + b; });
+    for (int i = 0; i < output_size; ++i)
+    {
+      const int32_t a = input1[broadcastIndex(c.input1_shape, c.output_shape, i)];
+      const int32_t b = input2[broadcastIndex(c.input2_shape, c.output_shape, i)];
+      ASSERT_EQ(output[i], a * 1000 + b) << "at " << i;
+    }
+  }
+}
+
+TEST(CKer_Operation, BroadcastBinaryOps)
+{
+  for (const auto &c : kCases)
+  {
+    const auto input1 = makeData<int32_t>(c.input1_shape.FlatSize(), 3);
+    const auto input2 = makeData<int32_t>(c.input2_shape.FlatSize(), 4);
+    const int output_size = c.output_shape.FlatSize();
+
+    nnfw::cker::BinaryArithmeticOpParam params;
+    params.quantized_activation_min = -100;
+    params.quantized_activation_max = 100;
+    std::vector<int32_t> sub(output_size);
+    nnfw::cker::BroadcastBinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::SUB>(
+        params, c.input1_shape, input1.data(), c.input2_shape, input2.data(), c.output_shape,
+        sub.data());
+
+    std::vector<int32_t> sqdiff(output_size);
+    nnfw::cker::SqDiff(c.input1_shape, input1.data(), c.input2_shape, input2.data(),
+                       c.output_shape, sqdiff.data());
+
+    std::vector<uint8_t> greater(output_size);
+    nnfw::cker::Broadcast4DSlowGreater(c.input1_shape, input1.data(), c.input2_shape,
+                                       input2.data(), c.output_shape,
+                                       reinterpret_cast<bool *>(greater.data()));
+
+    for (int i = 0; i < output_size; ++i)
+    {
+      const int32_t a = input1[broadcastIndex(c.input1_shape, c.output_shape, i)];
+      const int32_t b = input2[broadcastIndex(c.input2_shape, c.output_shape, i)];
+      ASSERT_EQ(sub[i], std::min(100, std::max(-100, a - b))) << "at " << i;
+      ASSERT_EQ(sqdiff[i], (a - b) * (a - b)) << "at " << i;
+      ASSERT_EQ(greater[i] != 0, a > b) << "at " << i;
+    }
+  }
+}
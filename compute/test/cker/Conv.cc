@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Conv.h>
+
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+using cker_test::makeData;
+
+struct ConvCase
+{
+  int input_height;
+  int input_width;
+  int input_depth;
+  int output_depth;
+  int pad;
+};
+
+// Runs 3x3 stride 1 Conv and compares it with the reference kernel
+void verifyConv3x3(const ConvCase &c, bool constant_filter)
+{
+  const int batches = 2;
+  const int output_height = c.input_height - 2 + 2 * c.pad;
+  const int output_width = c.input_width - 2 + 2 * c.pad;
+
+  nnfw::cker::Shape input_shape{batches, c.input_height, c.input_width, c.input_depth};
+  nnfw::cker::Shape filter_shape{c.output_depth, 3, 3, c.input_depth};
+  nnfw::cker::Shape bias_shape{c.output_depth};
+  nnfw::cker::Shape output_shape{batches, output_height, output_width, c.output_depth};
+
+  const auto input = makeData(input_shape.FlatSize(), 1);
+  const auto filter = makeData(filter_shape.FlatSize(), 2);
+  const auto bias = makeData(c.output_depth, 3);
+
+  nnfw::cker::ConvParams params;
+  params.padding_type = c.pad ? nnfw::cker::PaddingType::kSame : nnfw::cker::PaddingType::kValid;
+  params.padding_values.width = c.pad;
+  params.padding_values.height = c.pad;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.float_activation_min = -4.f;
+  params.float_activation_max = 4.f;
+
+  std::vector<float> expected(output_shape.FlatSize());
+  nnfw::cker::reference::Conv(params, input_shape, input.data(), filter_shape, filter.data(),
+                              bias_shape, bias.data(), output_shape, expected.data());
+
+  const bool winograd = nnfw::cker::optimized::IsWinogradApplicable(filter_shape, 1, 1, 1, 1);
+  nnfw::cker::Conv kernel;
+  if (constant_filter)
+  {
+    bool is_replaced_weights = false;
+    kernel.prepare(filter_shape, filter.data(), params.padding_type, is_replaced_weights, 1, 1);
+    if (winograd)
+      ASSERT_TRUE(is_replaced_weights);
+  }
+
+  // Run twice to check that buffers are reused correctly
+  for (int run = 0; run < 2; run++)
+  {
+    std::vector<float> actual(output_shape.FlatSize(), 100.f);
+    // Transformed constant filter should be enough for Winograd
+    const float *filter_data = (constant_filter && winograd) ? nullptr : filter.data();
+    kernel(params, input_shape, input.data(), filter_shape, filter_data, bias_shape, bias.data(),
+           output_shape, actual.data());
+    for (size_t i = 0; i < expected.size(); i++)
+      ASSERT_NEAR(actual[i], expected[i], 1e-4) << "at " << i;
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, Conv3x3Winograd)
+{
+  // input_h, input_w, input_depth, output_depth, pad
+  const ConvCase cases[] = {
+      {8, 8, 32, 32, 1},  // even output
+      {7, 5, 32, 48, 1},  // odd output, partial tiles
+      {9, 6, 64, 32, 0},  // valid padding
+      {3, 3, 32, 32, 0},  // single output pixel
+      {6, 6, 16, 32, 1},  // too shallow for Winograd
+      {12, 10, 48, 4, 1}, // too few outputs for Winograd
+  };
+
+  for (const auto &c : cases)
+  {
+    verifyConv3x3(c, true);
+    verifyConv3x3(c, false);
+  }
+}
+
+TEST(CKer_Operation, Conv3x3WinogradLarge)
+{
+  // Spans several tile blocks
+  verifyConv3x3({66, 70, 64, 64, 1}, true);
+}
+
+TEST(CKer_Operation, ConvFusedEpilogue)
+{
+  struct EpilogueCase
+  {
+    int input_size, input_depth, kernel_size, stride, output_depth;
+    nnfw::cker::FusedEpilogueType type;
+    bool per_channel;
+  };
+  using nnfw::cker::FusedEpilogueType;
+  const EpilogueCase cases[] = {
+      {7, 12, 1, 1, 20, FusedEpilogueType::kAdd, false}, // matrix multiplication
+      {9, 4, 3, 2, 8, FusedEpilogueType::kMul, true},    // spatial convolution
+      {3, 5, 3, 1, 7, FusedEpilogueType::kAdd, true},    // kernel of the input size
+      {8, 32, 3, 1, 32, FusedEpilogueType::kMul, false}, // Winograd
+  };
+
+  for (const auto &c : cases)
+  {
+    const int batches = 2;
+    const int output_size = (c.input_size - c.kernel_size) / c.stride + 1;
+    nnfw::cker::Shape input_shape{batches, c.input_size, c.input_size, c.input_depth};
+    nnfw::cker::Shape filter_shape{c.output_depth, c.kernel_size, c.kernel_size, c.input_depth};
+    nnfw::cker::Shape bias_shape{c.output_depth};
+    nnfw::cker::Shape output_shape{batches, output_size, output_size, c.output_depth};
+
+    const auto input = makeData(input_shape.FlatSize(), 1);
+    const auto filter = makeData(filter_shape.FlatSize(), 2);
+    const auto bias = makeData(c.output_depth, 3);
+    const auto operand = makeData(c.per_channel ? c.output_depth : output_shape.FlatSize(), 4);
+
+    nnfw::cker::ConvParams params;
+    params.padding_type = nnfw::cker::PaddingType::kValid;
+    params.padding_values.width = 0;
+    params.padding_values.height = 0;
+    params.stride_width = c.stride;
+    params.stride_height = c.stride;
+    params.dilation_width_factor = 1;
+    params.dilation_height_factor = 1;
+    params.float_activation_min = 0.f;
+    params.float_activation_max = 4.f;
+
+    std::vector<float> expected(output_shape.FlatSize());
+    nnfw::cker::reference::Conv(params, input_shape, input.data(), filter_shape, filter.data(),
+                                bias_shape, bias.data(), output_shape, expected.data());
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+      const float value = operand[c.per_channel ? i % c.output_depth : i];
+      const float result =
+          c.type == FusedEpilogueType::kAdd ? expected[i] + value : expected[i] * value;
+      expected[i] = std::min(std::max(result, -1.f), 1.f);
+    }
+
+    params.epilogue.type = c.type;
+    params.epilogue.operand_data = operand.data();
+    params.epilogue.per_channel = c.per_channel;
+    params.epilogue.float_activation_min = -1.f;
+    params.epilogue.float_activation_max = 1.f;
+
+    std::vector<float> actual(output_shape.FlatSize(), 100.f);
+    if (nnfw::cker::optimized::IsWinogradApplicable(filter_shape, c.stride, c.stride, 1, 1))
+    {
+      nnfw::cker::Conv kernel;
+      kernel(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape,
+             bias.data(), output_shape, actual.data());
+    }
+    else
+    {
+      // Multithreaded kernel takes the filter in [height * width * input_depth, output_depth]
+      const int filter_cols = filter_shape.FlatSize() / c.output_depth;
+      std::vector<float> transposed(filter.size());
+      for (int o = 0; o < c.output_depth; ++o)
+        for (int k = 0; k < filter_cols; ++k)
+          transposed[k * c.output_depth + o] = filter[o * filter_cols + k];
+      nnfw::cker::multithreaded::Conv(params, input_shape, input.data(), filter_shape,
+                                      transposed.data(), bias_shape, bias.data(), output_shape,
+                                      actual.data());
+    }
+    for (size_t i = 0; i < expected.size(); i++)
+      ASSERT_NEAR(actual[i], expected[i], 1e-4) << "kernel " << c.kernel_size << " at " << i;
+  }
+}
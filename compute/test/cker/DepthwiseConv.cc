@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/DepthwiseConv.h>
+#include <cker/operation/reference/DepthwiseConv.h>
+
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+
+using cker_test::makeData;
+
+struct DepthwiseConvCase
+{
+  int input_height;
+  int input_width;
+  int input_depth;
+  int filter_size_y;
+  int filter_size_x;
+  int stride;
+  int dilation;
+  int pad;
+  int depth_multiplier;
+  bool has_bias;
+};
+
+void verifyDepthwiseConv(const DepthwiseConvCase &c)
+{
+  const int batches = 2;
+  const int output_depth = c.input_depth * c.depth_multiplier;
+  const int effective_filter_y = (c.filter_size_y - 1) * c.dilation + 1;
+  const int effective_filter_x = (c.filter_size_x - 1) * c.dilation + 1;
+  const int output_height = (c.input_height + 2 * c.pad - effective_filter_y) / c.stride + 1;
+  const int output_width = (c.input_width + 2 * c.pad - effective_filter_x) / c.stride + 1;
+
+  nnfw::cker::Shape input_shape{batches, c.input_height, c.input_width, c.input_depth};
+  nnfw::cker::Shape filter_shape{1, c.filter_size_y, c.filter_size_x, output_depth};
+  nnfw::cker::Shape bias_shape{output_depth};
+  nnfw::cker::Shape output_shape{batches, output_height, output_width, output_depth};
+
+  const auto input = makeData(input_shape.FlatSize(), 1);
+  const auto filter = makeData(filter_shape.FlatSize(), 2);
+  const auto bias = makeData(output_depth, 3);
+  const float *bias_data = c.has_bias ? bias.data() : nullptr;
+
+  nnfw::cker::DepthwiseConvParams params;
+  params.stride_width = c.stride;
+  params.stride_height = c.stride;
+  params.dilation_width_factor = c.dilation;
+  params.dilation_height_factor = c.dilation;
+  params.padding_values.width = c.pad;
+  params.padding_values.height = c.pad;
+  params.depth_multiplier = c.depth_multiplier;
+  params.float_activation_min = -1.5f;
+  params.float_activation_max = 1.5f;
+
+  std::vector<float> expected(output_shape.FlatSize());
+  std::vector<float> actual(output_shape.FlatSize());
+  std::vector<float> actual_single(output_shape.FlatSize());
+  nnfw::cker::reference::DepthwiseConv(params, input_shape, input.data(), filter_shape,
+                                       filter.data(), bias_shape, bias_data, output_shape,
+                                       expected.data());
+  nnfw::cker::DepthwiseConv(params, input_shape, input.data(), filter_shape, filter.data(),
+                            bias_shape, bias_data, output_shape, actual.data());
+  nnfw::cker::optimized::DepthwiseConv(params, input_shape, input.data(), filter_shape,
+                                       filter.data(), bias_shape, bias_data, output_shape,
+                                       actual_single.data());
+
+  for (size_t i = 0; i < expected.size(); i++)
+  {
+    ASSERT_NEAR(actual[i], expected[i], 1e-5) << "at " << i;
+    ASSERT_NEAR(actual_single[i], expected[i], 1e-5) << "at " << i;
+  }
+}
+
+void verifyDepthwiseConv3x3Uint8(int input_height, int input_width, int depth, int stride,
+                                 int pad, int output_shift)
+{
+  const int batches = 2;
+  const int output_height = (input_height + 2 * pad - 3) / stride + 1;
+  const int output_width = (input_width + 2 * pad - 3) / stride + 1;
+
+  nnfw::cker::Shape input_shape{batches, input_height, input_width, depth};
+  nnfw::cker::Shape filter_shape{1, 3, 3, depth};
+  nnfw::cker::Shape bias_shape{depth};
+  nnfw::cker::Shape output_shape{batches, output_height, output_width, depth};
+
+  std::vector<uint8_t> input(input_shape.FlatSize());
+  std::vector<uint8_t> filter(filter_shape.FlatSize());
+  std::vector<int32_t> bias(depth);
+  uint32_t state = 7;
+  auto next = [&state]() {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+  };
+  for (auto &value : input)
+    value = next() & 0xff;
+  for (auto &value : filter)
+    value = next() & 0xff;
+  for (auto &value : bias)
+    value = static_cast<int32_t>(next() % 2001) - 1000;
+
+  nnfw::cker::DepthwiseConvParams params;
+  params.stride_width = stride;
+  params.stride_height = stride;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.padding_values.width = pad;
+  params.padding_values.height = pad;
+  params.depth_multiplier = 1;
+  params.input_offset = -127;
+  params.weights_offset = -133;
+  params.output_offset = 120;
+  params.output_multiplier = 1518500250;
+  params.output_shift = output_shift;
+  params.quantized_activation_min = 5;
+  params.quantized_activation_max = 250;
+
+  ASSERT_TRUE(nnfw::cker::optimized::Fast3x3FilterKernelSupported(
+      input_shape, filter_shape, stride, stride, 1, 1, pad, pad, 1, output_shape, output_shift));
+
+  std::vector<uint8_t> expected(output_shape.FlatSize());
+  std::vector<uint8_t> actual(output_shape.FlatSize());
+  nnfw::cker::optimized::DepthwiseConvGeneral(params, input_shape, input.data(), filter_shape,
+                                              filter.data(), bias_shape, bias.data(),
+                                              output_shape, expected.data());
+  nnfw::cker::DepthwiseConv(params, input_shape, input.data(), filter_shape, filter.data(),
+                            bias_shape, bias.data(), output_shape, actual.data());
+
+  for (size_t i = 0; i < expected.size(); i++)
+    ASSERT_EQ(actual[i], expected[i]) << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, DepthwiseConv3x3Uint8)
+{
+  verifyDepthwiseConv3x3Uint8(8, 8, 8, 1, 1, -9);
+  verifyDepthwiseConv3x3Uint8(9, 7, 24, 2, 1, -10);
+  verifyDepthwiseConv3x3Uint8(7, 10, 16, 1, 0, -8);
+  verifyDepthwiseConv3x3Uint8(11, 11, 32, 2, 0, -11);
+  verifyDepthwiseConv3x3Uint8(3, 3, 8, 1, 1, -9);
+}
+
+TEST(CKer_Operation, neg_DepthwiseConv3x3Uint8Unsupported)
+{
+  nnfw::cker::Shape input_shape{1, 8, 8, 8};
+  nnfw::cker::Shape filter_shape{1, 3, 3, 8};
+  nnfw::cker::Shape output_shape{1, 8, 8, 8};
+  // Stride 3, dilation 2, padding 2 and channels not divisible by 8 are not supported
+  EXPECT_FALSE(nnfw::cker::optimized::Fast3x3FilterKernelSupported(
+      input_shape, filter_shape, 3, 3, 1, 1, 1, 1, 1, output_shape, 0));
+  EXPECT_FALSE(nnfw::cker::optimized::Fast3x3FilterKernelSupported(
+      input_shape, filter_shape, 1, 1, 2, 2, 1, 1, 1, output_shape, 0));
+  EXPECT_FALSE(nnfw::cker::optimized::Fast3x3FilterKernelSupported(
+      input_shape, filter_shape, 1, 1, 1, 1, 2, 2, 1, output_shape, 0));
+  EXPECT_FALSE(nnfw::cker::optimized::Fast3x3FilterKernelSupported(
+      nnfw::cker::Shape{1, 8, 8, 12}, nnfw::cker::Shape{1, 3, 3, 12}, 1, 1, 1, 1, 1, 1, 1,
+      nnfw::cker::Shape{1, 8, 8, 12}, 0));
+}
+
+TEST(CKer_Operation, DepthwiseConvFloat)
+{
+  // input_h, input_w, depth, filter_y, filter_x, stride, dilation, pad, multiplier, bias
+  const DepthwiseConvCase cases[] = {
+      {8, 8, 16, 3, 3, 1, 1, 1, 1, true},   // 3x3 stride 1
+      {9, 7, 19, 3, 3, 2, 1, 1, 1, true},   // 3x3 stride 2 with channel tail
+      {10, 11, 8, 5, 5, 1, 1, 2, 1, false}, // 5x5 stride 1
+      {12, 12, 5, 5, 5, 2, 1, 2, 1, true},  // 5x5 stride 2
+      {6, 6, 3, 3, 3, 1, 1, 0, 1, true},    // no padding
+      {3, 3, 4, 5, 5, 1, 1, 2, 1, true},    // no interior column
+      {7, 9, 3, 3, 2, 1, 1, 1, 4, true},    // depth multiplier
+      {7, 9, 5, 3, 3, 2, 1, 1, 3, false},   // depth multiplier with tail
+      {9, 9, 6, 3, 3, 1, 2, 2, 1, true},    // dilation
+      {5, 8, 1, 1, 1, 1, 1, 0, 1, true},    // 1x1
+  };
+
+  for (const auto &c : cases)
+  {
+    verifyDepthwiseConv(c);
+  }
+}
+
+TEST(CKer_Operation, DepthwiseConvFloatLarge)
+{
+  // Large enough to be divided among threads
+  verifyDepthwiseConv({56, 56, 32, 3, 3, 1, 1, 1, 1, true});
+  verifyDepthwiseConv({57, 57, 32, 3, 3, 2, 1, 0, 1, true});
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Einsum.h>
+
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+#include <map>
+#include <vector>
+
+namespace
+{
+
+using cker_test::makeData;
+using nnfw::cker::Shape;
+
+// Sums the product of inputs over every assignment of the labels without ellipsis
+std::vector<float> naiveEinsum(const std::string &equation, const std::vector<Shape> &shapes,
+                               const std::vector<std::vector<float>> &inputs)
+{
+  const auto arrow = equation.find("->");
+  const std::string output_str = equation.substr(arrow + 2);
+  std::vector<std::string> input_strs;
+  const std::string lhs = equation.substr(0, arrow);
+  const auto comma = lhs.find(',');
+  input_strs.push_back(lhs.substr(0, comma));
+  if (comma != std::string::npos)
+    input_strs.push_back(lhs.substr(comma + 1));
+
+  std::map<char, int> sizes;
+  for (size_t i = 0; i < input_strs.size(); ++i)
+    for (size_t d = 0; d < input_strs[i].size(); ++d)
+      sizes[input_strs[i][d]] = shapes[i].Dims(d);
+  std::vector<char> labels;
+  for (const auto &size : sizes)
+    labels.push_back(size.first);
+
+  auto offset = [&](const std::string &subscript, const std::map<char, int> &value) {
+    int result = 0;
+    for (char c : subscript)
+      result = result * sizes[c] + value.at(c);
+    return result;
+  };
+
+  int output_size = 1;
+  for (char c : output_str)
+    output_size *= sizes[c];
+  std::vector<float> output(output_size, 0.f);
+  std::map<char, int> value;
+  for (char c : labels)
+    value[c] = 0;
+  while (true)
+  {
+    float product = 1.f;
+    for (size_t i = 0; i < inputs.size(); ++i)
+      product *= inputs[i][offset(input_strs[i], value)];
+    output[offset(output_str, value)] += product;
+
+    size_t l = 0;
+    for (; l < labels.size(); ++l)
+    {
+      if (++value[labels[l]] < sizes[labels[l]])
+        break;
+      value[labels[l]] = 0;
+    }
+    if (l == labels.size())
+      break;
+  }
+  return output;
+}
+
+} // namespace
+
+TEST(CKer_Operation, EinsumPlan)
+{
+  struct EinsumCase
+  {
+    std::string equation;
+    std::vector<Shape> shapes;
+  };
+  // equation, input shapes
+  const EinsumCase cases[] = {
+      {"ij,jk->ik", {Shape{5, 7}, Shape{7, 3}}},                   // plain matmul
+      {"bij,jk->bik", {Shape{4, 5, 7}, Shape{7, 3}}},              // batches share rhs
+      {"bij,bkj->bik", {Shape{9, 2, 6}, Shape{9, 3, 6}}},          // batches
+      {"BTNH,BFNH->BNFT", {Shape{2, 5, 3, 4}, Shape{2, 6, 3, 4}}}, // attention scores
+      {"BNFT,BTNH->BFNH", {Shape{2, 3, 6, 5}, Shape{2, 5, 3, 4}}}, // attention context
+      {"ijk,jl->il", {Shape{3, 4, 5}, Shape{4, 2}}},               // reduce
+      {"ijk->kj", {Shape{3, 4, 5}}},                               // reduce and transpose
+      {"ii->i", {Shape{4, 4}}},                                    // generic diagonal
+  };
+
+  for (const auto &c : cases)
+  {
+    std::string equation = c.equation;
+    std::vector<std::vector<float>> inputs;
+    std::vector<const float *> input_data;
+    for (size_t i = 0; i < c.shapes.size(); ++i)
+      inputs.push_back(makeData(c.shapes[i].FlatSize(), i));
+    for (const auto &input : inputs)
+      input_data.push_back(input.data());
+    const auto expected = naiveEinsum(equation, c.shapes, inputs);
+
+    nnfw::cker::Einsum einsum;
+    einsum.prepare(equation, c.shapes);
+    std::vector<float> output(expected.size());
+    // Second run reuses the plan of the first one
+    for (int run = 0; run < 2; ++run)
+    {
+      std::fill(output.begin(), output.end(), -1.f);
+      einsum(equation, c.shapes, input_data, Shape{static_cast<int>(output.size())},
+             output.data());
+      for (size_t i = 0; i < expected.size(); ++i)
+        ASSERT_NEAR(output[i], expected[i], 1e-4) << equation << " at " << i;
+    }
+  }
+}
+
+TEST(CKer_Operation, EinsumPlanShapeChange)
+{
+  std::string equation = "bij,bjk->bik";
+  nnfw::cker::Einsum einsum;
+  for (int batch : {1, 3, 16})
+  {
+    const std::vector<Shape> shapes{Shape{batch, 4, 6}, Shape{batch, 6, 5}};
+    std::vector<std::vector<float>> inputs{makeData(shapes[0].FlatSize(), 1),
+                                           makeData(shapes[1].FlatSize(), 2)};
+    const auto expected = naiveEinsum(equation, shapes, inputs);
+    std::vector<float> output(expected.size());
+    einsum(equation, shapes, {inputs[0].data(), inputs[1].data()},
+           Shape{static_cast<int>(output.size())}, output.data());
+    for (size_t i = 0; i < expected.size(); ++i)
+      ASSERT_NEAR(output[i], expected[i], 1e-4) << "batch " << batch << " at " << i;
+  }
+}
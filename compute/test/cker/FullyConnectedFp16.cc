@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FullyConnectedFp16.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(CKer_Operation, Fp16Conversion)
+{
+  // Exactly representable values, rounding to nearest even and odd length for remaining part
+  const std::vector<float> input{0.f, -0.f, 1.f, -2.5f, 65504.f, 0.000061035156f, 1.f + 1.f / 2048,
+                                 1.f + 3.f / 2048, 0.333251953125f};
+  const std::vector<uint16_t> expected{0x0000, 0x8000, 0x3c00, 0xc100, 0x7bff,
+                                       0x0400, 0x3c00, 0x3c02, 0x3555};
+
+  std::vector<uint16_t> half(input.size());
+  nnfw::cker::FloatToFp16(input.data(), input.size(), half.data());
+  EXPECT_EQ(half, expected);
+
+  std::vector<float> widened(half.size());
+  nnfw::cker::Fp16ToFloat(half.data(), half.size(), widened.data());
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    EXPECT_NEAR(widened[i], input[i], std::abs(input[i]) / 1024);
+  }
+}
+
+TEST(CKer_Operation, FullyConnectedFp16Weights)
+{
+  // More rows than a widened block so that weights are widened block by block
+  const int input_size = 3000;
+  const int num_units = 13;
+  const int batch_size = 2;
+  ASSERT_LT(nnfw::cker::FullyConnectedFp16WidenedRows(nnfw::cker::Shape{num_units, input_size}),
+            num_units);
+
+  std::vector<float> input(batch_size * input_size);
+  std::vector<float> weights(num_units * input_size);
+  std::vector<float> bias(num_units);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(static_cast<int>(i % 17) - 8) / 8;
+  // Weights exactly representable in half precision
+  for (size_t i = 0; i < weights.size(); ++i)
+    weights[i] = static_cast<float>(static_cast<int>(i % 29) - 14) / 64;
+  for (int i = 0; i < num_units; ++i)
+    bias[i] = i - 6.f;
+
+  nnfw::cker::Shape weights_shape{num_units, input_size};
+  std::vector<uint16_t> half_weights(weights.size());
+  nnfw::cker::FloatToFp16(weights.data(), weights.size(), half_weights.data());
+  std::vector<float> widened(nnfw::cker::FullyConnectedFp16WidenedRows(weights_shape) *
+                             input_size);
+
+  nnfw::cker::FullyConnectedParams params;
+  params.float_activation_min = 0.f;
+  params.float_activation_max = 100.f;
+
+  std::vector<float> output(batch_size * num_units);
+  nnfw::cker::FullyConnectedFp16Weights(
+      params, nnfw::cker::Shape{batch_size, input_size}, input.data(), weights_shape,
+      half_weights.data(), nnfw::cker::Shape{num_units}, bias.data(),
+      nnfw::cker::Shape{batch_size, num_units}, output.data(), widened.data());
+
+  for (int b = 0; b < batch_size; ++b)
+  {
+    for (int u = 0; u < num_units; ++u)
+    {
+      float expected = bias[u];
+      for (int i = 0; i < input_size; ++i)
+        expected += input[b * input_size + i] * weights[u * input_size + i];
+      expected = std::min(100.f, std::max(0.f, expected));
+      EXPECT_NEAR(output[b * num_units + u], expected, 1e-3f);
+    }
+  }
+}
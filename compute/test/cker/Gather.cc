@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Gather.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+// Table of [outer, rows, width] with value outer * 10000 + row * 100 + column
+std::vector<float> makeTable(int outer, int rows, int width)
+{
+  std::vector<float> table(outer * rows * width);
+  for (int o = 0; o < outer; ++o)
+    for (int r = 0; r < rows; ++r)
+      for (int c = 0; c < width; ++c)
+        table[(o * rows + r) * width + c] = o * 10000 + r * 100 + c;
+  return table;
+}
+
+std::vector<int64_t> makeIndices(int count, int rows)
+{
+  std::vector<int64_t> indices(count);
+  for (int i = 0; i < count; ++i)
+    indices[i] = (i * 7919) % rows;
+  return indices;
+}
+
+} // namespace
+
+TEST(CKer_Operation, Gather)
+{
+  const int outer = 3, rows = 50, width = 33, count = 100;
+  const auto table = makeTable(outer, rows, width);
+  const auto indices = makeIndices(count, rows);
+
+  nnfw::cker::GatherParams params;
+  params.axis = -2;
+  const Shape input_shape{outer, rows, width};
+  const Shape indices_shape{count};
+  const Shape output_shape{outer, count, width};
+  std::vector<float> output(output_shape.FlatSize());
+  nnfw::cker::Gather(params, input_shape, table.data(), indices_shape, indices.data(),
+                     output_shape, output.data());
+
+  for (int o = 0; o < outer; ++o)
+    for (int i = 0; i < count; ++i)
+      for (int c = 0; c < width; ++c)
+        ASSERT_EQ(output[(o * count + i) * width + c], o * 10000 + indices[i] * 100 + c);
+}
+
+TEST(CKer_Operation, GatherDequantize)
+{
+  const int rows = 40, width = 24, count = 64;
+  const auto indices = makeIndices(count, rows);
+  nnfw::cker::GatherParams params;
+  params.axis = 0;
+  const Shape input_shape{rows, width};
+  const Shape indices_shape{count};
+  const Shape output_shape{count, width};
+
+  std::vector<uint8_t> quantized(rows * width);
+  for (size_t i = 0; i < quantized.size(); ++i)
+    quantized[i] = static_cast<uint8_t>(i * 13);
+  std::vector<float> output(output_shape.FlatSize());
+  nnfw::cker::GatherDequantize(params, input_shape, quantized.data(), 0.25f, 128, indices_shape,
+                               indices.data(), output_shape, output.data());
+  for (int i = 0; i < count; ++i)
+    for (int c = 0; c < width; ++c)
+      ASSERT_EQ(output[i * width + c], 0.25f * (quantized[indices[i] * width + c] - 128));
+
+  // Table values are exact in half precision
+  std::vector<float> table(rows * width);
+  for (size_t i = 0; i < table.size(); ++i)
+    table[i] = i * 0.5f - 100.f;
+  std::vector<uint16_t> half(table.size());
+  nnfw::cker::FloatToFp16(table.data(), table.size(), half.data());
+  nnfw::cker::GatherFp16(params, input_shape, half.data(), indices_shape, indices.data(),
+                         output_shape, output.data());
+  for (int i = 0; i < count; ++i)
+    for (int c = 0; c < width; ++c)
+      ASSERT_EQ(output[i * width + c], table[indices[i] * width + c]);
+}
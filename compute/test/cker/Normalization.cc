@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/InstanceNorm.h>
+#include <cker/operation/LocalResponseNormalization.h>
+#include <cker/operation/PReLU.h>
+
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+using cker_test::makeData;
+using nnfw::cker::Shape;
+
+} // namespace
+
+TEST(CKer_Operation, InstanceNorm)
+{
+  // batches, height, width, channels
+  const std::vector<std::vector<int>> cases = {
+      {1, 4, 5, 3},   // few channels
+      {2, 6, 7, 16},  // batches
+      {1, 40, 30, 8}, // pixels over several blocks
+  };
+
+  for (const auto &dims : cases)
+  {
+    const Shape shape{dims[0], dims[1], dims[2], dims[3]};
+    const int channels = dims[3];
+    const int size = dims[1] * dims[2];
+    const auto input = makeData(shape.FlatSize(), 1);
+    const auto gamma = makeData(channels, 2);
+    const auto beta = makeData(channels, 3);
+
+    nnfw::cker::InstanceNormParams params;
+    params.epsilon = 1e-5f;
+    params.float_activation_min = -1.f;
+    params.float_activation_max = 3.f;
+    std::vector<float> output(input.size());
+    nnfw::cker::InstanceNorm(params, shape, input.data(), Shape{channels}, gamma.data(),
+                             Shape{channels}, beta.data(), shape, output.data());
+
+    for (int b = 0; b < dims[0]; ++b)
+    {
+      for (int c = 0; c < channels; ++c)
+      {
+        double mean = 0.0;
+        for (int p = 0; p < size; ++p)
+          mean += input[(b * size + p) * channels + c];
+        mean /= size;
+        double var = 0.0;
+        for (int p = 0; p < size; ++p)
+        {
+          const double diff = input[(b * size + p) * channels + c] - mean;
+          var += diff * diff;
+        }
+        var /= size;
+        for (int p = 0; p < size; ++p)
+        {
+          const int offset = (b * size + p) * channels + c;
+          const double value =
+              (input[offset] - mean) / std::sqrt(var + params.epsilon) * gamma[c] + beta[c];
+          const float expected = std::min(std::max(static_cast<float>(value), -1.f), 3.f);
+          ASSERT_NEAR(output[offset], expected, 1e-4f) << "at " << offset;
+        }
+      }
+    }
+  }
+}
+
+TEST(CKer_Operation, PReLU)
+{
+  struct PReLUCase
+  {
+    Shape input_shape;
+    Shape alpha_shape;
+  };
+  const PReLUCase cases[] = {
+      {Shape{1, 4, 5, 12}, Shape{1, 1, 12}},  // per channel
+      {Shape{2, 3, 3, 2}, Shape{2}},          // per channel of few channels
+      {Shape{1, 3, 4, 6}, Shape{1, 3, 4, 6}}, // same shape
+      {Shape{2, 3, 4, 5}, Shape{3, 1, 1}},    // broadcast over other dimensions
+  };
+
+  for (const auto &c : cases)
+  {
+    const auto input = makeData(c.input_shape.FlatSize(), 1);
+    const auto alpha = makeData(c.alpha_shape.FlatSize(), 2);
+    std::vector<float> output(input.size());
+    nnfw::cker::PReLU(c.input_shape, input.data(), c.alpha_shape, alpha.data(), c.input_shape,
+                      output.data());
+
+    const Shape output_shape = Shape::ExtendedShape(4, c.input_shape);
+    const Shape alpha_shape = Shape::ExtendedShape(4, c.alpha_shape);
+    for (int i = 0; i < output_shape.FlatSize(); ++i)
+    {
+      // Index of output in each dimension, which is 0 in dimensions of alpha of size 1
+      int alpha_offset = 0;
+      int rest = i;
+      int alpha_stride = 1;
+      for (int d = 3; d >= 0; --d)
+      {
+        const int index = rest % output_shape.Dims(d);
+        rest /= output_shape.Dims(d);
+        if (alpha_shape.Dims(d) != 1)
+          alpha_offset += index * alpha_stride;
+        alpha_stride *= alpha_shape.Dims(d);
+      }
+      const float expected = input[i] >= 0.f ? input[i] : input[i] * alpha[alpha_offset];
+      ASSERT_FLOAT_EQ(output[i], expected) << "at " << i;
+    }
+  }
+}
+
+TEST(CKer_Operation, LocalResponseNormalization)
+{
+  // range, bias, alpha, beta
+  const std::vector<std::vector<double>> params_list = {
+      {2, 1.0, 1e-4, 0.75}, // AlexNet
+      {1, 2.0, 0.5, 0.5},
+      {5, 1.0, 0.1, 0.6}, // window wider than depth
+  };
+  const Shape shape{1, 3, 4, 7};
+  const int depth = 7;
+  const auto input = makeData(shape.FlatSize(), 1);
+
+  for (const auto &p : params_list)
+  {
+    nnfw::cker::LocalResponseNormalizationParams params;
+    params.range = static_cast<int32_t>(p[0]);
+    params.bias = p[1];
+    params.alpha = p[2];
+    params.beta = p[3];
+    std::vector<float> output(input.size());
+    nnfw::cker::LocalResponseNormalization(params, shape, input.data(), shape, output.data());
+
+    for (int i = 0; i < shape.FlatSize(); ++i)
+    {
+      const int row = i / depth;
+      const int c = i % depth;
+      double sum = 0.0;
+      for (int k = std::max(c - params.range, 0); k <= std::min(c + params.range, depth - 1); ++k)
+        sum += input[row * depth + k] * input[row * depth + k];
+      const double expected = input[i] * std::pow(params.bias + params.alpha * sum, -params.beta);
+      ASSERT_NEAR(output[i], expected, 1e-5) << "range " << params.range << " at " << i;
+    }
+  }
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/ArgMinMax.h>
+#include <cker/operation/ReduceMean.h>
+
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+#include <functional>
+#include <vector>
+
+namespace
+{
+
+using cker_test::makeData;
+using nnfw::cker::Shape;
+
+struct ReduceCase
+{
+  Shape input_shape;
+  std::vector<int> axes;
+};
+
+// input_shape, axes
+const ReduceCase kCases[] = {
+    {Shape{4, 37}, {1}},            // row
+    {Shape{37, 300}, {0}},          // column wider than a block
+    {Shape{2, 7, 7, 64}, {1, 2}},   // global average pooling
+    {Shape{3, 5, 1, 6}, {1, 2}},    // reduced axis of size 1
+    {Shape{3, 4, 5}, {0, 2}},       // not contiguous
+    {Shape{2, 3, 4}, {-1, 0, 1}},   // all axes
+};
+
+Shape reducedShape(const Shape &input_shape, const int *axis, int num_axis)
+{
+  Shape output_shape(input_shape.DimensionsCount());
+  for (int i = 0; i < input_shape.DimensionsCount(); ++i)
+  {
+    const bool reduced = std::find(axis, axis + num_axis, i) != axis + num_axis;
+    output_shape.SetDim(i, reduced ? 1 : input_shape.Dims(i));
+  }
+  return output_shape;
+}
+
+} // namespace
+
+TEST(CKer_Operation, ReduceContiguous)
+{
+  for (const auto &c : kCases)
+  {
+    const auto input = makeData(c.input_shape.FlatSize(), 1);
+    int axis[4];
+    int num_axis = 0;
+    nnfw::cker::ResolveAxis(c.input_shape.DimensionsCount(), c.axes, axis, &num_axis);
+    const Shape output_shape = reducedShape(c.input_shape, axis, num_axis);
+    const int output_size = output_shape.FlatSize();
+
+    // Sequential generic reduction is the reference
+    auto sum = [](const float current, const float in) -> float { return current + in; };
+    auto max = [](const float current, const float in) -> float {
+      return in > current ? in : current;
+    };
+    std::vector<int> input_iter(c.input_shape.DimensionsCount());
+    std::vector<float> expected_sum(output_size, 0.f);
+    nnfw::cker::ReduceImpl<float, float>(input.data(), c.input_shape, output_shape, axis, num_axis,
+                                         input_iter.data(), sum, expected_sum.data());
+    std::vector<float> expected_max(output_size, std::numeric_limits<float>::lowest());
+    nnfw::cker::ReduceImpl<float, float>(input.data(), c.input_shape, output_shape, axis, num_axis,
+                                         input_iter.data(), max, expected_max.data());
+
+    nnfw::cker::Reduce reduce_kernel;
+    reduce_kernel.prepare(c.input_shape.DimensionsCount(), c.axes.size());
+    std::vector<float> actual_sum(output_size);
+    ASSERT_TRUE(reduce_kernel.ReduceGeneric<float>(c.input_shape, input.data(), output_shape,
+                                                   actual_sum.data(), c.axes, true, 0.f, sum));
+    std::vector<float> actual_max(output_size);
+    ASSERT_TRUE(reduce_kernel.ReduceGeneric<float>(c.input_shape, input.data(), output_shape,
+                                                   actual_max.data(), c.axes, true,
+                                                   std::numeric_limits<float>::lowest(), max));
+
+    std::vector<float> actual_mean(output_size);
+    nnfw::cker::Mean(c.input_shape, input.data(), output_shape, actual_mean.data(), c.axes);
+    const float normalizer = static_cast<float>(c.input_shape.FlatSize()) / output_size;
+
+    for (int i = 0; i < output_size; ++i)
+    {
+      ASSERT_NEAR(actual_sum[i], expected_sum[i], 1e-4) << "at " << i;
+      ASSERT_EQ(actual_max[i], expected_max[i]) << "at " << i;
+      ASSERT_NEAR(actual_mean[i], expected_sum[i] / normalizer, 1e-5) << "at " << i;
+    }
+  }
+}
+
+TEST(CKer_Operation, MeanQuant8Contiguous)
+{
+  const Shape input_shape{2, 5, 5, 19};
+  const Shape output_shape{2, 1, 1, 19};
+  std::vector<uint8_t> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<uint8_t>((i * 37) % 256);
+
+  std::vector<uint8_t> output(output_shape.FlatSize());
+  nnfw::cker::MeanQ8Asymm(input_shape, input.data(), 0.5f, 10, output_shape, output.data(), 0.5f,
+                          10, {1, 2});
+  for (int b = 0; b < 2; ++b)
+  {
+    for (int c = 0; c < 19; ++c)
+    {
+      int sum = 0;
+      for (int p = 0; p < 25; ++p)
+        sum += input[(b * 25 + p) * 19 + c];
+      EXPECT_NEAR(output[b * 19 + c], sum / 25.f, 0.51f);
+    }
+  }
+}
+
+TEST(CKer_Operation, ArgMinMax)
+{
+  // Innermost axis is searched by rows, and outer axes by columns
+  const Shape input_shape{3, 21, 300};
+  // Ties and NaN should keep the first index as the sequential search
+  auto input = makeData(input_shape.FlatSize(), 2);
+  input[5 * 300 + 7] = input[9 * 300 + 7] = 2.f;
+  input[3] = std::nanf("");
+
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    int outer_size = 1, inner_size = 1;
+    for (int i = 0; i < axis; ++i)
+      outer_size *= input_shape.Dims(i);
+    for (int i = axis + 1; i < 3; ++i)
+      inner_size *= input_shape.Dims(i);
+    const int axis_size = input_shape.Dims(axis);
+    Shape output_shape(2);
+    for (int i = 0, o = 0; i < 3; ++i)
+    {
+      if (i != axis)
+        output_shape.SetDim(o++, input_shape.Dims(i));
+    }
+
+    std::vector<int32_t> argmax(outer_size * inner_size);
+    nnfw::cker::ArgMinMax(input_shape, input.data(), output_shape, argmax.data(), axis,
+                          std::greater<float>());
+    std::vector<int64_t> argmin(outer_size * inner_size);
+    nnfw::cker::ArgMinMax(input_shape, input.data(), output_shape, argmin.data(), axis,
+                          std::less<float>());
+
+    for (int outer = 0; outer < outer_size; ++outer)
+    {
+      for (int inner = 0; inner < inner_size; ++inner)
+      {
+        auto at = [&](int a) { return input[(outer * axis_size + a) * inner_size + inner]; };
+        int expected_max = 0, expected_min = 0;
+        for (int a = 1; a < axis_size; ++a)
+        {
+          if (at(a) > at(expected_max))
+            expected_max = a;
+          if (at(a) < at(expected_min))
+            expected_min = a;
+        }
+        ASSERT_EQ(argmax[outer * inner_size + inner], expected_max);
+        ASSERT_EQ(argmin[outer * inner_size + inner], expected_min);
+      }
+    }
+  }
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/ResizeBilinear.h>
+#include <cker/operation/ResizeNearestNeighbor.h>
+
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+using cker_test::makeData;
+using nnfw::cker::Shape;
+
+struct ResizeCase
+{
+  int batches, input_height, input_width, depth, output_height, output_width;
+  bool align_corners, half_pixel_centers;
+};
+
+// batches, input size, depth, output size, align_corners, half_pixel_centers
+const ResizeCase kCases[] = {
+    {1, 3, 4, 1, 6, 8, false, false},  // 2x upsampling of one channel
+    {2, 4, 4, 5, 8, 8, false, true},   // 2x upsampling with half pixel centers
+    {1, 5, 3, 8, 9, 7, true, false},   // align corners
+    {1, 7, 9, 6, 3, 4, false, false},  // downsampling
+    {2, 6, 5, 3, 13, 11, false, true}, // fractional upsampling
+    {1, 1, 1, 4, 3, 2, false, false},  // single pixel
+    {1, 4, 6, 16, 4, 6, false, false}, // same size
+};
+
+float scale(int input_size, int output_size, bool align_corners)
+{
+  return (align_corners && output_size > 1) ? (input_size - 1) / static_cast<float>(output_size - 1)
+                                            : input_size / static_cast<float>(output_size);
+}
+
+// Interpolates each output value from four input values as TensorFlow Lite reference
+std::vector<float> naiveResizeBilinear(const ResizeCase &c, const std::vector<float> &input)
+{
+  const float height_scale = scale(c.input_height, c.output_height, c.align_corners);
+  const float width_scale = scale(c.input_width, c.output_width, c.align_corners);
+  auto at = [&](int b, int y, int x, int d) {
+    return input[((b * c.input_height + y) * c.input_width + x) * c.depth + d];
+  };
+  std::vector<float> output;
+  for (int b = 0; b < c.batches; ++b)
+  {
+    for (int y = 0; y < c.output_height; ++y)
+    {
+      const float in_y =
+          c.half_pixel_centers ? (y + 0.5f) * height_scale - 0.5f : y * height_scale;
+      const int y0 = std::max(static_cast<int>(std::floor(in_y)), 0);
+      const int y1 = std::min(static_cast<int>(std::ceil(in_y)), c.input_height - 1);
+      for (int x = 0; x < c.output_width; ++x)
+      {
+        const float in_x =
+            c.half_pixel_centers ? (x + 0.5f) * width_scale - 0.5f : x * width_scale;
+        const int x0 = std::max(static_cast<int>(std::floor(in_x)), 0);
+        const int x1 = std::min(static_cast<int>(std::ceil(in_x)), c.input_width - 1);
+        const float dy = in_y - std::floor(in_y);
+        const float dx = in_x - std::floor(in_x);
+        for (int d = 0; d < c.depth; ++d)
+        {
+          output.push_back(at(b, y0, x0, d) * (1 - dy) * (1 - dx) +
+                           at(b, y1, x0, d) * dy * (1 - dx) + at(b, y0, x1, d) * (1 - dy) * dx +
+                           at(b, y1, x1, d) * dy * dx);
+        }
+      }
+    }
+  }
+  return output;
+}
+
+int nearest(int i, int input_size, int output_size, bool align_corners, bool half_pixel_centers)
+{
+  const float in = (i + (half_pixel_centers ? 0.5f : 0.0f)) *
+                   scale(input_size, output_size, align_corners);
+  int index = std::min(align_corners ? static_cast<int>(std::round(in))
+                                     : static_cast<int>(std::floor(in)),
+                       input_size - 1);
+  return half_pixel_centers ? std::max(index, 0) : index;
+}
+
+template <typename T>
+std::vector<T> naiveResizeNearestNeighbor(const ResizeCase &c, const std::vector<T> &input)
+{
+  std::vector<T> output;
+  for (int b = 0; b < c.batches; ++b)
+  {
+    for (int y = 0; y < c.output_height; ++y)
+    {
+      const int in_y = nearest(y, c.input_height, c.output_height, c.align_corners,
+                               c.half_pixel_centers);
+      for (int x = 0; x < c.output_width; ++x)
+      {
+        const int in_x =
+            nearest(x, c.input_width, c.output_width, c.align_corners, c.half_pixel_centers);
+        const int offset = ((b * c.input_height + in_y) * c.input_width + in_x) * c.depth;
+        for (int d = 0; d < c.depth; ++d)
+          output.push_back(input[offset + d]);
+      }
+    }
+  }
+  return output;
+}
+
+template <typename T> void runBilinearCases(float tolerance)
+{
+  nnfw::cker::ResizeBilinear kernel;
+  for (const auto &c : kCases)
+  {
+    const Shape input_shape{c.batches, c.input_height, c.input_width, c.depth};
+    const Shape output_shape{c.batches, c.output_height, c.output_width, c.depth};
+    const nnfw::cker::ResizeBilinearParams params{c.output_height, c.output_width, c.align_corners,
+                                                  c.half_pixel_centers};
+    const auto input = makeData<T>(input_shape.FlatSize(), 1);
+    const auto expected =
+        naiveResizeBilinear(c, std::vector<float>(input.begin(), input.end()));
+    std::vector<T> output(output_shape.FlatSize());
+    kernel(params, input_shape, input.data(), output_shape, output.data());
+    for (size_t i = 0; i < expected.size(); ++i)
+      ASSERT_NEAR(output[i], expected[i], tolerance) << "depth " << c.depth << " at " << i;
+  }
+}
+
+template <typename T> void runNearestNeighborCases()
+{
+  nnfw::cker::ResizeNearestNeighbor kernel;
+  for (const auto &c : kCases)
+  {
+    const Shape input_shape{c.batches, c.input_height, c.input_width, c.depth};
+    const Shape output_shape{c.batches, c.output_height, c.output_width, c.depth};
+    const nnfw::cker::ResizeNearestNeighborParams params{c.output_height, c.output_width,
+                                                         c.align_corners, c.half_pixel_centers};
+    const auto input = makeData<T>(input_shape.FlatSize(), 1);
+    const auto expected = naiveResizeNearestNeighbor(c, input);
+    std::vector<T> output(output_shape.FlatSize());
+    kernel(params, input_shape, input.data(), output_shape, output.data());
+    for (size_t i = 0; i < expected.size(); ++i)
+      ASSERT_EQ(output[i], expected[i]) << "depth " << c.depth << " at " << i;
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, ResizeBilinear)
+{
+  runBilinearCases<float>(1e-4f);
+  // Quantized values are interpolated in fixed point and rounded
+  runBilinearCases<uint8_t>(1.0f);
+  runBilinearCases<int8_t>(1.0f);
+}
+
+TEST(CKer_Operation, ResizeNearestNeighbor)
+{
+  runNearestNeighborCases<float>();
+  runNearestNeighborCases<uint8_t>();
+  runNearestNeighborCases<int8_t>();
+  runNearestNeighborCases<int32_t>();
+}
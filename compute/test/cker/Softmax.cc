@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/LookupTable.h>
+#include <cker/operation/SoftMax.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+TEST(CKer_Operation, LookupTable)
+{
+  uint8_t table[256];
+  nnfw::cker::PopulateLookupTable<uint8_t>(0.1f, 128, 1.f / 256, 0,
+                                           [](float x) { return 1.f / (1.f + std::exp(-x)); },
+                                           table);
+
+  // Odd length covers both vectorized and remaining parts
+  std::vector<uint8_t> input(77);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<uint8_t>(i * 37 + 11);
+  std::vector<uint8_t> output(input.size());
+  nnfw::cker::LookupTable(input.data(), input.size(), table, output.data());
+
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    const float expected = 1.f / (1.f + std::exp(-0.1f * (input[i] - 128)));
+    EXPECT_EQ(output[i], table[input[i]]);
+    EXPECT_NEAR(output[i], std::min(255.f, std::round(expected * 256)), 1.f);
+  }
+
+  // int8 values are looked up by their bit patterns
+  int8_t int8_table[256];
+  nnfw::cker::PopulateLookupTable<int8_t>(0.05f, 0, 1.f / 128, 0,
+                                          [](float x) { return std::tanh(x); }, int8_table);
+  const std::vector<int8_t> int8_input{-128, -1, 0, 1, 127};
+  std::vector<int8_t> int8_output(int8_input.size());
+  nnfw::cker::LookupTable(int8_input.data(), int8_input.size(), int8_table, int8_output.data());
+  for (size_t i = 0; i < int8_input.size(); ++i)
+  {
+    const float expected = std::round(std::tanh(0.05f * int8_input[i]) * 128);
+    EXPECT_EQ(int8_output[i], static_cast<int8_t>(std::min(127.f, expected)));
+  }
+}
+
+TEST(CKer_Operation, SoftmaxQuant8)
+{
+  const float input_scale = 0.07f;
+  const float beta = 1.3f;
+  // Any rank is accepted, and softmax is taken along the last dimension
+  nnfw::cker::Shape shape{2, 3, 10};
+
+  std::vector<uint8_t> input(shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<uint8_t>((i * 53 + 7) % 256);
+
+  float table[256];
+  nnfw::cker::SoftmaxParams params;
+  params.table = table;
+  params.scale = 1.f / 256;
+  params.zero_point = 0;
+  nnfw::cker::PopulateSoftmaxLookupTable(&params, input_scale, beta);
+
+  std::vector<uint8_t> output(input.size());
+  nnfw::cker::Softmax(params, shape, input.data(), shape, output.data());
+
+  const int depth = shape.Dims(2);
+  for (int row = 0; row < shape.FlatSize() / depth; ++row)
+  {
+    const uint8_t *in = input.data() + row * depth;
+    float sum = 0.f;
+    for (int c = 0; c < depth; ++c)
+      sum += std::exp(beta * input_scale * in[c]);
+    for (int c = 0; c < depth; ++c)
+    {
+      const float expected = std::exp(beta * input_scale * in[c]) / sum;
+      EXPECT_NEAR(output[row * depth + c], std::min(255.f, std::round(expected * 256)), 1.f);
+    }
+  }
+}
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Pack.h>
+#include <cker/operation/Pad.h>
+#include <cker/operation/Slice.h>
+#include <cker/operation/StridedSlice.h>
+#include <cker/operation/Tile.h>
+#include <cker/operation/Unpack.h>
+
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+
+using cker_test::makeData;
+using nnfw::cker::Shape;
+
+// Row-major offset of index in dims
+int offsetOf(const std::vector<int> &dims, const std::vector<int> &index)
+{
+  int offset = 0;
+  for (size_t i = 0; i < dims.size(); ++i)
+    offset = offset * dims[i] + index[i];
+  return offset;
+}
+
+// Calls fn with each index of dims in row-major order
+template <typename Fn> void forEachIndex(const std::vector<int> &dims, Fn fn)
+{
+  for (int d : dims)
+  {
+    if (d == 0)
+      return;
+  }
+  std::vector<int> index(dims.size(), 0);
+  while (true)
+  {
+    fn(index);
+    int i = dims.size() - 1;
+    for (; i >= 0; --i)
+    {
+      if (++index[i] < dims[i])
+        break;
+      index[i] = 0;
+    }
+    if (i < 0)
+      return;
+  }
+}
+
+Shape toShape(const std::vector<int> &dims)
+{
+  Shape shape(dims.size());
+  for (size_t i = 0; i < dims.size(); ++i)
+    shape.SetDim(i, dims[i]);
+  return shape;
+}
+
+} // namespace
+
+TEST(CKer_Operation, StridedSliceCopy)
+{
+  struct StridedSliceCase
+  {
+    std::vector<int> dims, begin, end, strides;
+  };
+  // input dims, begin, end, strides
+  const StridedSliceCase cases[] = {
+      {{2, 6, 5, 8}, {0, 1, 0, 0}, {2, 5, 5, 8}, {1, 1, 1, 1}},         // contiguous rows
+      {{2, 6, 5, 8}, {1, 5, 4, 7}, {-3, -7, -6, -9}, {-1, -2, -1, -3}}, // negative strides
+      {{3, 7, 9}, {0, 1, 2}, {3, 7, 9}, {2, 3, 2}},                     // positive strides
+      {{40}, {39}, {-41}, {-1}},                                        // reverse
+  };
+
+  for (const auto &c : cases)
+  {
+    const int rank = c.dims.size();
+    const auto op_params = nnfw::cker::buildStridedSliceParams(
+        c.begin.data(), c.end.data(), c.strides.data(), 0, 0, 0, rank);
+    std::vector<int> output_dims(rank);
+    for (int i = 0; i < rank; ++i)
+    {
+      const int start = c.begin[i] < 0 ? c.begin[i] + c.dims[i] : c.begin[i];
+      int stop = c.end[i] < 0 ? c.end[i] + c.dims[i] : c.end[i];
+      stop = std::max(stop, -1);
+      const int length = c.strides[i] > 0 ? stop - start : start - stop;
+      const int step = std::abs(c.strides[i]);
+      output_dims[i] = (length + step - 1) / step;
+    }
+
+    const auto input = makeData<float>(toShape(c.dims).FlatSize(), 1);
+    std::vector<float> expected;
+    forEachIndex(output_dims, [&](const std::vector<int> &index) {
+      std::vector<int> in_index(rank);
+      for (int i = 0; i < rank; ++i)
+      {
+        const int start = c.begin[i] < 0 ? c.begin[i] + c.dims[i] : c.begin[i];
+        in_index[i] = start + index[i] * c.strides[i];
+      }
+      expected.push_back(input[offsetOf(c.dims, in_index)]);
+    });
+
+    std::vector<float> output(expected.size());
+    nnfw::cker::StridedSlice(op_params, toShape(c.dims), input.data(), toShape(output_dims),
+                             output.data());
+    for (size_t i = 0; i < expected.size(); ++i)
+      ASSERT_EQ(output[i], expected[i]) << "rank " << rank << " at " << i;
+  }
+}
+
+TEST(CKer_Operation, SliceCopy)
+{
+  const std::vector<int> dims{2, 5, 7, 6};
+  const std::vector<int> begin{1, 1, 2, 0};
+  const std::vector<int> size{1, 3, -1, 6};
+  const std::vector<int> output_dims{1, 3, 5, 6};
+
+  nnfw::cker::SliceParams op_params;
+  op_params.begin_count = 4;
+  op_params.size_count = 4;
+  for (int i = 0; i < 4; ++i)
+  {
+    op_params.begin[i] = begin[i];
+    op_params.size[i] = size[i];
+  }
+
+  const auto input = makeData<uint8_t>(toShape(dims).FlatSize(), 1);
+  std::vector<uint8_t> expected;
+  forEachIndex(output_dims, [&](const std::vector<int> &index) {
+    std::vector<int> in_index(4);
+    for (int i = 0; i < 4; ++i)
+      in_index[i] = begin[i] + index[i];
+    expected.push_back(input[offsetOf(dims, in_index)]);
+  });
+
+  std::vector<uint8_t> output(expected.size());
+  nnfw::cker::Slice(op_params, toShape(dims), input.data(), output.data());
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_EQ(output[i], expected[i]) << "at " << i;
+}
+
+TEST(CKer_Operation, PadCopy)
+{
+  struct PadCase
+  {
+    std::vector<int> dims;
+    std::vector<int32_t> paddings;
+    float value;
+  };
+  // input dims, paddings, constant value
+  const PadCase cases[] = {
+      {{7}, {2, 3}, 0.f},
+      {{4, 5}, {1, 0, 2, 2}, -1.5f},
+      {{3, 4, 5}, {0, 0, 1, 1, 0, 0}, 0.f},             // padding of one dimension only
+      {{2, 3, 4, 5}, {1, 1, 0, 2, 3, 0, 1, 1}, 2.f},    // every dimension
+      {{1, 64, 64, 16}, {0, 0, 1, 1, 1, 1, 0, 0}, 0.f}, // big enough for threads
+  };
+
+  for (const auto &c : cases)
+  {
+    const int rank = c.dims.size();
+    std::vector<int> output_dims(rank);
+    for (int i = 0; i < rank; ++i)
+      output_dims[i] = c.dims[i] + c.paddings[i * 2] + c.paddings[i * 2 + 1];
+
+    const auto input = makeData<float>(toShape(c.dims).FlatSize(), 1);
+    std::vector<float> expected;
+    forEachIndex(output_dims, [&](const std::vector<int> &index) {
+      std::vector<int> in_index(rank);
+      bool inside = true;
+      for (int i = 0; i < rank; ++i)
+      {
+        in_index[i] = index[i] - c.paddings[i * 2];
+        inside = inside && in_index[i] >= 0 && in_index[i] < c.dims[i];
+      }
+      expected.push_back(inside ? input[offsetOf(c.dims, in_index)] : c.value);
+    });
+
+    std::vector<float> output(expected.size(), 100.f);
+    nnfw::cker::Pad(c.paddings.data(), rank, toShape(c.dims), input.data(),
+                    toShape(output_dims), output.data(), &c.value);
+    for (size_t i = 0; i < expected.size(); ++i)
+      ASSERT_EQ(output[i], expected[i]) << "rank " << rank << " at " << i;
+  }
+}
+
+TEST(CKer_Operation, TileCopy)
+{
+  struct TileCase
+  {
+    std::vector<int> dims;
+    std::vector<int32_t> multipliers;
+  };
+  // input dims, multipliers
+  const TileCase cases[] = {
+      {{5}, {3}},
+      {{2, 3}, {2, 1}},
+      {{2, 3, 4}, {1, 3, 2}},
+      {{1, 2, 3, 2}, {2, 2, 2, 3}},
+  };
+
+  for (const auto &c : cases)
+  {
+    const int rank = c.dims.size();
+    std::vector<int> output_dims(rank);
+    for (int i = 0; i < rank; ++i)
+      output_dims[i] = c.dims[i] * c.multipliers[i];
+
+    const auto input = makeData<int32_t>(toShape(c.dims).FlatSize(), 1);
+    std::vector<int32_t> expected;
+    forEachIndex(output_dims, [&](const std::vector<int> &index) {
+      std::vector<int> in_index(rank);
+      for (int i = 0; i < rank; ++i)
+        in_index[i] = index[i] % c.dims[i];
+      expected.push_back(input[offsetOf(c.dims, in_index)]);
+    });
+
+    std::vector<int32_t> output(expected.size());
+    nnfw::cker::Tile(toShape(c.dims), input.data(), c.multipliers.data(), toShape(output_dims),
+                     output.data());
+    for (size_t i = 0; i < expected.size(); ++i)
+      ASSERT_EQ(output[i], expected[i]) << "rank " << rank << " at " << i;
+  }
+}
+
+TEST(CKer_Operation, PackUnpackCopy)
+{
+  const std::vector<int> dims{3, 4, 5};
+  const int count = 3;
+  const Shape input_shape = toShape(dims);
+  std::vector<std::vector<float>> inputs;
+  for (int i = 0; i < count; ++i)
+  {
+    auto input = makeData<float>(input_shape.FlatSize(), 1);
+    for (auto &value : input)
+      value += i * 1000;
+    inputs.push_back(input);
+  }
+
+  for (int axis = 0; axis <= 3; ++axis)
+  {
+    std::vector<int> output_dims = dims;
+    output_dims.insert(output_dims.begin() + axis, count);
+    std::vector<float> expected;
+    forEachIndex(output_dims, [&](const std::vector<int> &index) {
+      std::vector<int> in_index = index;
+      in_index.erase(in_index.begin() + axis);
+      expected.push_back(inputs[index[axis]][offsetOf(dims, in_index)]);
+    });
+
+    nnfw::cker::PackParams pack_params;
+    pack_params.axis = axis;
+    pack_params.inputs_count = count;
+    std::vector<const float *> input_data;
+    for (const auto &input : inputs)
+      input_data.push_back(input.data());
+    std::vector<float> output(expected.size());
+    nnfw::cker::Pack(pack_params, input_data.data(), toShape(output_dims), output.data());
+    for (size_t i = 0; i < expected.size(); ++i)
+      ASSERT_EQ(output[i], expected[i]) << "axis " << axis << " at " << i;
+
+    // Unpack restores the inputs
+    nnfw::cker::UnpackParams unpack_params;
+    unpack_params.axis = axis;
+    unpack_params.num_split = count;
+    std::vector<std::vector<float>> unpacked(count, std::vector<float>(input_shape.FlatSize()));
+    std::vector<float *> unpacked_data;
+    for (auto &values : unpacked)
+      unpacked_data.push_back(values.data());
+    nnfw::cker::Unpack(unpack_params, toShape(output_dims), output.data(), input_shape,
+                       unpacked_data.data());
+    for (int i = 0; i < count; ++i)
+      ASSERT_EQ(unpacked[i], inputs[i]) << "axis " << axis << " output " << i;
+  }
+}
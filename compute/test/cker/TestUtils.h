@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CKER_TEST_TEST_UTILS_H__
+#define __CKER_TEST_TEST_UTILS_H__
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace cker_test
+{
+
+/**
+ * @brief Linear congruential generator, which gives the same sequence on every platform
+ */
+class LinearCongruential
+{
+public:
+  explicit LinearCongruential(uint32_t seed) : _state{seed} {}
+
+public:
+  uint32_t next()
+  {
+    _state = _state * 1664525u + 1013904223u;
+    return _state;
+  }
+
+private:
+  uint32_t _state;
+};
+
+/**
+ * @brief  Make uniform random data in [-1, 1) for floating point type, and in the range of a
+ *         byte of the same signedness for integral type
+ */
+template <typename T = float> std::vector<T> makeData(int size, uint32_t seed)
+{
+  LinearCongruential random{seed};
+  std::vector<T> data(size);
+  for (auto &value : data)
+  {
+    const uint32_t bits = random.next();
+    if (std::is_floating_point<T>::value)
+      value = static_cast<T>(static_cast<float>(bits >> 8) / (1 << 24) * 2.f - 1.f);
+    else
+      value = static_cast<T>(static_cast<int32_t>(bits >> 24) -
+                             (std::is_signed<T>::value ? 128 : 0));
+  }
+  return data;
+}
+
+} // namespace cker_test
+
+#endif // __CKER_TEST_TEST_UTILS_H__
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Transpose.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+struct TransposeCase
+{
+  std::vector<int> dims;
+  std::vector<int> perm;
+};
+
+// input dims, perm
+const TransposeCase kCases[] = {
+    {{37, 45}, {1, 0}},                         // matrix with tile remainders
+    {{2, 9, 11, 35}, {0, 3, 1, 2}},             // NHWC to NCHW
+    {{2, 35, 9, 11}, {0, 2, 3, 1}},             // NCHW to NHWC
+    {{2, 13, 6, 8}, {0, 2, 1, 3}},              // attention heads
+    {{3, 1, 5, 7}, {3, 1, 2, 0}},               // dimension of size 1
+    {{4, 5, 6}, {2, 0, 1}},                     // 3D rotation
+    {{2, 3, 4, 5, 6}, {4, 2, 0, 3, 1}},         // 5D
+    {{2, 3, 2, 4, 3, 5}, {5, 0, 4, 1, 3, 2}},   // 6D
+    {{1, 1, 1}, {2, 1, 0}},                     // single element
+    {{6, 40}, {0, 1}},                          // identity
+};
+
+// Gathers input elements by walking output coordinates in order
+template <typename T>
+std::vector<T> naiveTranspose(const std::vector<int> &dims, const std::vector<int> &perm,
+                              const std::vector<T> &input)
+{
+  const int rank = dims.size();
+  std::vector<int> input_strides(rank, 1);
+  for (int i = rank - 2; i >= 0; --i)
+    input_strides[i] = input_strides[i + 1] * dims[i + 1];
+  std::vector<T> output(input.size());
+  std::vector<int> index(rank, 0);
+  for (size_t o = 0; o < output.size(); ++o)
+  {
+    int offset = 0;
+    for (int i = 0; i < rank; ++i)
+      offset += index[i] * input_strides[perm[i]];
+    output[o] = input[offset];
+    for (int i = rank - 1; i >= 0; --i)
+    {
+      if (++index[i] < dims[perm[i]])
+        break;
+      index[i] = 0;
+    }
+  }
+  return output;
+}
+
+template <typename T> void runCases()
+{
+  for (const auto &c : kCases)
+  {
+    const int rank = c.dims.size();
+    Shape input_shape(rank);
+    Shape output_shape(rank);
+    nnfw::cker::TransposeParams params;
+    params.perm_count = rank;
+    for (int i = 0; i < rank; ++i)
+    {
+      input_shape.SetDim(i, c.dims[i]);
+      output_shape.SetDim(i, c.dims[c.perm[i]]);
+      params.perm[i] = c.perm[i];
+    }
+    std::vector<T> input(input_shape.FlatSize());
+    for (size_t i = 0; i < input.size(); ++i)
+      input[i] = static_cast<T>(i * 7 + 1);
+
+    const auto expected = naiveTranspose(c.dims, c.perm, input);
+    std::vector<T> output(input.size());
+    nnfw::cker::Transpose(params, input_shape, input.data(), output_shape, output.data());
+    for (size_t i = 0; i < expected.size(); ++i)
+      ASSERT_EQ(output[i], expected[i]) << "rank " << rank << " at " << i;
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, Transpose)
+{
+  runCases<float>();
+  runCases<uint8_t>();
+  runCases<int16_t>();
+  runCases<int64_t>();
+}
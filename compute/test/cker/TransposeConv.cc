@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/TransposeConv.h>
+
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+using cker_test::makeData;
+
+struct TransposeConvCase
+{
+  int input_height;
+  int input_width;
+  int input_depth;
+  int output_depth;
+  int filter_size;
+  int stride;
+  int pad;
+};
+
+void verifyTransposeConv(const TransposeConvCase &c, bool constant_filter)
+{
+  const int batches = 2;
+  const int output_height = (c.input_height - 1) * c.stride + c.filter_size - 2 * c.pad;
+  const int output_width = (c.input_width - 1) * c.stride + c.filter_size - 2 * c.pad;
+
+  nnfw::cker::Shape input_shape{batches, c.input_height, c.input_width, c.input_depth};
+  nnfw::cker::Shape filter_shape{c.output_depth, c.filter_size, c.filter_size, c.input_depth};
+  nnfw::cker::Shape bias_shape{c.output_depth};
+  nnfw::cker::Shape output_shape{batches, output_height, output_width, c.output_depth};
+
+  const auto input = makeData(input_shape.FlatSize(), 1);
+  const auto filter = makeData(filter_shape.FlatSize(), 2);
+  const auto bias = makeData(c.output_depth, 3);
+
+  nnfw::cker::TransposeConvParams params;
+  params.stride_width = c.stride;
+  params.stride_height = c.stride;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.padding_values.width = c.pad;
+  params.padding_values.height = c.pad;
+  params.float_activation_min = -1.5f;
+  params.float_activation_max = 1.5f;
+
+  std::vector<float> expected(output_shape.FlatSize());
+  nnfw::cker::reference::TransposeConv(params, input_shape, input.data(), filter_shape,
+                                       filter.data(), output_shape, expected.data());
+  for (size_t i = 0; i < expected.size(); i++)
+  {
+    expected[i] = std::min(1.5f, std::max(-1.5f, expected[i] + bias[i % c.output_depth]));
+  }
+
+  nnfw::cker::TransposeConv kernel;
+  if (constant_filter)
+    kernel.prepare(filter_shape, filter.data());
+
+  // Run twice to check that buffers are reused correctly
+  for (int run = 0; run < 2; run++)
+  {
+    std::vector<float> actual(output_shape.FlatSize(), 100.f);
+    kernel(params, input_shape, input.data(), filter_shape,
+           constant_filter ? nullptr : filter.data(), bias_shape, bias.data(), output_shape,
+           actual.data());
+    for (size_t i = 0; i < expected.size(); i++)
+      ASSERT_NEAR(actual[i], expected[i], 1e-4) << "at " << i;
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, TransposeConv)
+{
+  // input_h, input_w, input_depth, output_depth, filter, stride, pad
+  const TransposeConvCase cases[] = {
+      {4, 4, 8, 4, 3, 1, 1},  // stride 1
+      {5, 3, 3, 6, 3, 2, 1},  // stride 2 with padding
+      {4, 6, 16, 8, 4, 2, 1}, // 4x4 upsampler
+      {3, 3, 2, 3, 2, 2, 0},  // no overlap
+      {2, 2, 4, 2, 5, 3, 2},  // filter larger than stride
+      {6, 6, 1, 1, 1, 1, 0},  // 1x1
+  };
+
+  for (const auto &c : cases)
+  {
+    verifyTransposeConv(c, true);
+    verifyTransposeConv(c, false);
+  }
+}
+
+TEST(CKer_Operation, TransposeConvLarge)
+{
+  // Large enough to be divided among threads
+  verifyTransposeConv({32, 32, 32, 16, 4, 2, 1}, true);
+}
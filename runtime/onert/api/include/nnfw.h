@@ -84,6 +84,13 @@ typedef enum {
   /** A tensor of 64 bit signed integer */
   NNFW_TYPE_TENSOR_INT64 = 5,
 
+  /**
+   * A tensor of 8 bit signed integers that represent real numbers.
+   *
+   * real_value = (integer_value - zeroPoint) * scale.
+   */
+  NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED = 6,
+
 } NNFW_TYPE;
 
 /**
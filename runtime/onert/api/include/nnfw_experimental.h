@@ -62,4 +62,95 @@ typedef struct
 NNFW_STATUS nnfw_register_custom_op_info(nnfw_session *session, const char *id,
                                          custom_kernel_registration_info *info);
 
+/**
+ * @brief     Set batch sizes to compile the model for
+ *
+ * This function should be called after {@link nnfw_load_model_from_file} and before
+ * {@link nnfw_prepare}. Then {@link nnfw_prepare} compiles a static plan for each batch size by
+ * fixing the batch dimension (axis 0) of all model inputs.
+ * After {@link nnfw_prepare}, changing only the batch dimension of inputs by
+ * {@link nnfw_set_input_tensorinfo} selects the smallest compiled batch size that can hold it,
+ * instead of shape inference on the fly. If it is larger than the given batch, inputs are padded
+ * with zeros and outputs are cut, so that input and output buffers hold only the given batch.
+ * The smallest batch size is used until {@link nnfw_set_input_tensorinfo} is called.
+ *
+ * @note      All model inputs and outputs must have the batch on axis 0
+ *
+ * @param[in] session     Session to be compiled for several batch sizes
+ * @param[in] batch_sizes Array of batch sizes
+ * @param[in] count       Number of elements in \p batch_sizes
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_set_batch_sizes(nnfw_session *session, const uint32_t *batch_sizes,
+                                 uint32_t count);
+
+/**
+ * @brief     Set request batching to run single-sample requests as batched inferences
+ *
+ * This function should be called after {@link nnfw_load_model_from_file} and before
+ * {@link nnfw_prepare}. Requests given by {@link nnfw_run_request} are coalesced along the batch
+ * axis (axis 0) up to \p max_batch requests, or less if the oldest request has waited for
+ * \p latency_budget_us microseconds. If {@link nnfw_set_batch_sizes} is not called, the model is
+ * compiled for batch sizes of powers of two and \p max_batch. Otherwise \p max_batch must not be
+ * larger than the largest batch size.
+ * While request batching is set, {@link nnfw_run}, {@link nnfw_run_async}, {@link nnfw_set_input}
+ * and {@link nnfw_set_output} are not allowed, and neither is {@link nnfw_set_input_tensorinfo}
+ * after {@link nnfw_prepare}.
+ *
+ * @param[in] session           Session to run requests
+ * @param[in] max_batch         Maximum number of requests run at once
+ * @param[in] latency_budget_us Maximum time in microseconds a request waits for other requests
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_set_request_batching(nnfw_session *session, uint32_t max_batch,
+                                      uint32_t latency_budget_us);
+
+/**
+ * @brief     Run a single-sample request, blocking until its batch is finished
+ *
+ * This function can be called by several threads at once after {@link nnfw_prepare} with
+ * {@link nnfw_set_request_batching}.
+ * It can be also used for a package with several models, which run as a pipeline. Then requests
+ * of several threads overlap on different models, and buffers hold whole inputs and outputs of
+ * the package.
+ *
+ * @param[in] session Session to run the request
+ * @param[in] inputs  Array of input buffers holding one sample, one for each model input
+ * @param[in] outputs Array of output buffers for one sample, one for each model output
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_run_request(nnfw_session *session, const void **inputs, void **outputs);
+
+/**
+ * @brief Latency statistics of a pipeline stage
+ */
+typedef struct
+{
+  /** Number of requests run by the stage */
+  uint64_t runs;
+  /** Sum of execution time in microseconds */
+  uint64_t total_run_us;
+  /** Longest execution time in microseconds */
+  uint64_t max_run_us;
+  /** Sum of time in microseconds requests waited for the stage */
+  uint64_t total_wait_us;
+} nnfw_stage_stats;
+
+/**
+ * @brief     Get latency statistics of a stage of a pipeline package
+ *
+ * When MANIFEST of a package has several models in "models", inputs of each model after the first
+ * are connected to outputs of the previous model. By default they are connected in order, or
+ * "model-connect" gives output indices of the previous model for each input. The models run as
+ * stages of a pipeline, each stage on its own thread.
+ * This function can be called after {@link nnfw_prepare}.
+ *
+ * @param[in]  session Session of a pipeline package
+ * @param[in]  stage   Index of the stage, which is the index of the model in "models"
+ * @param[out] stats   Statistics of the stage so far
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_pipeline_stage_stats(nnfw_session *session, uint32_t stage,
+                                      nnfw_stage_stats *stats);
+
 #endif // __NNFW_EXPERIMENTAL_H__
@@ -27,6 +27,7 @@ STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_QUANT8_ASYMM, 2);
 STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_BOOL, 3);
 STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_UINT8, 4);
 STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_INT64, 5);
+STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED, 6);
 
 STATIC_ASSERT_ENUM_CHECK(NNFW_STATUS_NO_ERROR, 0);
 STATIC_ASSERT_ENUM_CHECK(NNFW_STATUS_ERROR, 1);
@@ -273,6 +274,33 @@ NNFW_STATUS nnfw_register_custom_op_info(nnfw_session *session, const char *id,
   return session->register_custom_operation(id, info->eval_function);
 }
 
+NNFW_STATUS nnfw_set_batch_sizes(nnfw_session *session, const uint32_t *batch_sizes,
+                                 uint32_t count)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->set_batch_sizes(batch_sizes, count);
+}
+
+NNFW_STATUS nnfw_set_request_batching(nnfw_session *session, uint32_t max_batch,
+                                      uint32_t latency_budget_us)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->set_request_batching(max_batch, latency_budget_us);
+}
+
+NNFW_STATUS nnfw_run_request(nnfw_session *session, const void **inputs, void **outputs)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->run_request(inputs, outputs);
+}
+
+NNFW_STATUS nnfw_pipeline_stage_stats(nnfw_session *session, uint32_t stage,
+                                      nnfw_stage_stats *stats)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->pipeline_stage_stats(stage, stats);
+}
+
 NNFW_STATUS nnfw_apply_tensorinfo(nnfw_session *session, uint32_t index,
                                   nnfw_tensorinfo tensor_info)
 {
@@ -19,12 +19,18 @@
 #include "compiler/Compiler.h"
 #include "util/ConfigSource.h"
 #include "exec/Execution.h"
+#include "exec/BatchBucketExecution.h"
+#include "exec/RequestBatcher.h"
+#include "exec/PipelineExecution.h"
+#include "exec/OnlineRescheduler.h"
 #include "circle_loader.h"
 #include "tflite_loader.h"
 #include "json/json.h"
 #include "ir/OpCode.h"
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <string>
 #include <vector>
 #include <dirent.h>
@@ -64,6 +70,20 @@ static onert::ir::Layout convertLayout(NNFW_LAYOUT layout)
   return onert::ir::Layout::UNKNOWN;
 }
 
+static std::shared_ptr<onert::ir::Subgraphs> loadSubgraphs(const std::string &model_file_path,
+                                                           const std::string &model_type)
+{
+  if (model_type == "tflite")
+  {
+    return onert::tflite_loader::loadModel(model_file_path.c_str());
+  }
+  else if (model_type == "circle")
+  {
+    return onert::circle_loader::loadModel(model_file_path.c_str());
+  }
+  return nullptr;
+}
+
 nnfw_session::nnfw_session()
     : _subgraphs{nullptr}, _execution{nullptr},
       _kernel_registry{std::make_shared<onert::frontend::custom::KernelRegistry>()}
@@ -99,6 +119,13 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
   }
   closedir(dir);
 
+  // Models are loaded to locals and given to the session only when all of them are loaded, so that
+  // loading can be tried again after an error
+  std::shared_ptr<onert::ir::Subgraphs> subgraphs;
+  std::string model_file_path;
+  std::string model_type;
+  std::vector<std::shared_ptr<onert::ir::Subgraphs>> stage_subgraphs;
+  std::vector<std::vector<uint32_t>> stage_connections;
   try
   {
     std::string manifest_file_name(package_dir);
@@ -112,22 +139,54 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
     const Json::Value &models = root["models"];
     const Json::Value &model_types = root["model-types"];
 
-    auto model_file_path = package_dir + std::string("/") + models[0].asString(); // first model
-    auto model_type = model_types[0].asString(); // first model's type
-    if (model_type == "tflite")
+    model_file_path = package_dir + std::string("/") + models[0].asString(); // first model
+    model_type = model_types[0].asString(); // first model's type
+    subgraphs = loadSubgraphs(model_file_path, model_type);
+    if (!subgraphs)
     {
-      _subgraphs = onert::tflite_loader::loadModel(model_file_path.c_str());
+      std::cerr << "Unsupported model type in MANIFEST" << std::endl;
+      return NNFW_STATUS_ERROR;
     }
-    else if (model_type == "circle")
+    subgraphs->primary()->bindKernelBuilder(_kernel_registry->getBuilder());
+
+    // The other models are stages of a pipeline which follow the first model in order
+    // e.g. { "models" : [ "stage0.circle", "stage1.circle" ], "model-connect" : [ [1, 0] ] }
+    //      means inputs 0 and 1 of stage1 are outputs 1 and 0 of stage0
+    // Without "model-connect", inputs of a stage are outputs of the previous stage in order
+    const Json::Value &model_connect = root["model-connect"];
+    if (!model_connect.isNull() &&
+        (!model_connect.isArray() || model_connect.size() != models.size() - 1))
     {
-      _subgraphs = onert::circle_loader::loadModel(model_file_path.c_str());
+      std::cerr << "model-connect in MANIFEST must have an entry for each model but the first"
+                << std::endl;
+      return NNFW_STATUS_ERROR;
     }
-    else
+    for (Json::ArrayIndex i = 1; i < models.size(); i++)
     {
-      std::cerr << "Unsupported model type in MANIFEST" << std::endl;
-      return NNFW_STATUS_ERROR;
+      auto subgs = loadSubgraphs(package_dir + std::string("/") + models[i].asString(),
+                                 model_types[i].asString());
+      if (!subgs)
+      {
+        std::cerr << "Unsupported model type in MANIFEST" << std::endl;
+        return NNFW_STATUS_ERROR;
+      }
+      subgs->primary()->bindKernelBuilder(_kernel_registry->getBuilder());
+
+      std::vector<uint32_t> connection;
+      if (model_connect.isNull())
+      {
+        for (uint32_t j = 0; j < subgs->primary()->getInputs().size(); j++)
+          connection.push_back(j);
+      }
+      else
+      {
+        for (const auto &output_index : model_connect[i - 1])
+          connection.push_back(output_index.asUInt());
+      }
+
+      stage_subgraphs.emplace_back(subgs);
+      stage_connections.emplace_back(connection);
     }
-    _subgraphs->primary()->bindKernelBuilder(_kernel_registry->getBuilder());
   }
   catch (const std::exception &e)
   {
@@ -135,6 +194,12 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
     return NNFW_STATUS_ERROR;
   }
 
+  _subgraphs = subgraphs;
+  _model_file_path = model_file_path;
+  _model_type = model_type;
+  _stage_subgraphs = std::move(stage_subgraphs);
+  _stage_connections = std::move(stage_connections);
+
   _compiler = std::make_unique<onert::compiler::Compiler>(_subgraphs);
 
   _state = State::MODEL_LOADED;
@@ -168,9 +233,29 @@ NNFW_STATUS nnfw_session::prepare()
 
   try
   {
-    _subgraphs.reset();
-    std::shared_ptr<onert::exec::ExecutorMap> executors = _compiler->compile();
-    _execution = std::make_shared<onert::exec::Execution>(executors);
+    if (_compiler->options().he_online_profiling &&
+        (!_stage_subgraphs.empty() || !_batch_sizes.empty()))
+    {
+      std::cerr << "Warning during model prepare : online profiling is ignored for "
+                << (_stage_subgraphs.empty() ? "batch sizes" : "pipeline") << std::endl;
+    }
+
+    if (!_stage_subgraphs.empty())
+    {
+      preparePipeline();
+    }
+    else if (_batch_sizes.empty())
+    {
+      _subgraphs.reset();
+      std::shared_ptr<onert::exec::ExecutorMap> executors = _compiler->compile();
+      _execution = std::make_shared<onert::exec::Execution>(executors);
+      if (_compiler->options().he_online_profiling)
+        prepareOnlineRescheduler();
+    }
+    else
+    {
+      prepareBatchBuckets();
+    }
   }
   catch (const std::exception &e)
   {
@@ -191,9 +276,23 @@ NNFW_STATUS nnfw_session::run()
     return NNFW_STATUS_INVALID_STATE;
   }
 
+  if (_request_batcher)
+  {
+    std::cerr << "Error during nnfw_session::run : "
+              << "run_request should be used when request batching is set" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
   try
   {
-    _execution->execute();
+    if (_pipeline)
+      _pipeline->run(_pipeline_inputs, _pipeline_outputs);
+    else if (_batch_execution)
+      _batch_execution->execute();
+    else if (_rescheduler)
+      _rescheduler->execute();
+    else
+      _execution->execute();
   }
   catch (const std::exception &e)
   {
@@ -214,7 +313,32 @@ NNFW_STATUS nnfw_session::run_async()
     return NNFW_STATUS_INVALID_STATE;
   }
 
-  _execution->startExecute();
+  if (_request_batcher)
+  {
+    std::cerr << "Error during nnfw_session::run_async : "
+              << "run_request should be used when request batching is set" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    if (_pipeline)
+      _pipeline_request = _pipeline->submit(_pipeline_inputs, _pipeline_outputs);
+    else if (_batch_execution)
+      _batch_execution->startExecute();
+    else
+    {
+      if (_rescheduler)
+        std::cerr << "Warning during nnfw_session::run_async : "
+                  << "online profiling is not done with run_async" << std::endl;
+      _execution->startExecute();
+    }
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::run_async : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
 
   _state = State::RUNNING;
   return NNFW_STATUS_NO_ERROR;
@@ -229,7 +353,23 @@ NNFW_STATUS nnfw_session::await()
     return NNFW_STATUS_ERROR;
   }
 
-  _execution->waitFinish();
+  if (_pipeline)
+  {
+    try
+    {
+      _pipeline_request.get();
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << "Error during nnfw_session::run_await : " << e.what() << std::endl;
+      _state = State::FINISHED_RUN;
+      return NNFW_STATUS_ERROR;
+    }
+  }
+  else if (_batch_execution)
+    _batch_execution->waitFinish();
+  else
+    _execution->waitFinish();
 
   _state = State::FINISHED_RUN;
   return NNFW_STATUS_NO_ERROR;
@@ -244,6 +384,13 @@ NNFW_STATUS nnfw_session::set_input(uint32_t index, NNFW_TYPE /*type*/, const vo
     return NNFW_STATUS_INVALID_STATE;
   }
 
+  if (_request_batcher)
+  {
+    std::cerr << "Error during nnfw_session::set_input : "
+              << "buffers are given to run_request when request batching is set" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
   if (!buffer && length != 0)
   {
     std::cerr
@@ -254,7 +401,16 @@ NNFW_STATUS nnfw_session::set_input(uint32_t index, NNFW_TYPE /*type*/, const vo
 
   try
   {
-    _execution->setInput(onert::ir::IOIndex(index), buffer, length);
+    if (_pipeline)
+    {
+      if (length < _pipeline->inputSize(onert::ir::IOIndex(index)))
+        throw std::runtime_error{"Too small length"};
+      _pipeline_inputs.at(index) = buffer;
+    }
+    else if (_batch_execution)
+      _batch_execution->setInput(onert::ir::IOIndex(index), buffer, length);
+    else
+      _execution->setInput(onert::ir::IOIndex(index), buffer, length);
   }
   catch (const std::exception &e)
   {
@@ -273,6 +429,13 @@ NNFW_STATUS nnfw_session::set_output(uint32_t index, NNFW_TYPE /*type*/, void *b
     return NNFW_STATUS_INVALID_STATE;
   }
 
+  if (_request_batcher)
+  {
+    std::cerr << "Error during nnfw_session::set_output : "
+              << "buffers are given to run_request when request batching is set" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
   if (!buffer && length != 0)
   {
     std::cerr
@@ -283,7 +446,16 @@ NNFW_STATUS nnfw_session::set_output(uint32_t index, NNFW_TYPE /*type*/, void *b
 
   try
   {
-    _execution->setOutput(onert::ir::IOIndex(index), buffer, length);
+    if (_pipeline)
+    {
+      if (length < _pipeline->outputSize(onert::ir::IOIndex(index)))
+        throw std::runtime_error{"Too small length"};
+      _pipeline_outputs.at(index) = buffer;
+    }
+    else if (_batch_execution)
+      _batch_execution->setOutput(onert::ir::IOIndex(index), buffer, length);
+    else
+      _execution->setOutput(onert::ir::IOIndex(index), buffer, length);
   }
   catch (const std::exception &e)
   {
@@ -305,7 +477,7 @@ NNFW_STATUS nnfw_session::input_size(uint32_t *number)
       std::cerr << "Error during nnfw_session::input_size, number is null pointer." << std::endl;
       return NNFW_STATUS_UNEXPECTED_NULL;
     }
-    *number = primary_subgraph()->getInputs().size();
+    *number = input_subgraph()->getInputs().size();
   }
   catch (const std::exception &e)
   {
@@ -327,7 +499,7 @@ NNFW_STATUS nnfw_session::output_size(uint32_t *number)
       std::cerr << "Error during nnfw_session::output_size, number is null pointer." << std::endl;
       return NNFW_STATUS_UNEXPECTED_NULL;
     }
-    *number = primary_subgraph()->getOutputs().size();
+    *number = output_subgraph()->getOutputs().size();
   }
   catch (const std::exception &e)
   {
@@ -347,6 +519,12 @@ NNFW_STATUS nnfw_session::set_input_layout(uint32_t index, NNFW_LAYOUT layout)
       std::cerr << "Error during nnfw_session::set_input_layout, not supported layout" << std::endl;
       return NNFW_STATUS_ERROR;
     }
+    if (_pipeline)
+    {
+      std::cerr << "Error during nnfw_session::set_input_layout, "
+                << "not supported for pipeline packages" << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
     _execution->setInputLayout(onert::ir::IOIndex(index), convertLayout(layout));
   }
   catch (const std::exception &e)
@@ -368,6 +546,12 @@ NNFW_STATUS nnfw_session::set_output_layout(uint32_t index, NNFW_LAYOUT layout)
                 << std::endl;
       return NNFW_STATUS_ERROR;
     }
+    if (_pipeline)
+    {
+      std::cerr << "Error during nnfw_session::set_output_layout, "
+                << "not supported for pipeline packages" << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
     _execution->setOutputLayout(onert::ir::IOIndex(index), convertLayout(layout));
   }
   catch (const std::exception &e)
@@ -395,6 +579,8 @@ static NNFW_TYPE datatype_to_nnfw_dtype(onert::ir::DataType dt)
       return NNFW_TYPE_TENSOR_UINT8;
     case DataType::INT64:
       return NNFW_TYPE_TENSOR_INT64;
+    case DataType::QUANT_INT8_ASYMM:
+      return NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED;
     case DataType::UINT32:
     case DataType::QUANT_INT8_SYMM:
     default:
@@ -449,7 +635,49 @@ NNFW_STATUS nnfw_session::apply_tensorinfo(uint32_t index, nnfw_tensorinfo ti)
     for (int32_t i = 0; i < ti.rank; i++)
       new_shape.dim(i) = ti.dims[i];
 
-    _execution->changeInputShape(onert::ir::IOIndex(index), new_shape);
+    if (_request_batcher)
+    {
+      // RequestBatcher selects buckets of the batch execution on its own thread
+      std::cerr << "Error during set_input_tensorinfo : "
+                << "shapes cannot be changed after prepare when request batching is set"
+                << std::endl;
+      return NNFW_STATUS_INVALID_STATE;
+    }
+    else if (_pipeline)
+    {
+      std::cerr << "Error during set_input_tensorinfo : "
+                << "shapes cannot be changed after prepare for pipeline packages" << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+    else if (_batch_execution)
+    {
+      // Only batch can be changed, and it selects a statically compiled bucket
+      auto bucket_shape = _execution->getInputShape(onert::ir::IOIndex(index));
+      bool same_sample_shape = (bucket_shape.rank() == new_shape.rank());
+      for (int32_t i = 1; i < ti.rank && same_sample_shape; i++)
+        same_sample_shape = (bucket_shape.dim(i) == new_shape.dim(i));
+      if (!same_sample_shape)
+      {
+        std::cerr << "Error during set_input_tensorinfo : "
+                  << "only batch can be changed when batch sizes are set" << std::endl;
+        return NNFW_STATUS_ERROR;
+      }
+
+      try
+      {
+        _batch_execution->setBatchSize(ti.dims[0]);
+        _execution = _batch_execution->execution();
+      }
+      catch (const std::exception &e)
+      {
+        std::cerr << "Error during set_input_tensorinfo : " << e.what() << std::endl;
+        return NNFW_STATUS_ERROR;
+      }
+    }
+    else
+    {
+      _execution->changeInputShape(onert::ir::IOIndex(index), new_shape);
+    }
   }
 
   return NNFW_STATUS_NO_ERROR;
@@ -474,22 +702,25 @@ NNFW_STATUS nnfw_session::input_tensorinfo(uint32_t index, nnfw_tensorinfo *ti)
                 << std::endl;
       return NNFW_STATUS_UNEXPECTED_NULL;
     }
-    if (index >= primary_subgraph()->getInputs().size())
+    if (index >= input_subgraph()->getInputs().size())
     {
       std::cerr << "Error during nnfw_session::input_tensorinfo, index is out of range."
                 << std::endl;
       return NNFW_STATUS_ERROR;
     }
-    auto opidx = primary_subgraph()->getInputs().at(index);
-    auto shape = primary_subgraph()->operands().at(opidx).shape();
-    if (isStatePreparedOrFinishedRun())
+    auto opidx = input_subgraph()->getInputs().at(index);
+    auto shape = input_subgraph()->operands().at(opidx).shape();
+    // Shapes of a pipeline are static, so the graph has them
+    if (_batch_execution)
+      shape = _batch_execution->getInputShape(onert::ir::IOIndex{index});
+    else if (isStatePreparedOrFinishedRun() && !_pipeline)
       shape = _execution->getInputShape(onert::ir::IOIndex{index});
     ti->rank = shape.rank();
     for (int j = 0; j < ti->rank; ++j)
     {
       ti->dims[j] = shape.dim(j);
     }
-    ti->dtype = datatype_to_nnfw_dtype(primary_subgraph()->operands().at(opidx).typeInfo().type());
+    ti->dtype = datatype_to_nnfw_dtype(input_subgraph()->operands().at(opidx).typeInfo().type());
   }
   catch (const std::exception &e)
   {
@@ -511,7 +742,7 @@ NNFW_STATUS nnfw_session::output_tensorinfo(uint32_t index, nnfw_tensorinfo *ti)
     return NNFW_STATUS_UNEXPECTED_NULL;
   }
 
-  if (index >= primary_subgraph()->getOutputs().size())
+  if (index >= output_subgraph()->getOutputs().size())
   {
     std::cerr << "Error during nnfw_session::output_tensorinfo, index is out of range."
               << std::endl;
@@ -520,17 +751,20 @@ NNFW_STATUS nnfw_session::output_tensorinfo(uint32_t index, nnfw_tensorinfo *ti)
 
   try
   {
-    auto opidx = primary_subgraph()->getOutputs().at(index);
-    auto shape = primary_subgraph()->operands().at(opidx).shape();
+    auto opidx = output_subgraph()->getOutputs().at(index);
+    auto shape = output_subgraph()->operands().at(opidx).shape();
     // If it is called after `nnfw_run` then get the shape from Execution, not from the graph
-    if (isStateFinishedRun())
+    // Shapes of a pipeline are static, so the graph has them
+    if (_batch_execution)
+      shape = _batch_execution->getOutputShape(onert::ir::IOIndex{index});
+    else if (isStateFinishedRun() && !_pipeline)
       shape = _execution->getOutputShape(onert::ir::IOIndex{index});
     ti->rank = shape.rank();
     for (int j = 0; j < ti->rank; ++j)
     {
       ti->dims[j] = shape.dim(j);
     }
-    ti->dtype = datatype_to_nnfw_dtype(primary_subgraph()->operands().at(opidx).typeInfo().type());
+    ti->dtype = datatype_to_nnfw_dtype(output_subgraph()->operands().at(opidx).typeInfo().type());
   }
   catch (const std::exception &e)
   {
@@ -680,6 +914,236 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::set_batch_sizes(const uint32_t *batch_sizes, uint32_t count)
+{
+  if (!isStateModelLoaded())
+    return NNFW_STATUS_INVALID_STATE;
+
+  if (!batch_sizes)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (count == 0)
+  {
+    std::cerr << "Error during nnfw_session::set_batch_sizes : no batch size is given"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  std::vector<uint32_t> sizes{batch_sizes, batch_sizes + count};
+  if (std::find(sizes.begin(), sizes.end(), 0) != sizes.end())
+  {
+    std::cerr << "Error during nnfw_session::set_batch_sizes : batch size must be positive"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  std::sort(sizes.begin(), sizes.end());
+  sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
+  if (sizes.back() < _request_max_batch)
+  {
+    std::cerr << "Error during nnfw_session::set_batch_sizes : "
+              << "no batch size can hold max batch of request batching" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  _batch_sizes = sizes;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::set_request_batching(uint32_t max_batch, uint32_t latency_budget_us)
+{
+  if (!isStateModelLoaded())
+    return NNFW_STATUS_INVALID_STATE;
+
+  if (max_batch == 0)
+  {
+    std::cerr << "Error during nnfw_session::set_request_batching : max batch must be positive"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  if (!_batch_sizes.empty() && _batch_sizes.back() < max_batch)
+  {
+    std::cerr << "Error during nnfw_session::set_request_batching : "
+              << "max batch is larger than the largest batch size" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  _request_max_batch = max_batch;
+  _request_latency_budget_us = latency_budget_us;
+
+  // Compile powers of two and max batch if batch sizes are not given
+  if (_batch_sizes.empty())
+  {
+    for (uint32_t batch_size = 1; batch_size < max_batch; batch_size *= 2)
+      _batch_sizes.push_back(batch_size);
+    _batch_sizes.push_back(max_batch);
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::run_request(const void **inputs, void **outputs)
+{
+  // NOTE This can be called by several threads at once, so it does not change the state
+  if (!isStatePreparedOrFinishedRun() || (!_request_batcher && !_pipeline))
+  {
+    std::cerr << "Error during nnfw_session::run_request : "
+              << "run_request should be run after prepare with request batching or pipeline"
+              << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (!inputs || !outputs)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  try
+  {
+    std::vector<const void *> input_buffers{inputs,
+                                            inputs + input_subgraph()->getInputs().size()};
+    std::vector<void *> output_buffers{outputs, outputs + output_subgraph()->getOutputs().size()};
+    // Requests of several threads overlap on different stages
+    if (_pipeline)
+      _pipeline->run(input_buffers, output_buffers);
+    else
+      _request_batcher->run(input_buffers, output_buffers);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::run_request : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
+void nnfw_session::prepareBatchBuckets()
+{
+  std::map<uint32_t, std::shared_ptr<onert::exec::ExecutorMap>> buckets;
+  const auto &loaded_subg = *_subgraphs->primary();
+  for (auto batch_size : _batch_sizes)
+  {
+    // Compiler consumes the model, so load it again for each batch size
+    auto subgs = loadSubgraphs(_model_file_path, _model_type);
+    auto &subg = *subgs->primary();
+    subg.bindKernelBuilder(_kernel_registry->getBuilder());
+
+    // Shapes may have been changed by set_input_tensorinfo before prepare
+    for (uint32_t i = 0; i < subg.getInputs().size(); i++)
+    {
+      auto shape = loaded_subg.operands().at(loaded_subg.getInputs().at(i)).shape();
+      if (shape.rank() == 0)
+        throw std::runtime_error{"Batch sizes are given but a model input has no batch axis"};
+      shape.dim(0) = batch_size;
+      subg.operands().at(subg.getInputs().at(i)).info().shape(shape);
+    }
+
+    onert::compiler::Compiler compiler{subgs};
+    compiler.options() = _compiler->options();
+    buckets.emplace(batch_size, compiler.compile());
+  }
+
+  _subgraphs.reset();
+  _batch_execution = std::make_shared<onert::exec::BatchBucketExecution>(buckets);
+
+  if (_request_max_batch > 0)
+  {
+    _request_batcher = std::make_unique<onert::exec::RequestBatcher>(
+        _batch_execution, _request_max_batch,
+        std::chrono::microseconds{_request_latency_budget_us});
+  }
+
+  _execution = _batch_execution->execution();
+}
+
+void nnfw_session::prepareOnlineRescheduler()
+{
+  // Shapes may have been changed by set_input_tensorinfo before prepare
+  const auto &graph = _execution->primary_subgraph();
+  std::vector<onert::ir::Shape> input_shapes;
+  for (const auto &input : graph.getInputs())
+    input_shapes.emplace_back(graph.operands().at(input).shape());
+
+  // Compiler consumes the model, so load it again for each rescheduling
+  auto recompile = [model_file_path = _model_file_path, model_type = _model_type,
+                    kernel_registry = _kernel_registry, options = _compiler->options(),
+                    input_shapes]() {
+    auto subgs = loadSubgraphs(model_file_path, model_type);
+    auto &subg = *subgs->primary();
+    subg.bindKernelBuilder(kernel_registry->getBuilder());
+    for (uint32_t i = 0; i < subg.getInputs().size(); i++)
+      subg.operands().at(subg.getInputs().at(i)).info().shape(input_shapes[i]);
+
+    onert::compiler::Compiler compiler{subgs};
+    compiler.options() = options;
+    return compiler.compile();
+  };
+
+  _rescheduler = std::make_unique<onert::exec::OnlineRescheduler>(
+      _execution, recompile, _compiler->options().he_online_reschedule_period);
+}
+
+NNFW_STATUS nnfw_session::pipeline_stage_stats(uint32_t stage, nnfw_stage_stats *stats)
+{
+  if (!stats)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (!_pipeline)
+  {
+    std::cerr << "Error during nnfw_session::pipeline_stage_stats : "
+              << "it should be run after prepare of a pipeline package" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (stage >= _pipeline->stageSize())
+  {
+    std::cerr << "Error during nnfw_session::pipeline_stage_stats, stage is out of range."
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  auto stat = _pipeline->stageStat(stage);
+  stats->runs = stat.runs;
+  stats->total_run_us = stat.total_run.count();
+  stats->max_run_us = stat.max_run.count();
+  stats->total_wait_us = stat.total_wait.count();
+  return NNFW_STATUS_NO_ERROR;
+}
+
+void nnfw_session::preparePipeline()
+{
+  if (!_batch_sizes.empty())
+    throw std::runtime_error{"Batch sizes are not supported for pipeline packages"};
+
+  std::vector<std::shared_ptr<onert::exec::ExecutorMap>> stages;
+  stages.emplace_back(_compiler->compile());
+  for (auto &subgs : _stage_subgraphs)
+  {
+    onert::compiler::Compiler compiler{subgs};
+    compiler.options() = _compiler->options();
+    stages.emplace_back(compiler.compile());
+  }
+
+  _subgraphs.reset();
+  _stage_subgraphs.clear();
+  _pipeline = std::make_unique<onert::exec::PipelineExecution>(stages, _stage_connections);
+  _pipeline_inputs.assign(_pipeline->stageGraph(0).getInputs().size(), nullptr);
+  _pipeline_outputs.assign(_pipeline->stageGraph(stages.size() - 1).getOutputs().size(), nullptr);
+}
+
+const onert::ir::Graph *nnfw_session::input_subgraph()
+{
+  if (_pipeline)
+    return &_pipeline->stageGraph(0);
+  return primary_subgraph();
+}
+
+const onert::ir::Graph *nnfw_session::output_subgraph()
+{
+  if (!_stage_subgraphs.empty())
+    return _stage_subgraphs.back()->primary().get();
+  if (_pipeline)
+    return &_pipeline->stageGraph(_pipeline->stageSize() - 1);
+  return primary_subgraph();
+}
+
 onert::ir::Graph *nnfw_session::primary_subgraph()
 {
   if (_subgraphs)
@@ -779,8 +1243,8 @@ bool nnfw_session::isStatePrepared()
   {
     assert(!_subgraphs);
     assert(_compiler);
-    assert(_execution);
-    assert(!primary_subgraph()->isBuildingPhase());
+    assert(_execution || _pipeline);
+    assert(!input_subgraph()->isBuildingPhase());
     return true;
   }
   else
@@ -795,8 +1259,8 @@ bool nnfw_session::isStateRunning()
   {
     assert(!_subgraphs);
     assert(_compiler);
-    assert(_execution);
-    assert(!primary_subgraph()->isBuildingPhase());
+    assert(_execution || _pipeline);
+    assert(!input_subgraph()->isBuildingPhase());
     return true;
   }
   return false;
@@ -808,8 +1272,8 @@ bool nnfw_session::isStateFinishedRun()
   {
     assert(!_subgraphs);
     assert(_compiler);
-    assert(_execution);
-    assert(!primary_subgraph()->isBuildingPhase());
+    assert(_execution || _pipeline);
+    assert(!input_subgraph()->isBuildingPhase());
     return true;
   }
   else
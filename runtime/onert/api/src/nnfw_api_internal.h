@@ -22,8 +22,10 @@
 
 #include <util/GeneralConfigSource.h>
 
+#include <future>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace onert
 {
@@ -37,6 +39,10 @@ class KernelRegistry;
 namespace exec
 {
 class Execution;
+class BatchBucketExecution;
+class RequestBatcher;
+class PipelineExecution;
+class OnlineRescheduler;
 } // namespace exec
 namespace ir
 {
@@ -130,8 +136,18 @@ public:
   NNFW_STATUS set_config(const char *key, const char *value);
   NNFW_STATUS get_config(const char *key, char *value, size_t value_size);
 
+  NNFW_STATUS set_batch_sizes(const uint32_t *batch_sizes, uint32_t count);
+  NNFW_STATUS set_request_batching(uint32_t max_batch, uint32_t latency_budget_us);
+  NNFW_STATUS run_request(const void **inputs, void **outputs);
+  NNFW_STATUS pipeline_stage_stats(uint32_t stage, nnfw_stage_stats *stats);
+
 private:
   onert::ir::Graph *primary_subgraph();
+  const onert::ir::Graph *input_subgraph();  //< Graph having inputs of the package
+  const onert::ir::Graph *output_subgraph(); //< Graph having outputs of the package
+  void prepareBatchBuckets();
+  void preparePipeline();
+  void prepareOnlineRescheduler();
   bool isStateInitialized();
   bool isStateModelLoaded();
   bool isStatePrepared();
@@ -145,6 +161,22 @@ private:
   std::unique_ptr<onert::compiler::Compiler> _compiler;
   std::shared_ptr<onert::exec::Execution> _execution;
   std::shared_ptr<onert::frontend::custom::KernelRegistry> _kernel_registry;
+  std::string _model_file_path;
+  std::string _model_type;
+  std::vector<uint32_t> _batch_sizes; //< Sorted batch sizes to compile, empty if not given
+  // Executions of all batch sizes if _batch_sizes is given. _execution is the selected one of them.
+  std::shared_ptr<onert::exec::BatchBucketExecution> _batch_execution;
+  uint32_t _request_max_batch{0}; //< 0 if request batching is not set
+  uint32_t _request_latency_budget_us{0};
+  std::unique_ptr<onert::exec::RequestBatcher> _request_batcher;
+  // Models after the first one in a package, which run as pipeline stages after it
+  std::vector<std::shared_ptr<onert::ir::Subgraphs>> _stage_subgraphs;
+  std::vector<std::vector<uint32_t>> _stage_connections; //< Inputs of each stage from the previous
+  std::unique_ptr<onert::exec::PipelineExecution> _pipeline;
+  std::vector<const void *> _pipeline_inputs;
+  std::vector<void *> _pipeline_outputs;
+  std::future<void> _pipeline_request; //< Request given by run_async
+  std::unique_ptr<onert::exec::OnlineRescheduler> _rescheduler; //< Set if online profiling is on
 };
 
 #endif // __API_NNFW_API_INTERNAL_H__
@@ -109,6 +109,8 @@ namespace acl_common
       return ::arm_compute::DataType::U8;
     case ir::DataType::QUANT_INT8_SYMM:
       return ::arm_compute::DataType::S8;
+    case ir::DataType::QUANT_INT8_ASYMM:
+      return ::arm_compute::DataType::QASYMM8_SIGNED;
     case ir::DataType::FLOAT16:
       return ::arm_compute::DataType::F16;
     default:
@@ -257,6 +259,8 @@ ir::DataType asRuntimeDataType(::arm_compute::DataType data_type)
       return ir::DataType::UINT8;
     case ::arm_compute::DataType::QSYMM8:
       return ir::DataType::QUANT_INT8_SYMM;
+    case ::arm_compute::DataType::QASYMM8_SIGNED:
+      return ir::DataType::QUANT_INT8_ASYMM;
     case ::arm_compute::DataType::F16:
       return ir::DataType::FLOAT16;
     default:
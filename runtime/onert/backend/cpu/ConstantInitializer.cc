@@ -89,6 +89,13 @@ void ConstantInitializer::visit(const ir::operation::FullyConnected &node)
   }
 }
 
+void ConstantInitializer::visit(const ir::operation::TransposeConv &node)
+{
+  const auto &kernel_index = node.getInputs().at(ir::operation::TransposeConv::KERNEL);
+  const auto &kernel_obj = _operands.at(kernel_index);
+  registerExternalInitializer(kernel_index, kernel_obj);
+}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
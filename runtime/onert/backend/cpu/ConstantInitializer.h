@@ -48,6 +48,7 @@ public:
   void visit(const ir::operation::Conv2D &) override;
   void visit(const ir::operation::DepthwiseConv2D &) override;
   void visit(const ir::operation::FullyConnected &) override;
+  void visit(const ir::operation::TransposeConv &) override;
 
 private:
   std::shared_ptr<ITensorBuilder> tensor_builder() const override { return _tensor_builder; }
@@ -20,6 +20,8 @@
 #include "ops/AddLayer.h"
 #include "ops/ArgMinMaxLayer.h"
 #include "ops/AvgPoolLayer.h"
+#include "ops/BCQFullyConnectedLayer.h"
+#include "ops/BCQGatherLayer.h"
 #include "ops/CastLayer.h"
 #include "ops/CompareLayer.h"
 #include "ops/ConcatLayer.h"
@@ -27,13 +29,16 @@
 #include "ops/CosLayer.h"
 #include "ops/DepthwiseConvolutionLayer.h"
 #include "ops/DivLayer.h"
+#include "ops/EmbeddingLookupLayer.h"
 #include "ops/EinsumLayer.h"
 #include "ops/ExpLayer.h"
 #include "ops/ExpandDimsLayer.h"
 #include "ops/FillLayer.h"
 #include "ops/FullyConnectedLayer.h"
 #include "ops/GatherLayer.h"
+#include "ops/HashtableLookupLayer.h"
 #include "ops/LogLayer.h"
+#include "ops/LSTMLayer.h"
 #include "ops/LogisticLayer.h"
 #include "ops/MaxLayer.h"
 #include "ops/MaxPoolLayer.h"
@@ -52,6 +57,8 @@
 #include "ops/ReLU6Layer.h"
 #include "ops/ReshapeLayer.h"
 #include "ops/ResizeBilinearLayer.h"
+#include "ops/ResizeNearestNeighborLayer.h"
+#include "ops/RNNLayer.h"
 #include "ops/ReverseLayer.h"
 #include "ops/RoundLayer.h"
 #include "ops/RsqrtLayer.h"
@@ -69,12 +76,16 @@
 #include "ops/TanhLayer.h"
 #include "ops/TileLayer.h"
 #include "ops/TransposeLayer.h"
+#include "ops/TransposeConvLayer.h"
 #include "ops/UnpackLayer.h"
 #include "ops/LogicalNotLayer.h"
 #include "ops/ZerosLikeLayer.h"
 #include "ops/SquaredDiffLayer.h"
 #include "ops/LogicalOrLayer.h"
 #include "ops/L2NormLayer.h"
+#include "ops/InstanceNormLayer.h"
+#include "ops/PReLULayer.h"
+#include "ops/LocalResponseNormalizationLayer.h"
 #include "ops/MatrixBandPartLayer.h"
 #include "ops/BatchMatMulLayer.h"
 #include "ops/BroadcastToLayer.h"
@@ -86,6 +97,7 @@
 #include <backend/Backend.h>
 #include <backend/IConfig.h>
 #include <memory>
+#include <util/ConfigSource.h>
 #include <util/Utils.h>
 #include <util/logging.h>
 #include <exec/DynamicShapeInference.h>
@@ -121,6 +133,29 @@ ops::ReduceType convertReduceType(ir::operation::Reduce::ReduceType reduce_type_
       throw std::runtime_error("cpu KernelGenerator : Not supported operation yet");
   }
 }
+
+// Runs the function of an operation fused into the Conv, only when the Conv has not applied it
+class FusedEpilogueFunction : public exec::IFunction
+{
+public:
+  FusedEpilogueFunction(const ops::ConvolutionLayer &conv, std::unique_ptr<exec::IFunction> fn)
+      : _conv(conv), _fn(std::move(fn))
+  {
+    // DO NOTHING
+  }
+
+  void run() override
+  {
+    if (!_conv.epilogueApplied())
+      _fn->run();
+  }
+
+  void prepare() override { _fn->prepare(); }
+
+private:
+  const ops::ConvolutionLayer &_conv;
+  std::unique_ptr<exec::IFunction> _fn;
+};
 } // namespace
 
 KernelGenerator::KernelGenerator(
@@ -160,13 +195,7 @@ void KernelGenerator::visit(const ir::OpSequence &op_seq)
   }
   _return_fn_seq->enableDynamicShapeInferer(true);
 
-  _current_op_seq_layout = op_seq.getLayout();
-  for (const auto &operation_idx : op_seq.operations())
-  {
-    const auto &node = _operations_ctx.at(operation_idx);
-    node.accept(*this);
-    _return_fn_seq->append(releaseFunction());
-
+  auto increase_refs = [this](const ir::Operation &node) {
     for (const auto &ind : (node.getInputs() | ir::Remove::UNDEFINED) + node.getOutputs())
     {
       auto portable_tensor = _tensor_builder->portableAt(ind);
@@ -181,7 +210,98 @@ void KernelGenerator::visit(const ir::OpSequence &op_seq)
         tensor->increase_ref();
       }
     }
+  };
+
+  _current_op_seq_layout = op_seq.getLayout();
+  const auto &operations = op_seq.operations();
+  for (size_t i = 0; i < operations.size(); ++i)
+  {
+    const auto &node = _operations_ctx.at(operations[i]);
+    if (i + 1 < operations.size() && fuseEpilogue(node, _operations_ctx.at(operations[i + 1])))
+    {
+      auto conv_fn = releaseFunction();
+      const auto &conv = static_cast<const ops::ConvolutionLayer &>(*conv_fn);
+      const auto &next = _operations_ctx.at(operations[++i]);
+      next.accept(*this);
+      // Operations and functions of the sequence are mapped one by one
+      _return_fn_seq->append(std::move(conv_fn));
+      _return_fn_seq->append(std::make_unique<FusedEpilogueFunction>(conv, releaseFunction()));
+      increase_refs(node);
+      increase_refs(next);
+      continue;
+    }
+
+    node.accept(*this);
+    _return_fn_seq->append(releaseFunction());
+    increase_refs(node);
+  }
+}
+
+bool KernelGenerator::fuseEpilogue(const ir::Operation &node, const ir::Operation &next)
+{
+  if (node.opcode() != ir::OpCode::Conv2D)
+    return false;
+
+  nnfw::cker::FusedEpilogueType type;
+  ir::Activation activation;
+  if (next.opcode() == ir::OpCode::Add)
+  {
+    type = nnfw::cker::FusedEpilogueType::kAdd;
+    activation = static_cast<const ir::operation::Add &>(next).param().activation;
+  }
+  else if (next.opcode() == ir::OpCode::Mul)
+  {
+    type = nnfw::cker::FusedEpilogueType::kMul;
+    activation = static_cast<const ir::operation::Mul &>(next).param().activation;
+  }
+  else
+  {
+    return false;
+  }
+
+  using ir::operation::Conv2D;
+  const auto &conv = static_cast<const Conv2D &>(node);
+  const auto ifm_index{conv.getInputs().at(Conv2D::Input::INPUT)};
+  const auto ker_index{conv.getInputs().at(Conv2D::Input::KERNEL)};
+  const auto ofm_index{conv.getOutputs().at(0)};
+  const auto lhs_index{next.getInputs().at(0)};
+  const auto rhs_index{next.getInputs().at(1)};
+  const auto result_index{next.getOutputs().at(0)};
+  // The Conv output is not a model output because it is not at the end of the sequence
+  if (_ctx.at(ofm_index).getUses().size() != 1 || lhs_index == rhs_index ||
+      (lhs_index != ofm_index && rhs_index != ofm_index))
+    return false;
+  const auto operand_index = lhs_index == ofm_index ? rhs_index : lhs_index;
+
+  for (const auto &ind : {ifm_index, ker_index, ofm_index, operand_index, result_index})
+  {
+    const auto &obj = _ctx.at(ind);
+    if (obj.typeInfo().type() != ir::DataType::FLOAT32 || obj.info().isDynamic())
+      return false;
   }
+
+  const auto &ofm_shape = _ctx.at(ofm_index).shape();
+  const auto &operand = _ctx.at(operand_index);
+  const auto depth = ofm_shape.dim(ofm_shape.rank() - 1);
+  bool per_channel = false;
+  if (_ctx.at(result_index).shape() != ofm_shape)
+    return false;
+  if (operand.shape() != ofm_shape)
+  {
+    // Constant of the output depth, such as the scale and shift of a folded batch normalization
+    const auto &operand_shape = operand.shape();
+    if (!operand.isConstant() || operand_shape.rank() == 0 ||
+        operand_shape.num_elements() != static_cast<uint64_t>(depth) ||
+        operand_shape.dim(operand_shape.rank() - 1) != depth)
+      return false;
+    per_channel = true;
+  }
+
+  visit(conv);
+  auto fn = static_cast<ops::ConvolutionLayer *>(_return_fn.get());
+  fn->configureEpilogue(type, _tensor_builder->portableAt(operand_index).get(), per_channel,
+                        activation, _tensor_builder->portableAt(result_index).get());
+  return true;
 }
 
 void KernelGenerator::visit(const ir::operation::Conv2D &node)
@@ -207,7 +327,7 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
   {
     fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, param_padding.param.left,
                   param_padding.param.right, param_padding.param.top, param_padding.param.bottom,
-                  stride.horizontal, stride.vertical, activation, ofm_tensor);
+                  stride.horizontal, stride.vertical, activation, ofm_tensor, _external_context);
 
     _return_fn = std::move(fn);
     return;
@@ -224,7 +344,7 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
 
   fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, padding.left,
                 padding.right, padding.top, padding.bottom, stride.horizontal, stride.vertical,
-                activation, ofm_tensor);
+                activation, ofm_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -371,7 +491,7 @@ void KernelGenerator::visit(const ir::operation::FullyConnected &node)
   auto fn = std::make_unique<ops::FullyConnectedLayer>();
 
   fn->configure(input_tensor, weight_tensor, bias_tensor, activation, output_tensor,
-                _external_context);
+                _external_context, util::getConfigBool(util::config::CPU_FP16_WEIGHTS));
 
   _return_fn = std::move(fn);
 }
@@ -838,6 +958,45 @@ void KernelGenerator::visit(const ir::operation::Transpose &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::TransposeConv &node)
+{
+  using ir::operation::TransposeConv;
+
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ker_index{node.getInputs().at(TransposeConv::Input::KERNEL)};
+  const auto ifm_index{node.getInputs().at(TransposeConv::Input::INPUT)};
+
+  auto ofm_tensor = _tensor_builder->portableAt(ofm_index).get();
+  auto ifm_tensor = _tensor_builder->portableAt(ifm_index).get();
+  auto ker_tensor = _tensor_builder->portableAt(ker_index).get();
+
+  const auto stride = node.param().stride;
+  const auto param_padding = node.param().padding;
+  assert((param_padding.type == ir::PaddingType::SAME) ||
+         (param_padding.type == ir::PaddingType::VALID));
+
+  uint32_t padding_left = 0;
+  uint32_t padding_top = 0;
+  if (!_ctx.at(ifm_index).info().isDynamic() && !_ctx.at(ofm_index).info().isDynamic())
+  {
+    const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature(_current_op_seq_layout);
+    const auto ofm_shape = _ctx.at(ofm_index).shape().asFeature(_current_op_seq_layout);
+    // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+    const auto &ker_shape = _ctx.at(ker_index).shape();
+    const auto padding = ir::calculatePadding(param_padding, ofm_shape, ifm_shape, stride,
+                                              ker_shape.dim(2), ker_shape.dim(1));
+    padding_left = padding.left;
+    padding_top = padding.top;
+  }
+
+  auto fn = std::make_unique<ops::TransposeConvLayer>();
+
+  fn->configure(ifm_tensor, ker_tensor, nullptr, param_padding, padding_left, padding_top,
+                stride.horizontal, stride.vertical, ir::Activation::NONE, ofm_tensor);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Reduce &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1081,6 +1240,27 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::ResizeNearestNeighbor &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::ResizeNearestNeighbor::INPUT)};
+
+  auto output_height = node.param().height_out;
+  auto output_width = node.param().width_out;
+  auto align_corners = node.param().align_corners;
+  auto half_pixel_centers = node.param().half_pixel_centers;
+
+  auto output_tensor = _tensor_builder->portableAt(output_index).get();
+  auto input_tensor = _tensor_builder->portableAt(input_index).get();
+
+  auto fn = std::make_unique<ops::ResizeNearestNeighborLayer>();
+
+  fn->configure(input_tensor, output_tensor, output_height, output_width, align_corners,
+                half_pixel_centers);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Reverse &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1224,6 +1404,59 @@ void KernelGenerator::visit(const ir::operation::L2Normalization &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::InstanceNorm &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::InstanceNorm::INPUT)};
+  const auto gamma_index{node.getInputs().at(ir::operation::InstanceNorm::GAMMA)};
+  const auto beta_index{node.getInputs().at(ir::operation::InstanceNorm::BETA)};
+
+  auto output_tensor = _tensor_builder->portableAt(output_index).get();
+  auto input_tensor = _tensor_builder->portableAt(input_index).get();
+  auto gamma_tensor = _tensor_builder->portableAt(gamma_index).get();
+  auto beta_tensor = _tensor_builder->portableAt(beta_index).get();
+
+  auto fn = std::make_unique<ops::InstanceNormLayer>();
+
+  fn->configure(input_tensor, gamma_tensor, beta_tensor, node.param().epsilon,
+                node.param().activation, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::PReLU &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::PReLU::INPUT)};
+  const auto alpha_index{node.getInputs().at(ir::operation::PReLU::ALPHA)};
+
+  auto output_tensor = _tensor_builder->portableAt(output_index).get();
+  auto input_tensor = _tensor_builder->portableAt(input_index).get();
+  auto alpha_tensor = _tensor_builder->portableAt(alpha_index).get();
+
+  auto fn = std::make_unique<ops::PReLULayer>();
+
+  fn->configure(input_tensor, alpha_tensor, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::LocalResponseNormalization &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::LocalResponseNormalization::INPUT)};
+
+  auto output_tensor = _tensor_builder->portableAt(output_index).get();
+  auto input_tensor = _tensor_builder->portableAt(input_index).get();
+
+  const auto &param = node.param();
+  auto fn = std::make_unique<ops::LocalResponseNormalizationLayer>();
+
+  fn->configure(input_tensor, param.radius, param.bias, param.alpha, param.beta, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::ZerosLike &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1469,6 +1702,170 @@ void KernelGenerator::visit(const ir::operation::SplitV &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::LSTM &node)
+{
+  using ir::operation::LSTM;
+
+  // Optional operands which are omitted in the model have zero-sized shape
+  auto optionalTensor = [&](LSTM::Input input) -> IPortableTensor * {
+    const auto index{node.getInputs().at(input)};
+    if (index.undefined() || _ctx.at(index).shape().num_elements() == 0)
+      return nullptr;
+    return _tensor_builder->portableAt(index).get();
+  };
+  auto inputTensor = [&](LSTM::Input input) {
+    return _tensor_builder->portableAt(node.getInputs().at(input)).get();
+  };
+  auto outputTensor = [&](LSTM::Output output) {
+    return _tensor_builder->portableAt(node.getOutputs().at(output)).get();
+  };
+
+  auto fn = std::make_unique<ops::LSTMLayer>();
+
+  fn->configure(
+      inputTensor(LSTM::Input::INPUT), optionalTensor(LSTM::Input::INPUT_TO_INPUT_WEIGHTS),
+      inputTensor(LSTM::Input::INPUT_TO_FORGET_WEIGHTS),
+      inputTensor(LSTM::Input::INPUT_TO_CELL_WEIGHTS),
+      inputTensor(LSTM::Input::INPUT_TO_OUTPUT_WEIGHTS),
+      optionalTensor(LSTM::Input::RECURRENT_TO_INPUT_WEIGHTS),
+      inputTensor(LSTM::Input::RECURRENT_TO_FORGET_WEIGHTS),
+      inputTensor(LSTM::Input::RECURRENT_TO_CELL_WEIGHTS),
+      inputTensor(LSTM::Input::RECURRENT_TO_OUTPUT_WEIGHTS),
+      optionalTensor(LSTM::Input::CELL_TO_INPUT_WEIGHTS),
+      optionalTensor(LSTM::Input::CELL_TO_FORGET_WEIGHTS),
+      optionalTensor(LSTM::Input::CELL_TO_OUTPUT_WEIGHTS),
+      optionalTensor(LSTM::Input::INPUT_GATE_BIAS), inputTensor(LSTM::Input::FORGET_GATE_BIAS),
+      inputTensor(LSTM::Input::CELL_BIAS), inputTensor(LSTM::Input::OUTPUT_GATE_BIAS),
+      optionalTensor(LSTM::Input::PROJECTION_WEIGHTS),
+      optionalTensor(LSTM::Input::PROJECTION_BIAS), inputTensor(LSTM::Input::OUTPUT_STATE_IN),
+      inputTensor(LSTM::Input::CELL_STATE_IN), node.param().activation,
+      node.param().cell_threshold, node.param().projection_threshold,
+      outputTensor(LSTM::Output::SCRATCH_BUFFER), outputTensor(LSTM::Output::OUTPUT_STATE_OUT),
+      outputTensor(LSTM::Output::CELL_STATE_OUT), outputTensor(LSTM::Output::OUTPUT));
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::RNN &node)
+{
+  using ir::operation::RNN;
+
+  const auto output_index{node.getOutputs().at(RNN::Output::OUTPUT)};
+  const auto hidden_state_out_index{node.getOutputs().at(RNN::Output::HIDDEN_STATE_OUT)};
+  const auto input_index{node.getInputs().at(RNN::Input::INPUT)};
+  const auto weights_index{node.getInputs().at(RNN::Input::WEIGHTS)};
+  const auto recurrent_weights_index{node.getInputs().at(RNN::Input::RECURRENT_WEIGHTS)};
+  const auto bias_index{node.getInputs().at(RNN::Input::BIAS)};
+  const auto hidden_state_in_index{node.getInputs().at(RNN::Input::HIDDEN_STATE_IN)};
+  const auto activation = node.param().activation;
+
+  auto output_tensor = _tensor_builder->portableAt(output_index).get();
+  auto hidden_state_out_tensor = _tensor_builder->portableAt(hidden_state_out_index).get();
+  auto input_tensor = _tensor_builder->portableAt(input_index).get();
+  auto weights_tensor = _tensor_builder->portableAt(weights_index).get();
+  auto recurrent_weights_tensor = _tensor_builder->portableAt(recurrent_weights_index).get();
+  auto bias_tensor = _tensor_builder->portableAt(bias_index).get();
+  auto hidden_state_in_tensor = _tensor_builder->portableAt(hidden_state_in_index).get();
+
+  auto fn = std::make_unique<ops::RNNLayer>();
+
+  fn->configure(input_tensor, weights_tensor, recurrent_weights_tensor, bias_tensor,
+                hidden_state_in_tensor, activation, output_tensor, hidden_state_out_tensor);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::BCQFullyConnected &node)
+{
+  using ir::operation::BCQFullyConnected;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(BCQFullyConnected::Input::INPUT)};
+  const auto weights_scales_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_SCALES)};
+  const auto weights_binary_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_BINARY)};
+  const auto bias_index{node.getInputs().at(BCQFullyConnected::Input::BIAS)};
+  const auto weights_clusters_index{
+      node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_CLUSTERS)};
+
+  auto output_tensor = _tensor_builder->portableAt(output_index).get();
+  auto input_tensor = _tensor_builder->portableAt(input_index).get();
+  auto weights_scales_tensor = _tensor_builder->portableAt(weights_scales_index).get();
+  auto weights_binary_tensor = _tensor_builder->portableAt(weights_binary_index).get();
+  auto bias_tensor =
+      bias_index.undefined() ? nullptr : _tensor_builder->portableAt(bias_index).get();
+  auto weights_clusters_tensor = _tensor_builder->portableAt(weights_clusters_index).get();
+
+  auto fn = std::make_unique<ops::BCQFullyConnectedLayer>();
+
+  fn->configure(input_tensor, weights_scales_tensor, weights_binary_tensor, bias_tensor,
+                weights_clusters_tensor, node.param().weights_hidden_size,
+                node.param().activation, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::BCQGather &node)
+{
+  using ir::operation::BCQGather;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_scales_index{node.getInputs().at(BCQGather::Input::INPUT_SCALES)};
+  const auto input_binary_index{node.getInputs().at(BCQGather::Input::INPUT_BINARY)};
+  const auto indices_index{node.getInputs().at(BCQGather::Input::INDICES)};
+  const auto input_clusters_index{node.getInputs().at(BCQGather::Input::INPUT_CLUSTERS)};
+
+  auto output_tensor = _tensor_builder->portableAt(output_index).get();
+  auto input_scales_tensor = _tensor_builder->portableAt(input_scales_index).get();
+  auto input_binary_tensor = _tensor_builder->portableAt(input_binary_index).get();
+  auto indices_tensor = _tensor_builder->portableAt(indices_index).get();
+  auto input_clusters_tensor = _tensor_builder->portableAt(input_clusters_index).get();
+
+  auto fn = std::make_unique<ops::BCQGatherLayer>();
+
+  fn->configure(input_scales_tensor, input_binary_tensor, indices_tensor, input_clusters_tensor,
+                node.param().input_hidden_size, node.param().axis, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::EmbeddingLookup &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto lookups_index{node.getInputs().at(ir::operation::EmbeddingLookup::Input::LOOKUPS)};
+  const auto values_index{node.getInputs().at(ir::operation::EmbeddingLookup::Input::VALUES)};
+
+  auto output_tensor = _tensor_builder->portableAt(output_index).get();
+  auto lookups_tensor = _tensor_builder->portableAt(lookups_index).get();
+  auto values_tensor = _tensor_builder->portableAt(values_index).get();
+
+  auto fn = std::make_unique<ops::EmbeddingLookupLayer>();
+
+  fn->configure(lookups_tensor, values_tensor, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::HashtableLookup &node)
+{
+  const auto output_index{node.getOutputs().at(ir::operation::HashtableLookup::Output::OUTPUT)};
+  const auto hits_index{node.getOutputs().at(ir::operation::HashtableLookup::Output::HITS)};
+  const auto lookups_index{node.getInputs().at(ir::operation::HashtableLookup::Input::LOOKUPS)};
+  const auto keys_index{node.getInputs().at(ir::operation::HashtableLookup::Input::KEYS)};
+  const auto values_index{node.getInputs().at(ir::operation::HashtableLookup::Input::VALUES)};
+
+  auto output_tensor = _tensor_builder->portableAt(output_index).get();
+  auto hits_tensor = _tensor_builder->portableAt(hits_index).get();
+  auto lookups_tensor = _tensor_builder->portableAt(lookups_index).get();
+  auto keys_tensor = _tensor_builder->portableAt(keys_index).get();
+  auto values_tensor = _tensor_builder->portableAt(values_index).get();
+
+  auto fn = std::make_unique<ops::HashtableLookupLayer>();
+
+  fn->configure(lookups_tensor, keys_tensor, values_tensor, output_tensor, hits_tensor);
+
+  _return_fn = std::move(fn);
+}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
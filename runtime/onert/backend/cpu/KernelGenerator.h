@@ -74,6 +74,7 @@ public:
   void visit(const ir::operation::OneHot &) override;
   void visit(const ir::operation::Cast &) override;
   void visit(const ir::operation::Transpose &) override;
+  void visit(const ir::operation::TransposeConv &) override;
   void visit(const ir::operation::Reduce &) override;
   void visit(const ir::operation::ReLU &) override;
   void visit(const ir::operation::ReLU6 &) override;
@@ -87,6 +88,7 @@ public:
   void visit(const ir::operation::RSQRT &) override;
   void visit(const ir::operation::Shape &) override;
   void visit(const ir::operation::ResizeBilinear &node) override;
+  void visit(const ir::operation::ResizeNearestNeighbor &node) override;
   void visit(const ir::operation::Reverse &) override;
   void visit(const ir::operation::Neg &) override;
   void visit(const ir::operation::ArgMax &) override;
@@ -99,6 +101,9 @@ public:
   void visit(const ir::operation::Tile &) override;
   void visit(const ir::operation::LogicalOr &) override;
   void visit(const ir::operation::L2Normalization &) override;
+  void visit(const ir::operation::InstanceNorm &) override;
+  void visit(const ir::operation::PReLU &) override;
+  void visit(const ir::operation::LocalResponseNormalization &) override;
   void visit(const ir::operation::Range &) override;
   void visit(const ir::operation::MatrixBandPart &) override;
   void visit(const ir::operation::BatchMatMul &) override;
@@ -110,6 +115,17 @@ public:
   void visit(const ir::operation::SpaceToDepth &) override;
   void visit(const ir::operation::StatelessRandomUniform &) override;
   void visit(const ir::operation::SplitV &) override;
+  void visit(const ir::operation::LSTM &) override;
+  void visit(const ir::operation::RNN &) override;
+  void visit(const ir::operation::BCQFullyConnected &) override;
+  void visit(const ir::operation::BCQGather &) override;
+  void visit(const ir::operation::EmbeddingLookup &) override;
+  void visit(const ir::operation::HashtableLookup &) override;
+
+private:
+  // Generates the function of node that also applies the elementwise operation next to its
+  // output tiles, if next can be fused into node
+  bool fuseEpilogue(const ir::Operation &node, const ir::Operation &next);
 
 private:
   const ir::Operands &_ctx;
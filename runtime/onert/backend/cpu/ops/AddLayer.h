@@ -42,7 +42,7 @@ public:
 public:
   void addFloat32();
 
-  void addQuant8();
+  template <typename T> void addQuant8();
 
   void addInt32();
 
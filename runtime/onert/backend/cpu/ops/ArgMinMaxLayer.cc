@@ -31,18 +31,25 @@ namespace ops
 {
 namespace
 {
-template <typename T> std::function<bool(T, T)> GetComparefunction(bool is_arg_max)
+// Comparator is passed as a type to be inlined into the kernel
+template <typename T, typename Out>
+void argMinMax(const IPortableTensor *input, IPortableTensor *output, int32_t axis,
+               bool is_arg_max)
 {
   if (is_arg_max)
   {
-    return std::greater<T>();
+    nnfw::cker::ArgMinMax(getTensorShape(input), reinterpret_cast<const T *>(input->buffer()),
+                          getTensorShape(output), reinterpret_cast<Out *>(output->buffer()), axis,
+                          std::greater<T>());
   }
   else
   {
-    return std::less<T>();
+    nnfw::cker::ArgMinMax(getTensorShape(input), reinterpret_cast<const T *>(input->buffer()),
+                          getTensorShape(output), reinterpret_cast<Out *>(output->buffer()), axis,
+                          std::less<T>());
   }
 }
-}
+} // namespace
 
 void ArgMinMaxLayer::configure(const IPortableTensor *input, IPortableTensor *output, int32_t axis,
                                bool is_arg_max)
@@ -59,10 +66,8 @@ void ArgMinMaxLayer::configure(const IPortableTensor *input, IPortableTensor *ou
 
 void ArgMinMaxLayer::run()
 {
-#define TF_LITE_ARG_MIN_MAX(input_type, axis_type, output_type)                                 \
-  ArgMinMax(getTensorShape(_input), reinterpret_cast<const input_type *>(_input->buffer()),     \
-            getTensorShape(_output), reinterpret_cast<output_type *>(_output->buffer()), _axis, \
-            GetComparefunction<input_type>(_is_arg_max));
+#define TF_LITE_ARG_MIN_MAX(input_type, axis_type, output_type) \
+  argMinMax<input_type, output_type>(_input, _output, _axis, _is_arg_max);
   if (_output->data_type() == ir::DataType::INT32)
   {
     switch (_input->data_type())
@@ -56,19 +56,19 @@ void AvgPoolLayer::averagePoolFloat32()
                           reinterpret_cast<const float *>(_input->buffer()),
                           getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
 }
-void AvgPoolLayer::averagePoolQuant8()
+template <typename T> void AvgPoolLayer::averagePoolQuant8()
 {
   AVGPOOLING_PARAMETERS
   int32_t output_activation_min = 0;
   int32_t output_activation_max = 0;
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
   op_params.quantized_activation_min = output_activation_min;
   op_params.quantized_activation_max = output_activation_max;
 
   nnfw::cker::AveragePool(op_params, getTensorShape(_input),
-                          reinterpret_cast<const uint8_t *>(_input->buffer()),
-                          getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
+                          reinterpret_cast<const T *>(_input->buffer()),
+                          getTensorShape(_output), reinterpret_cast<T *>(_output->buffer()));
 }
 
 void AvgPoolLayer::configure(const IPortableTensor *input, const uint32_t paddingLeft,
@@ -102,7 +102,11 @@ void AvgPoolLayer::run()
   }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
-    averagePoolQuant8();
+    averagePoolQuant8<uint8_t>();
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    averagePoolQuant8<int8_t>();
   }
   else
   {
@@ -39,7 +39,7 @@ public:
 public:
   void averagePoolFloat32();
 
-  void averagePoolQuant8();
+  template <typename T> void averagePoolQuant8();
 
   void configure(const IPortableTensor *input, const uint32_t paddingLeft,
                  const uint32_t paddingRight, const uint32_t paddingTop,
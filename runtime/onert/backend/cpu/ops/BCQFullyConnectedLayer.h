@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_BCQFULLYCONNECTEDLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_BCQFULLYCONNECTEDLAYER_H__
+
+#include <backend/IPortableTensor.h>
+#include "OperationUtils.h"
+
+#include <exec/IFunction.h>
+
+#include <memory>
+
+namespace nnfw
+{
+namespace cker
+{
+class BCQTempArena;
+}
+} // namespace nnfw
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class BCQFullyConnectedLayer : public ::onert::exec::IFunction
+{
+public:
+  BCQFullyConnectedLayer();
+  ~BCQFullyConnectedLayer();
+
+public:
+  void configure(const IPortableTensor *input, const IPortableTensor *weights_scales,
+                 const IPortableTensor *weights_binary, const IPortableTensor *bias,
+                 const IPortableTensor *weights_clusters, uint32_t weights_hidden_size,
+                 ir::Activation activation, IPortableTensor *output);
+
+  void run() override;
+
+private:
+  const IPortableTensor *_input;
+  const IPortableTensor *_weights_scales;
+  const IPortableTensor *_weights_binary;
+  const IPortableTensor *_bias;
+  const IPortableTensor *_weights_clusters;
+  IPortableTensor *_output;
+
+  uint32_t _weights_hidden_size;
+  ir::Activation _activation;
+
+  std::unique_ptr<nnfw::cker::BCQTempArena> _temp_arena;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_BCQFULLYCONNECTEDLAYER_H__
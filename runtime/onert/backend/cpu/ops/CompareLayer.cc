@@ -85,9 +85,9 @@ void compareQuant8(const IPortableTensor *lhs, const IPortableTensor *rhs, IPort
 
   CompareFunction fn = (params.is_broadcast ? broadcast_fns[index] : non_broadcast_fns[index]);
 
-  fn(params, getExtendedTensorShape(lhs), reinterpret_cast<const T *>(lhs->buffer()),
-     getExtendedTensorShape(rhs), reinterpret_cast<const T *>(rhs->buffer()),
-     getExtendedTensorShape(output), reinterpret_cast<bool *>(output->buffer()));
+  fn(params, getTensorShape(lhs), reinterpret_cast<const T *>(lhs->buffer()),
+     getTensorShape(rhs), reinterpret_cast<const T *>(rhs->buffer()),
+     getTensorShape(output), reinterpret_cast<bool *>(output->buffer()));
 }
 
 template <typename T>
@@ -118,9 +118,9 @@ void compareScalar(const IPortableTensor *lhs, const IPortableTensor *rhs, IPort
 
   CompareFunction fn = (requires_broadcast ? broadcast_fns[index] : non_broadcast_fns[index]);
 
-  fn(getExtendedTensorShape(lhs), reinterpret_cast<const T *>(lhs->buffer()),
-     getExtendedTensorShape(rhs), reinterpret_cast<const T *>(rhs->buffer()),
-     getExtendedTensorShape(output), reinterpret_cast<bool *>(output->buffer()));
+  fn(getTensorShape(lhs), reinterpret_cast<const T *>(lhs->buffer()),
+     getTensorShape(rhs), reinterpret_cast<const T *>(rhs->buffer()),
+     getTensorShape(output), reinterpret_cast<bool *>(output->buffer()));
 }
 
 } // namespace
@@ -19,6 +19,10 @@
 #include "../Tensor.h"
 #include "ir/Padding.h"
 #include <cker/operation/Conv.h>
+#include <cker/operation/ConvHybrid.h>
+#include <cker/operation/ConvInt8.h>
+
+#include <cstring>
 
 namespace onert
 {
@@ -32,7 +36,12 @@ ConvolutionLayer::ConvolutionLayer()
     : _input(nullptr), _kernel(nullptr), _bias(nullptr), _output(nullptr),
       _paddingType(ir::PaddingType::EXPLICIT), _paddingLeft(0), _paddingTop(0), _paddingRight(0),
       _paddingBottom(0), _strideWidth(0), _strideHeight(0), _activation(ir::Activation::NONE),
-      _conv_kernel(new nnfw::cker::Conv()), _prepare(false)
+      _epilogue_type(nnfw::cker::FusedEpilogueType::kNone), _epilogue_operand(nullptr),
+      _epilogue_per_channel(false), _epilogue_activation(ir::Activation::NONE),
+      _epilogue_output(nullptr), _epilogue_applied(false), _conv_kernel(new nnfw::cker::Conv()),
+      _external_context(nullptr), _is_hybrid(false),
+      _hybrid_temp_arena(new nnfw::cker::ConvHybridTempArena()), _per_channel_scales(),
+      _per_channel_multipliers(), _per_channel_shifts(), _im2col_data(), _prepare(false)
 {
   // DO NOTHING
 }
@@ -55,19 +64,49 @@ void ConvolutionLayer::convFloat32()
   op_params.float_activation_min = output_activation_min;
   op_params.float_activation_max = output_activation_max;
 
+  IPortableTensor *output = _output;
+  _epilogue_applied = _epilogue_type != nnfw::cker::FusedEpilogueType::kNone &&
+                      !_input->is_dynamic() && !_output->is_dynamic() &&
+                      !_epilogue_operand->is_dynamic() && !_epilogue_output->is_dynamic();
+  if (_epilogue_applied)
+  {
+    op_params.epilogue.type = _epilogue_type;
+    op_params.epilogue.operand_data = reinterpret_cast<const float *>(_epilogue_operand->buffer());
+    op_params.epilogue.per_channel = _epilogue_per_channel;
+    CalculateActivationRange(_epilogue_activation, &op_params.epilogue.float_activation_min,
+                             &op_params.epilogue.float_activation_max);
+
+    // The memory planner may place the fused output on any input of this Conv, such as a kernel
+    // dequantized at run time, because inputs are released before the fused operation. Then the
+    // Conv output holds the result until the inputs are read.
+    const uint8_t *fused_begin = _epilogue_output->buffer();
+    const uint8_t *fused_end = fused_begin + _epilogue_output->total_size();
+    auto overlapped = [&](const IPortableTensor *tensor) {
+      if (tensor == nullptr || tensor->buffer() == nullptr)
+        return false;
+      const uint8_t *begin = tensor->buffer();
+      return begin < fused_end && fused_begin < begin + tensor->total_size();
+    };
+    if (!overlapped(_input) && !overlapped(_kernel) && !overlapped(_bias))
+      output = _epilogue_output;
+  }
+
   nnfw::cker::Conv &kernel = *_conv_kernel;
   kernel(op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
          getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
          getTensorShape(_bias), reinterpret_cast<const float *>(_bias->buffer()),
-         getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+         getTensorShape(output), reinterpret_cast<float *>(output->buffer()));
+
+  if (_epilogue_applied && output == _output)
+    std::memcpy(_epilogue_output->buffer(), _output->buffer(), _output->total_size());
 }
 
 void ConvolutionLayer::convQuant8()
 {
   int32_t output_activation_min = 0;
   int32_t output_activation_max = 0;
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
 
   double real_multiplier = 0.0;
   int32_t output_multiplier = 0;
@@ -99,12 +138,66 @@ void ConvolutionLayer::convQuant8()
          getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void ConvolutionLayer::convQuant8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.input_offset = -_input->data_offset();
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::ConvPerChannel(
+      op_params, _per_channel_multipliers.data(), _per_channel_shifts.data(),
+      getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+      getTensorShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()),
+      getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+      getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()), _im2col_data,
+      _external_context->ruy_context());
+}
+
+void ConvolutionLayer::convHybrid()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  nnfw::cker::ConvHybridPerChannel(
+      op_params, _per_channel_scales.data(), getTensorShape(_input),
+      reinterpret_cast<const float *>(_input->buffer()), getTensorShape(_kernel),
+      reinterpret_cast<const int8_t *>(_kernel->buffer()), getTensorShape(_bias),
+      reinterpret_cast<const float *>(_bias->buffer()), getTensorShape(_output),
+      reinterpret_cast<float *>(_output->buffer()), *_hybrid_temp_arena,
+      _external_context->ruy_context());
+}
+
 void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
                                  const IPortableTensor *bias, const ir::PaddingType paddingType,
                                  const uint32_t paddingLeft, const uint32_t paddingRight,
                                  const uint32_t paddingTop, const uint32_t paddingBottom,
                                  const uint32_t strideWidth, const uint32_t strideHeight,
-                                 const ir::Activation activation, IPortableTensor *output)
+                                 const ir::Activation activation, IPortableTensor *output,
+                                 const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _kernel = kernel;
@@ -118,6 +211,38 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
   _strideHeight = strideHeight;
   _activation = activation;
   _output = output;
+  _external_context = external_context;
+  _is_hybrid = input->data_type() == OperandType::FLOAT32 &&
+               kernel->data_type() == OperandType::QUANT_INT8_SYMM;
+  const int output_depth = getTensorShape(kernel).Dims(0);
+  if (_is_hybrid)
+  {
+    // Kernel without per-channel scales shares one scale over all output channels
+    const auto &kernel_scales = kernel->data_scales();
+    if (kernel_scales.empty())
+      _per_channel_scales.assign(output_depth, kernel->data_scale());
+    else
+      _per_channel_scales = kernel_scales;
+  }
+  else if (input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    if (kernel->data_type() != OperandType::QUANT_INT8_SYMM)
+      throw std::runtime_error{"Conv: int8 input requires int8 symmetric kernel"};
+    GetQuantizedConvolutionMultipliersAndShifts(_input, _kernel, _output, output_depth,
+                                                &_per_channel_multipliers, &_per_channel_shifts);
+  }
+}
+
+void ConvolutionLayer::configureEpilogue(nnfw::cker::FusedEpilogueType type,
+                                         const IPortableTensor *operand, bool per_channel,
+                                         const ir::Activation activation, IPortableTensor *output)
+{
+  assert(_input->data_type() == OperandType::FLOAT32 && !_is_hybrid);
+  _epilogue_type = type;
+  _epilogue_operand = operand;
+  _epilogue_per_channel = per_channel;
+  _epilogue_activation = activation;
+  _epilogue_output = output;
 }
 
 void ConvolutionLayer::run()
@@ -152,7 +277,11 @@ void ConvolutionLayer::run()
     _paddingTop = padding.top;
     _paddingBottom = padding.bottom;
   }
-  if (_input->data_type() == OperandType::FLOAT32)
+  if (_is_hybrid)
+  {
+    convHybrid();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32)
   {
     convFloat32();
   }
@@ -160,6 +289,10 @@ void ConvolutionLayer::run()
   {
     convQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    convQuant8PerChannel();
+  }
   else
   {
     throw std::runtime_error{"Conv: unsupported data type"};
@@ -172,11 +305,12 @@ void ConvolutionLayer::prepare()
     return;
 
   nnfw::cker::Conv &kernel = *_conv_kernel;
-  if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
+  if (_input->data_type() == OperandType::FLOAT32 &&
+      _kernel->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
   {
     bool is_transposed = false;
     kernel.prepare(getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
-                   getPaddingType(_paddingType), is_transposed);
+                   getPaddingType(_paddingType), is_transposed, _strideWidth, _strideHeight);
 
     // Decrease reference of _kernel(weights) only when _kernel is constant
     if (is_transposed)
@@ -18,17 +18,20 @@
 #define __ONERT_BACKEND_CPU_OPS_CONVOLUTIONLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace nnfw
 {
 namespace cker
 {
 class Conv;
+class ConvHybridTempArena;
 }
 } // namespace nnfw
 
@@ -52,12 +55,27 @@ public:
 
   void convQuant8();
 
+  void convQuant8PerChannel();
+
+  void convHybrid();
+
   void configure(const IPortableTensor *input, const IPortableTensor *kernel,
                  const IPortableTensor *bias, ir::PaddingType _paddingType,
                  const uint32_t paddingLeft, const uint32_t paddingRight, const uint32_t paddingTop,
                  const uint32_t paddingBottom, const uint32_t strideWidth,
                  const uint32_t strideHeight, const ir::Activation activation,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
+
+  // Fuses an elementwise operation that follows this Conv, so that the result of the operation
+  // is written to output instead of the Conv output
+  // @note operand has the shape of the Conv output, or the output depth if per_channel is true
+  void configureEpilogue(nnfw::cker::FusedEpilogueType type, const IPortableTensor *operand,
+                         bool per_channel, const ir::Activation activation,
+                         IPortableTensor *output);
+
+  // Returns whether the last run wrote the result of the fused operation. It is not fused while
+  // tensors are dynamic, because the output of the operation is not allocated yet.
+  bool epilogueApplied() const { return _epilogue_applied; }
 
   void run() override;
 
@@ -80,8 +98,28 @@ private:
 
   ir::Activation _activation;
 
+  // Float only
+  nnfw::cker::FusedEpilogueType _epilogue_type;
+  const IPortableTensor *_epilogue_operand;
+  bool _epilogue_per_channel;
+  ir::Activation _epilogue_activation;
+  IPortableTensor *_epilogue_output;
+  bool _epilogue_applied;
+
   std::unique_ptr<nnfw::cker::Conv> _conv_kernel;
 
+  std::shared_ptr<ExternalContext> _external_context;
+
+  // Float input with int8 symmetric kernel
+  bool _is_hybrid;
+  std::unique_ptr<nnfw::cker::ConvHybridTempArena> _hybrid_temp_arena;
+  std::vector<float> _per_channel_scales;
+
+  // Int8 asymmetric input and output
+  std::vector<int32_t> _per_channel_multipliers;
+  std::vector<int> _per_channel_shifts;
+  std::vector<int8_t> _im2col_data;
+
   bool _prepare;
 };
 
@@ -16,6 +16,8 @@
 
 #include "DepthwiseConvolutionLayer.h"
 
+#include <cker/operation/ConvHybrid.h>
+#include <cker/operation/ConvInt8.h>
 #include <cker/operation/DepthwiseConv.h>
 
 namespace onert
@@ -30,11 +32,15 @@ namespace ops
 DepthwiseConvolutionLayer::DepthwiseConvolutionLayer()
     : _input(nullptr), _kernel(nullptr), _bias(nullptr), _output(nullptr), _paddingLeft(0),
       _paddingTop(0), _paddingRight(0), _paddingBottom(0), _strideWidth(0), _strideHeight(0),
-      _multiplier(0), _activation(ir::Activation::NONE)
+      _multiplier(0), _activation(ir::Activation::NONE), _is_hybrid(false),
+      _hybrid_temp_arena(new nnfw::cker::ConvHybridTempArena()), _per_channel_scales(),
+      _per_channel_multipliers(), _per_channel_shifts()
 {
   // DO NOTHING
 }
 
+DepthwiseConvolutionLayer::~DepthwiseConvolutionLayer() = default;
+
 void DepthwiseConvolutionLayer::convFloat32()
 {
   float output_activation_min = 0, output_activation_max = 0;
@@ -62,8 +68,8 @@ void DepthwiseConvolutionLayer::convQuant8()
 {
   int32_t output_activation_min = 0;
   int32_t output_activation_max = 0;
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
 
   double real_multiplier = 0.0;
   int32_t output_multiplier = 0;
@@ -94,6 +100,58 @@ void DepthwiseConvolutionLayer::convQuant8()
       getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void DepthwiseConvolutionLayer::convQuant8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  op_params.input_offset = -_input->data_offset();
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::DepthwiseConvPerChannel(
+      op_params, _per_channel_multipliers.data(), _per_channel_shifts.data(),
+      getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+      getTensorShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()),
+      getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+      getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()));
+}
+
+void DepthwiseConvolutionLayer::convHybrid()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  nnfw::cker::DepthwiseConvHybridPerChannel(
+      op_params, _per_channel_scales.data(), getTensorShape(_input),
+      reinterpret_cast<const float *>(_input->buffer()), getTensorShape(_kernel),
+      reinterpret_cast<const int8_t *>(_kernel->buffer()), getTensorShape(_bias),
+      reinterpret_cast<const float *>(_bias->buffer()), getTensorShape(_output),
+      reinterpret_cast<float *>(_output->buffer()), *_hybrid_temp_arena);
+}
+
 void DepthwiseConvolutionLayer::configure(const IPortableTensor *input,
                                           const IPortableTensor *kernel,
                                           const IPortableTensor *bias, const uint32_t paddingLeft,
@@ -114,11 +172,34 @@ void DepthwiseConvolutionLayer::configure(const IPortableTensor *input,
   _multiplier = multiplier;
   _activation = activation;
   _output = output;
+  _is_hybrid = input->data_type() == OperandType::FLOAT32 &&
+               kernel->data_type() == OperandType::QUANT_INT8_SYMM;
+  const int output_depth = getTensorShape(kernel).Dims(3);
+  if (_is_hybrid)
+  {
+    // Kernel without per-channel scales shares one scale over all output channels
+    const auto &kernel_scales = kernel->data_scales();
+    if (kernel_scales.empty())
+      _per_channel_scales.assign(output_depth, kernel->data_scale());
+    else
+      _per_channel_scales = kernel_scales;
+  }
+  else if (input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    if (kernel->data_type() != OperandType::QUANT_INT8_SYMM)
+      throw std::runtime_error{"DepthwiseConv: int8 input requires int8 symmetric kernel"};
+    GetQuantizedConvolutionMultipliersAndShifts(_input, _kernel, _output, output_depth,
+                                                &_per_channel_multipliers, &_per_channel_shifts);
+  }
 }
 
 void DepthwiseConvolutionLayer::run()
 {
-  if (_input->data_type() == OperandType::FLOAT32)
+  if (_is_hybrid)
+  {
+    convHybrid();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32)
   {
     convFloat32();
   }
@@ -126,6 +207,10 @@ void DepthwiseConvolutionLayer::run()
   {
     convQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    convQuant8PerChannel();
+  }
   else
   {
     throw std::runtime_error{"DepthwiseConv: unsupported data type"};
@@ -22,6 +22,17 @@
 
 #include <exec/IFunction.h>
 
+#include <memory>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+class ConvHybridTempArena;
+}
+} // namespace nnfw
+
 namespace onert
 {
 namespace backend
@@ -35,12 +46,17 @@ class DepthwiseConvolutionLayer : public ::onert::exec::IFunction
 {
 public:
   DepthwiseConvolutionLayer();
+  ~DepthwiseConvolutionLayer();
 
 public:
   void convFloat32();
 
   void convQuant8();
 
+  void convQuant8PerChannel();
+
+  void convHybrid();
+
   void configure(const IPortableTensor *input, const IPortableTensor *kernel,
                  const IPortableTensor *bias, const uint32_t paddingLeft,
                  const uint32_t paddingRight, const uint32_t paddingTop,
@@ -67,6 +83,15 @@ private:
   uint32_t _multiplier;
 
   ir::Activation _activation;
+
+  // Float input with int8 symmetric kernel
+  bool _is_hybrid;
+  std::unique_ptr<nnfw::cker::ConvHybridTempArena> _hybrid_temp_arena;
+  std::vector<float> _per_channel_scales;
+
+  // Int8 asymmetric input and output
+  std::vector<int32_t> _per_channel_multipliers;
+  std::vector<int> _per_channel_shifts;
 };
 
 } // namespace ops
@@ -55,8 +55,8 @@ void DivLayer::divFloat32()
 void DivLayer::divQuant8()
 {
   int32_t output_activation_min, output_activation_max;
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
   // op_params.quantized_activation_max = output_activation_max;
   // op_params.quantized_activation_min = output_activation_min;
 
@@ -40,8 +40,6 @@ void EinsumLayer::einsumFloat32()
   uint32_t num_inputs = _inputs.size();
   nnfw::cker::Einsum &kernel = *_einsum_kernel;
 
-  kernel.prepare(_equation);
-
   std::vector<nnfw::cker::Shape> inputShapes;
   std::vector<const float *> inputFloatPtrs;
 
@@ -67,6 +65,23 @@ void EinsumLayer::run()
   }
 }
 
+void EinsumLayer::prepare()
+{
+  if (_output->data_type() != OperandType::FLOAT32 || _output->is_dynamic())
+    return;
+
+  std::vector<nnfw::cker::Shape> inputShapes;
+  for (const auto input : _inputs)
+  {
+    if (input->is_dynamic())
+      return;
+    inputShapes.emplace_back(getTensorShape(input));
+  }
+
+  // Shapes are known, so the contraction plan is compiled before the first run
+  _einsum_kernel->prepare(_equation, inputShapes);
+}
+
 void EinsumLayer::configure(const std::vector<const IPortableTensor *> &inputs,
                             std::string equation, IPortableTensor *output)
 {
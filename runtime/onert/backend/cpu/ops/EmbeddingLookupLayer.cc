@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "EmbeddingLookupLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/Gather.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+void EmbeddingLookupLayer::configure(const IPortableTensor *lookups,
+                                     const IPortableTensor *values, IPortableTensor *output)
+{
+  _lookups = lookups;
+  _values = values;
+  _output = output;
+}
+
+void EmbeddingLookupLayer::run()
+{
+  const auto lookups_shape = getTensorShape(_lookups);
+  const auto lookups_data = reinterpret_cast<const int32_t *>(_lookups->buffer());
+  const int32_t num_rows = _values->dimension(0);
+  for (int i = 0; i < lookups_shape.FlatSize(); ++i)
+  {
+    if (lookups_data[i] < 0 || lookups_data[i] >= num_rows)
+      throw std::runtime_error{"EmbeddingLookup: lookup index out of range"};
+  }
+
+  // Rows are copied as bytes, which covers every data type of values
+  nnfw::cker::GatherParams op_params;
+  op_params.axis = 0;
+  nnfw::cker::Gather(op_params, getByteRowsShape(_values), _values->buffer(), lookups_shape,
+                     lookups_data, getByteRowsShape(_output), _output->buffer());
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
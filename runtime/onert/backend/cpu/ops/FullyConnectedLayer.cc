@@ -18,6 +18,7 @@
 
 #include "../Tensor.h"
 #include <cker/operation/FullyConnected.h>
+#include <cker/operation/FullyConnectedFp16.h>
 #include <cker/TensorUtils.h>
 #include <misc/polymorphic_downcast.h>
 
@@ -33,7 +34,8 @@ namespace ops
 FullyConnectedLayer::FullyConnectedLayer()
     : _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr),
       _activation(ir::Activation::NONE), _temp_arena(new nnfw::cker::FCTempArena()),
-      _external_context(nullptr), _is_hybrid(false)
+      _external_context(nullptr), _is_hybrid(false), _use_fp16_weights(false), _fp16_weights(),
+      _widened_weights()
 {
   // DO NOTHING
 }
@@ -68,8 +70,8 @@ void FullyConnectedLayer::fullyConnectedQuant8()
   int32_t output_activation_max = 0;
   GetQuantizedConvolutionMultiplier(_input, _weights, _bias, _output, &real_multiplier);
   QuantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
 
   nnfw::cker::FullyConnectedParams op_params;
   op_params.input_offset = -_input->data_offset();
@@ -87,6 +89,35 @@ void FullyConnectedLayer::fullyConnectedQuant8()
       getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void FullyConnectedLayer::fullyConnectedInt8()
+{
+  double real_multiplier = 0.0;
+  int32_t output_multiplier = 0;
+  int32_t output_shift = 0;
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  GetQuantizedConvolutionMultiplier(_input, _weights, _bias, _output, &real_multiplier);
+  QuantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.input_offset = -_input->data_offset();
+  op_params.weights_offset = -_weights->data_offset();
+  op_params.output_offset = _output->data_offset();
+  op_params.output_multiplier = output_multiplier;
+  op_params.output_shift = output_shift;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::FullyConnected(
+      op_params, getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+      getTensorShape(_weights), reinterpret_cast<const int8_t *>(_weights->buffer()),
+      getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias ? _bias->buffer() : nullptr),
+      getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()),
+      _external_context->ruy_context());
+}
+
 void FullyConnectedLayer::fullyConnectedHybrid()
 {
   nnfw::cker::FCTempArena &temp_arena = *_temp_arena;
@@ -148,10 +179,27 @@ void FullyConnectedLayer::fullyConnectedHybrid()
 #endif
 }
 
+void FullyConnectedLayer::fullyConnectedFp16Weights()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  nnfw::cker::FullyConnectedFp16Weights(
+      op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+      getTensorShape(_weights), _fp16_weights.data(), getTensorShape(_bias),
+      reinterpret_cast<const float *>(_bias ? _bias->buffer() : nullptr), getTensorShape(_output),
+      reinterpret_cast<float *>(_output->buffer()), _widened_weights.data());
+}
+
 void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
                                     const IPortableTensor *bias, ir::Activation activation,
                                     IPortableTensor *output,
-                                    const std::shared_ptr<ExternalContext> &external_context)
+                                    const std::shared_ptr<ExternalContext> &external_context,
+                                    bool fp16_weights)
 {
   _input = input;
   _weights = weights;
@@ -161,6 +209,11 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
   _is_hybrid = input->data_type() == OperandType::FLOAT32 &&
                weights->data_type() == OperandType::QUANT_INT8_SYMM;
   _external_context = external_context;
+  _use_fp16_weights = fp16_weights;
+
+  // FullyConnected weights are quantized per tensor
+  if (!weights->data_scales().empty())
+    throw std::runtime_error{"FullyConnected: per-channel quantized weights are not supported"};
 }
 
 void FullyConnectedLayer::run()
@@ -169,6 +222,10 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedHybrid();
   }
+  else if (!_fp16_weights.empty())
+  {
+    fullyConnectedFp16Weights();
+  }
   else if (_input->data_type() == OperandType::FLOAT32)
   {
     fullyConnectedFloat32();
@@ -177,6 +234,10 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    fullyConnectedInt8();
+  }
   else
   {
     throw std::runtime_error{"FullyConnected: unsupported data type"};
@@ -194,6 +255,23 @@ void FullyConnectedLayer::prepare()
     }
   }
 
+  if (_use_fp16_weights && _fp16_weights.empty() && _input->data_type() == OperandType::FLOAT32 &&
+      _weights->data_type() == OperandType::FLOAT32 && _weights->is_constant())
+  {
+    const auto weights_shape = getTensorShape(_weights);
+    _fp16_weights.resize(weights_shape.FlatSize());
+    nnfw::cker::FloatToFp16(reinterpret_cast<const float *>(_weights->buffer()),
+                            weights_shape.FlatSize(), _fp16_weights.data());
+    _widened_weights.resize(nnfw::cker::FullyConnectedFp16WidenedRows(weights_shape) *
+                            weights_shape.Dims(1));
+
+    // Float weights are not used any more
+    auto weights_tensor = dynamic_cast<const Tensor *>(_weights);
+    if (weights_tensor)
+      // TODO Remove const_cast
+      const_cast<Tensor *>(weights_tensor)->decrease_ref();
+  }
+
 #if defined(__ARM_NEON__) && defined(USE_RUY_GEMV)
   // TODO This is workaround
   // The only fc hybrid will use ruy kernel
@@ -23,6 +23,8 @@
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace nnfw
 {
 namespace cker
@@ -51,11 +53,19 @@ public:
 
   void fullyConnectedQuant8();
 
+  void fullyConnectedInt8();
+
   void fullyConnectedHybrid();
 
+  void fullyConnectedFp16Weights();
+
+  /**
+   * @param fp16_weights  Whether constant float weights are kept in half precision
+   */
   void configure(const IPortableTensor *input, const IPortableTensor *weights,
                  const IPortableTensor *bias, ir::Activation activation, IPortableTensor *output,
-                 const std::shared_ptr<ExternalContext> &external_context);
+                 const std::shared_ptr<ExternalContext> &external_context,
+                 bool fp16_weights);
 
   void run() override;
 
@@ -74,6 +84,10 @@ private:
 
   bool _is_hybrid;
 
+  bool _use_fp16_weights;
+  std::vector<uint16_t> _fp16_weights;
+  std::vector<float> _widened_weights;
+
 #ifdef USE_RUY_GEMV
   uint8_t *_cached_weights = nullptr; // weights to be cached and a key
   bool _is_weights_freed = false;     // is weights freed?
@@ -81,6 +81,9 @@ void GatherLayer::run()
     case OperandType::QUANT_UINT8_ASYMM:
       runByInputType<uint8_t>();
       break;
+    case OperandType::QUANT_INT8_ASYMM:
+      runByInputType<int8_t>();
+      break;
     case OperandType::INT32:
       runByInputType<int32_t>();
       break;
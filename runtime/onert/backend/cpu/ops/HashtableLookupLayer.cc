@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HashtableLookupLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/HashtableLookup.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+HashtableLookupLayer::HashtableLookupLayer()
+    : _lookups(nullptr), _keys(nullptr), _values(nullptr), _output(nullptr), _hits(nullptr),
+      _kernel(new nnfw::cker::HashtableLookup())
+{
+  // DO NOTHING
+}
+
+HashtableLookupLayer::~HashtableLookupLayer() = default;
+
+void HashtableLookupLayer::configure(const IPortableTensor *lookups, const IPortableTensor *keys,
+                                     const IPortableTensor *values, IPortableTensor *output,
+                                     IPortableTensor *hits)
+{
+  _lookups = lookups;
+  _keys = keys;
+  _values = values;
+  _output = output;
+  _hits = hits;
+}
+
+void HashtableLookupLayer::prepare()
+{
+  // Index of constant keys is built only once
+  if (_keys->is_constant())
+  {
+    _kernel->prepare(getTensorShape(_keys), reinterpret_cast<const int32_t *>(_keys->buffer()));
+  }
+}
+
+void HashtableLookupLayer::run()
+{
+  if (!_keys->is_constant())
+  {
+    _kernel->prepare(getTensorShape(_keys), reinterpret_cast<const int32_t *>(_keys->buffer()));
+  }
+
+  // Rows are copied as bytes, which covers every data type of values
+  (*_kernel)(getTensorShape(_lookups), reinterpret_cast<const int32_t *>(_lookups->buffer()),
+             getByteRowsShape(_values), _values->buffer(), getByteRowsShape(_output),
+             _output->buffer(), _hits->buffer());
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_HASHTABLELOOKUPLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_HASHTABLELOOKUPLAYER_H__
+
+#include <backend/IPortableTensor.h>
+
+#include <exec/IFunction.h>
+
+#include <memory>
+
+namespace nnfw
+{
+namespace cker
+{
+class HashtableLookup;
+}
+} // namespace nnfw
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class HashtableLookupLayer : public ::onert::exec::IFunction
+{
+public:
+  HashtableLookupLayer();
+  ~HashtableLookupLayer();
+
+public:
+  void configure(const IPortableTensor *lookups, const IPortableTensor *keys,
+                 const IPortableTensor *values, IPortableTensor *output, IPortableTensor *hits);
+
+  void run() override;
+
+  void prepare() override;
+
+private:
+  const IPortableTensor *_lookups;
+  const IPortableTensor *_keys;
+  const IPortableTensor *_values;
+  IPortableTensor *_output;
+  IPortableTensor *_hits;
+
+  std::unique_ptr<nnfw::cker::HashtableLookup> _kernel;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_HASHTABLELOOKUPLAYER_H__
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LSTMLayer.h"
+
+#include <cker/operation/LSTM.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+namespace
+{
+
+template <typename T> nnfw::cker::LSTMMatrix<T> getMatrix(const IPortableTensor *tensor)
+{
+  nnfw::cker::LSTMMatrix<T> matrix;
+  if (tensor)
+  {
+    matrix.data = reinterpret_cast<const T *>(tensor->buffer());
+    matrix.scale = tensor->data_scale();
+  }
+  return matrix;
+}
+
+const float *getVector(const IPortableTensor *tensor)
+{
+  return tensor ? reinterpret_cast<const float *>(tensor->buffer()) : nullptr;
+}
+
+} // namespace
+
+LSTMLayer::LSTMLayer()
+    : _input(nullptr), _input_to_input_weights(nullptr), _input_to_forget_weights(nullptr),
+      _input_to_cell_weights(nullptr), _input_to_output_weights(nullptr),
+      _recurrent_to_input_weights(nullptr), _recurrent_to_forget_weights(nullptr),
+      _recurrent_to_cell_weights(nullptr), _recurrent_to_output_weights(nullptr),
+      _cell_to_input_weights(nullptr), _cell_to_forget_weights(nullptr),
+      _cell_to_output_weights(nullptr), _input_gate_bias(nullptr), _forget_gate_bias(nullptr),
+      _cell_bias(nullptr), _output_gate_bias(nullptr), _projection_weights(nullptr),
+      _projection_bias(nullptr), _output_state_in(nullptr), _cell_state_in(nullptr),
+      _scratch_buffer(nullptr), _output_state_out(nullptr), _cell_state_out(nullptr),
+      _output(nullptr), _activation(ir::Activation::NONE), _cell_threshold(0.f),
+      _projection_threshold(0.f), _temp_arena(new nnfw::cker::LSTMHybridTempArena()),
+      _is_hybrid(false)
+{
+  // DO NOTHING
+}
+
+LSTMLayer::~LSTMLayer() = default;
+
+const float *LSTMLayer::peepholeData(const IPortableTensor *weights,
+                                     std::vector<float> &dequantized)
+{
+  if (weights == nullptr)
+    return nullptr;
+
+  if (weights->data_type() == OperandType::FLOAT32)
+    return reinterpret_cast<const float *>(weights->buffer());
+
+  if (dequantized.empty())
+  {
+    const auto size = getTensorShape(weights).FlatSize();
+    const auto data = reinterpret_cast<const int8_t *>(weights->buffer());
+    const float scale = weights->data_scale();
+    dequantized.resize(size);
+    for (int i = 0; i < size; ++i)
+    {
+      dequantized[i] = data[i] * scale;
+    }
+  }
+  return dequantized.data();
+}
+
+template <typename T> void LSTMLayer::lstm()
+{
+  nnfw::cker::LSTMParams op_params;
+  op_params.activation = convertRecurrentActivationType(_activation);
+  op_params.cell_clip = _cell_threshold;
+  op_params.proj_clip = _projection_threshold;
+
+  nnfw::cker::LSTMWeights<T> weights;
+  weights.input_to_input = getMatrix<T>(_input_to_input_weights);
+  weights.input_to_forget = getMatrix<T>(_input_to_forget_weights);
+  weights.input_to_cell = getMatrix<T>(_input_to_cell_weights);
+  weights.input_to_output = getMatrix<T>(_input_to_output_weights);
+  weights.recurrent_to_input = getMatrix<T>(_recurrent_to_input_weights);
+  weights.recurrent_to_forget = getMatrix<T>(_recurrent_to_forget_weights);
+  weights.recurrent_to_cell = getMatrix<T>(_recurrent_to_cell_weights);
+  weights.recurrent_to_output = getMatrix<T>(_recurrent_to_output_weights);
+  weights.projection = getMatrix<T>(_projection_weights);
+  weights.cell_to_input = peepholeData(_cell_to_input_weights, _cell_to_input_dequantized);
+  weights.cell_to_forget = peepholeData(_cell_to_forget_weights, _cell_to_forget_dequantized);
+  weights.cell_to_output = peepholeData(_cell_to_output_weights, _cell_to_output_dequantized);
+  weights.input_gate_bias = getVector(_input_gate_bias);
+  weights.forget_gate_bias = getVector(_forget_gate_bias);
+  weights.cell_bias = getVector(_cell_bias);
+  weights.output_gate_bias = getVector(_output_gate_bias);
+  weights.projection_bias = getVector(_projection_bias);
+
+  const auto input_shape = getTensorShape(_input);
+  const auto output_state_shape = getTensorShape(_output_state_in);
+  const auto cell_state_shape = getTensorShape(_cell_state_in);
+  if (_is_hybrid && !_temp_arena->prepared)
+  {
+    _temp_arena->prepare(input_shape.Dims(0), input_shape.Dims(1), cell_state_shape.Dims(1),
+                         output_state_shape.Dims(1));
+  }
+
+  nnfw::cker::LSTM(op_params, input_shape, reinterpret_cast<const float *>(_input->buffer()),
+                   weights, output_state_shape,
+                   reinterpret_cast<const float *>(_output_state_in->buffer()), cell_state_shape,
+                   reinterpret_cast<const float *>(_cell_state_in->buffer()),
+                   reinterpret_cast<float *>(_scratch_buffer->buffer()),
+                   reinterpret_cast<float *>(_output_state_out->buffer()),
+                   reinterpret_cast<float *>(_cell_state_out->buffer()),
+                   reinterpret_cast<float *>(_output->buffer()), _temp_arena.get());
+}
+
+void LSTMLayer::configure(
+    const IPortableTensor *input, const IPortableTensor *input_to_input_weights,
+    const IPortableTensor *input_to_forget_weights, const IPortableTensor *input_to_cell_weights,
+    const IPortableTensor *input_to_output_weights,
+    const IPortableTensor *recurrent_to_input_weights,
+    const IPortableTensor *recurrent_to_forget_weights,
+    const IPortableTensor *recurrent_to_cell_weights,
+    const IPortableTensor *recurrent_to_output_weights,
+    const IPortableTensor *cell_to_input_weights, const IPortableTensor *cell_to_forget_weights,
+    const IPortableTensor *cell_to_output_weights, const IPortableTensor *input_gate_bias,
+    const IPortableTensor *forget_gate_bias, const IPortableTensor *cell_bias,
+    const IPortableTensor *output_gate_bias, const IPortableTensor *projection_weights,
+    const IPortableTensor *projection_bias, const IPortableTensor *output_state_in,
+    const IPortableTensor *cell_state_in, ir::Activation activation, float cell_threshold,
+    float projection_threshold, IPortableTensor *scratch_buffer, IPortableTensor *output_state_out,
+    IPortableTensor *cell_state_out, IPortableTensor *output)
+{
+  _input = input;
+  _input_to_input_weights = input_to_input_weights;
+  _input_to_forget_weights = input_to_forget_weights;
+  _input_to_cell_weights = input_to_cell_weights;
+  _input_to_output_weights = input_to_output_weights;
+  _recurrent_to_input_weights = recurrent_to_input_weights;
+  _recurrent_to_forget_weights = recurrent_to_forget_weights;
+  _recurrent_to_cell_weights = recurrent_to_cell_weights;
+  _recurrent_to_output_weights = recurrent_to_output_weights;
+  _cell_to_input_weights = cell_to_input_weights;
+  _cell_to_forget_weights = cell_to_forget_weights;
+  _cell_to_output_weights = cell_to_output_weights;
+  _input_gate_bias = input_gate_bias;
+  _forget_gate_bias = forget_gate_bias;
+  _cell_bias = cell_bias;
+  _output_gate_bias = output_gate_bias;
+  _projection_weights = projection_weights;
+  _projection_bias = projection_bias;
+  _output_state_in = output_state_in;
+  _cell_state_in = cell_state_in;
+  _activation = activation;
+  _cell_threshold = cell_threshold;
+  _projection_threshold = projection_threshold;
+  _scratch_buffer = scratch_buffer;
+  _output_state_out = output_state_out;
+  _cell_state_out = cell_state_out;
+  _output = output;
+  _is_hybrid = input->data_type() == OperandType::FLOAT32 &&
+               input_to_forget_weights->data_type() == OperandType::QUANT_INT8_SYMM;
+}
+
+void LSTMLayer::run()
+{
+  if (_is_hybrid)
+  {
+    lstm<int8_t>();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32)
+  {
+    lstm<float>();
+  }
+  else
+  {
+    throw std::runtime_error{"LSTM: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
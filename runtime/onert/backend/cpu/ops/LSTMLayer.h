@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_LSTMLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_LSTMLAYER_H__
+
+#include <backend/IPortableTensor.h>
+#include "OperationUtils.h"
+
+#include <exec/IFunction.h>
+
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+class LSTMHybridTempArena;
+}
+} // namespace nnfw
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+// NOTE Optional operands which do not exist in the model are given as nullptr
+class LSTMLayer : public ::onert::exec::IFunction
+{
+public:
+  LSTMLayer();
+  ~LSTMLayer();
+
+public:
+  void configure(const IPortableTensor *input, const IPortableTensor *input_to_input_weights,
+                 const IPortableTensor *input_to_forget_weights,
+                 const IPortableTensor *input_to_cell_weights,
+                 const IPortableTensor *input_to_output_weights,
+                 const IPortableTensor *recurrent_to_input_weights,
+                 const IPortableTensor *recurrent_to_forget_weights,
+                 const IPortableTensor *recurrent_to_cell_weights,
+                 const IPortableTensor *recurrent_to_output_weights,
+                 const IPortableTensor *cell_to_input_weights,
+                 const IPortableTensor *cell_to_forget_weights,
+                 const IPortableTensor *cell_to_output_weights,
+                 const IPortableTensor *input_gate_bias, const IPortableTensor *forget_gate_bias,
+                 const IPortableTensor *cell_bias, const IPortableTensor *output_gate_bias,
+                 const IPortableTensor *projection_weights, const IPortableTensor *projection_bias,
+                 const IPortableTensor *output_state_in, const IPortableTensor *cell_state_in,
+                 ir::Activation activation, float cell_threshold, float projection_threshold,
+                 IPortableTensor *scratch_buffer, IPortableTensor *output_state_out,
+                 IPortableTensor *cell_state_out, IPortableTensor *output);
+
+  void run() override;
+
+private:
+  template <typename T> void lstm();
+
+  const float *peepholeData(const IPortableTensor *weights, std::vector<float> &dequantized);
+
+private:
+  const IPortableTensor *_input;
+  const IPortableTensor *_input_to_input_weights;
+  const IPortableTensor *_input_to_forget_weights;
+  const IPortableTensor *_input_to_cell_weights;
+  const IPortableTensor *_input_to_output_weights;
+  const IPortableTensor *_recurrent_to_input_weights;
+  const IPortableTensor *_recurrent_to_forget_weights;
+  const IPortableTensor *_recurrent_to_cell_weights;
+  const IPortableTensor *_recurrent_to_output_weights;
+  const IPortableTensor *_cell_to_input_weights;
+  const IPortableTensor *_cell_to_forget_weights;
+  const IPortableTensor *_cell_to_output_weights;
+  const IPortableTensor *_input_gate_bias;
+  const IPortableTensor *_forget_gate_bias;
+  const IPortableTensor *_cell_bias;
+  const IPortableTensor *_output_gate_bias;
+  const IPortableTensor *_projection_weights;
+  const IPortableTensor *_projection_bias;
+  const IPortableTensor *_output_state_in;
+  const IPortableTensor *_cell_state_in;
+  IPortableTensor *_scratch_buffer;
+  IPortableTensor *_output_state_out;
+  IPortableTensor *_cell_state_out;
+  IPortableTensor *_output;
+
+  ir::Activation _activation;
+  float _cell_threshold;
+  float _projection_threshold;
+  std::unique_ptr<nnfw::cker::LSTMHybridTempArena> _temp_arena;
+
+  // Peephole weights of hybrid LSTM are dequantized once since they are used element-wise
+  std::vector<float> _cell_to_input_dequantized;
+  std::vector<float> _cell_to_forget_dequantized;
+  std::vector<float> _cell_to_output_dequantized;
+
+  bool _is_hybrid;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_LSTMLAYER_H__
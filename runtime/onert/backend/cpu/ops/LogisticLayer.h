@@ -38,7 +38,7 @@ public:
 public:
   void logisticFloat32();
 
-  void logisticQuant8();
+  template <typename T> void logisticQuant8();
 
   void configure(const IPortableTensor *input, IPortableTensor *output);
   void populateLookupTable();
@@ -49,6 +49,7 @@ private:
   const IPortableTensor *_input;
   IPortableTensor *_output;
 
+  // Holds int8 values for int8 input
   uint8_t _table[256];
 };
 
@@ -56,19 +56,19 @@ void MaxPoolLayer::maxPoolFloat32()
                       reinterpret_cast<const float *>(_input->buffer()), getTensorShape(_output),
                       reinterpret_cast<float *>(_output->buffer()));
 }
-void MaxPoolLayer::maxPoolQuant8()
+template <typename T> void MaxPoolLayer::maxPoolQuant8()
 {
   MAXPOOLING_PARAMETERS
   int32_t output_activation_min = 0;
   int32_t output_activation_max = 0;
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
   op_params.quantized_activation_min = output_activation_min;
   op_params.quantized_activation_max = output_activation_max;
 
   nnfw::cker::MaxPool(op_params, getTensorShape(_input),
-                      reinterpret_cast<const uint8_t *>(_input->buffer()), getTensorShape(_output),
-                      reinterpret_cast<uint8_t *>(_output->buffer()));
+                      reinterpret_cast<const T *>(_input->buffer()), getTensorShape(_output),
+                      reinterpret_cast<T *>(_output->buffer()));
 }
 
 void MaxPoolLayer::configure(const IPortableTensor *input, const uint32_t paddingLeft,
@@ -99,7 +99,11 @@ void MaxPoolLayer::run()
   }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
-    maxPoolQuant8();
+    maxPoolQuant8<uint8_t>();
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    maxPoolQuant8<int8_t>();
   }
   else
   {
@@ -41,12 +41,11 @@ void MeanLayer::MeanFloat32()
                    getReducerAxes(_axes));
 }
 
-void MeanLayer::MeanQuant8()
+template <typename T> void MeanLayer::MeanQuant8()
 {
-  nnfw::cker::MeanQ8Asymm(getTensorShape(_input),
-                          reinterpret_cast<const uint8_t *>(_input->buffer()), _input->data_scale(),
-                          _input->data_offset(), getTensorShape(_output),
-                          reinterpret_cast<uint8_t *>(_output->buffer()), _output->data_scale(),
+  nnfw::cker::MeanQ8Asymm(getTensorShape(_input), reinterpret_cast<const T *>(_input->buffer()),
+                          _input->data_scale(), _input->data_offset(), getTensorShape(_output),
+                          reinterpret_cast<T *>(_output->buffer()), _output->data_scale(),
                           _output->data_offset(), getReducerAxes(_axes));
 }
 
@@ -67,7 +66,11 @@ void MeanLayer::run()
   }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
-    MeanQuant8();
+    MeanQuant8<uint8_t>();
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    MeanQuant8<int8_t>();
   }
   else
   {
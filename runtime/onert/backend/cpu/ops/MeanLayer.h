@@ -38,7 +38,7 @@ public:
 public:
   void MeanFloat32();
 
-  void MeanQuant8();
+  template <typename T> void MeanQuant8();
 
   void configure(const IPortableTensor *input, const IPortableTensor *axes, IPortableTensor *output,
                  bool keep_dims);
@@ -52,11 +52,11 @@ void MulLayer::mulFloat32()
       getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
 }
 
-void MulLayer::mulQuant8()
+template <typename T> void MulLayer::mulQuant8()
 {
   int32_t output_activation_min, output_activation_max;
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
   nnfw::cker::BinaryArithmeticOpParam op_params;
 
   op_params.quantized_activation_max = output_activation_max;
@@ -73,16 +73,16 @@ void MulLayer::mulQuant8()
   if (need_broadcast)
   {
     nnfw::cker::BroadcastBinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::MUL>(
-        op_params, getTensorShape(_lhs), reinterpret_cast<const uint8_t *>(_lhs->buffer()),
-        getTensorShape(_rhs), reinterpret_cast<const uint8_t *>(_rhs->buffer()),
-        getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
+        op_params, getTensorShape(_lhs), reinterpret_cast<const T *>(_lhs->buffer()),
+        getTensorShape(_rhs), reinterpret_cast<const T *>(_rhs->buffer()),
+        getTensorShape(_output), reinterpret_cast<T *>(_output->buffer()));
     return;
   }
 
   nnfw::cker::BinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::MUL>(
-      op_params, getTensorShape(_lhs), reinterpret_cast<const uint8_t *>(_lhs->buffer()),
-      getTensorShape(_rhs), reinterpret_cast<const uint8_t *>(_rhs->buffer()),
-      getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
+      op_params, getTensorShape(_lhs), reinterpret_cast<const T *>(_lhs->buffer()),
+      getTensorShape(_rhs), reinterpret_cast<const T *>(_rhs->buffer()),
+      getTensorShape(_output), reinterpret_cast<T *>(_output->buffer()));
 }
 
 void MulLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
@@ -102,7 +102,11 @@ void MulLayer::run()
   }
   else if (_output->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
-    mulQuant8();
+    mulQuant8<uint8_t>();
+  }
+  else if (_output->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    mulQuant8<int8_t>();
   }
   else
   {
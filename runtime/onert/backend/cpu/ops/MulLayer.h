@@ -42,7 +42,7 @@ public:
 public:
   void mulFloat32();
 
-  void mulQuant8();
+  template <typename T> void mulQuant8();
 
   void configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
                  const ir::Activation activation, IPortableTensor *output);
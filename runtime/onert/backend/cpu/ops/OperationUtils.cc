@@ -94,6 +94,27 @@ void GetQuantizedConvolutionMultiplier(const IPortableTensor *input, const IPort
   *multiplier = input_product_scale / output_scale;
 }
 
+void GetQuantizedConvolutionMultipliersAndShifts(const IPortableTensor *input,
+                                                 const IPortableTensor *filter,
+                                                 const IPortableTensor *output, int num_channels,
+                                                 std::vector<int32_t> *multipliers,
+                                                 std::vector<int> *shifts)
+{
+  const auto &filter_scales = filter->data_scales();
+  if (!filter_scales.empty() && static_cast<int>(filter_scales.size()) != num_channels)
+    throw std::runtime_error{"Per-channel scales do not match the number of output channels"};
+
+  multipliers->resize(num_channels);
+  shifts->resize(num_channels);
+  for (int c = 0; c < num_channels; ++c)
+  {
+    const double filter_scale = filter_scales.empty() ? filter->data_scale() : filter_scales[c];
+    const double real_multiplier =
+        static_cast<double>(input->data_scale()) * filter_scale / output->data_scale();
+    QuantizeMultiplier(real_multiplier, &(*multipliers)[c], &(*shifts)[c]);
+  }
+}
+
 void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantized_multiplier,
                                       int *left_shift)
 {
@@ -111,11 +132,16 @@ void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantiz
   *quantized_multiplier = static_cast<int32_t>(q_fixed);
 }
 
-void CalculateActivationRangeUint8(ir::Activation activation, const IPortableTensor *output,
-                                   int32_t *act_min, int32_t *act_max)
+void CalculateActivationRangeQuantized(ir::Activation activation, const IPortableTensor *output,
+                                       int32_t *act_min, int32_t *act_max)
 {
-  const int32_t qmin = std::numeric_limits<uint8_t>::min();
-  const int32_t qmax = std::numeric_limits<uint8_t>::max();
+  int32_t qmin = std::numeric_limits<uint8_t>::min();
+  int32_t qmax = std::numeric_limits<uint8_t>::max();
+  if (output->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    qmin = std::numeric_limits<int8_t>::min();
+    qmax = std::numeric_limits<int8_t>::max();
+  }
   const auto scale = output->data_scale();
   const auto zero_point = output->data_offset();
   auto quantize = [scale, zero_point](float f) {
@@ -198,6 +224,7 @@ uint32_t sizeOfData(OperandType type, const std::vector<int32_t> &dimensions)
     case OperandType::BOOL8:
     case OperandType::QUANT_UINT8_ASYMM:
     case OperandType::QUANT_INT8_SYMM:
+    case OperandType::QUANT_INT8_ASYMM:
       size = 1;
       break;
     case OperandType::INT64:
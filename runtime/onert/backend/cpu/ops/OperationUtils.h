@@ -118,6 +118,15 @@ inline nnfw::cker::Shape getTensorShape(const IPortableTensor *tensor)
   return nnfw::cker::Shape(rank, data);
 }
 
+// Views tensor as [dimension 0, bytes of a row] to copy its rows regardless of the data type
+inline nnfw::cker::Shape getByteRowsShape(const IPortableTensor *tensor)
+{
+  assert(tensor);
+  const int32_t rows = tensor->dimension(0);
+  const int32_t row_bytes = rows == 0 ? 0 : static_cast<int32_t>(tensor->total_size() / rows);
+  return nnfw::cker::Shape{rows, row_bytes};
+}
+
 inline nnfw::cker::FusedActivationFunctionType
 convertActivationType(const ir::Activation activation)
 {
@@ -136,6 +145,21 @@ convertActivationType(const ir::Activation activation)
   }
 }
 
+// Recurrent cells also support transcendental activations which fused activations do not
+inline nnfw::cker::FusedActivationFunctionType
+convertRecurrentActivationType(const ir::Activation activation)
+{
+  switch (activation)
+  {
+    case ir::Activation::TANH:
+      return nnfw::cker::FusedActivationFunctionType::kTanh;
+    case ir::Activation::SIGMOID:
+      return nnfw::cker::FusedActivationFunctionType::kSigmoid;
+    default:
+      return convertActivationType(activation);
+  }
+}
+
 inline int32_t getAxis(uint32_t rank, int32_t axis, ir::Layout frontend_layout)
 {
   auto ret = axis;
@@ -162,6 +186,14 @@ void GetQuantizedConvolutionMultiplier(const IPortableTensor *inputDescr,
                                        const IPortableTensor *biasDescr,
                                        const IPortableTensor *outputDescr, double *multiplier);
 
+// Quantizes input_scale * filter_scale[c] / output_scale of each output channel, where a filter
+// without per-channel scales shares its scale over all channels
+void GetQuantizedConvolutionMultipliersAndShifts(const IPortableTensor *input,
+                                                 const IPortableTensor *filter,
+                                                 const IPortableTensor *output, int num_channels,
+                                                 std::vector<int32_t> *multipliers,
+                                                 std::vector<int> *shifts);
+
 void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantized_multiplier,
                                       int *left_shift);
 
@@ -199,8 +231,8 @@ void CalculateActivationRange(ir::Activation activation, T *activation_min, T *a
   }
 }
 
-void CalculateActivationRangeUint8(ir::Activation activation, const IPortableTensor *output,
-                                   int32_t *act_min, int32_t *act_max);
+void CalculateActivationRangeQuantized(ir::Activation activation, const IPortableTensor *output,
+                                       int32_t *act_min, int32_t *act_max);
 
 bool HaveSameShapes(const IPortableTensor *input1, const IPortableTensor *input2);
 
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "PReLULayer.h"
+
+#include <cker/operation/PReLU.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+PReLULayer::PReLULayer() : _input(nullptr), _alpha(nullptr), _output(nullptr)
+{
+  // DO NOTHING
+}
+
+void PReLULayer::configure(const IPortableTensor *input, const IPortableTensor *alpha,
+                           IPortableTensor *output)
+{
+  assert(input != nullptr);
+  assert(alpha != nullptr);
+  assert(output != nullptr);
+
+  _input = input;
+  _alpha = alpha;
+  _output = output;
+}
+
+void PReLULayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+  {
+    throw std::runtime_error{"PReLU: unsupported data type"};
+  }
+
+  nnfw::cker::PReLU(getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+                    getTensorShape(_alpha), reinterpret_cast<const float *>(_alpha->buffer()),
+                    getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -68,6 +68,18 @@ void PadLayer::run()
       padImpl<uint8_t>(_constantValueData.u8);
     }
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    if (_constantValueData.i8 == nullptr)
+    {
+      int8_t pad_value = static_cast<int8_t>(_output->data_offset());
+      padImpl<int8_t>(&pad_value);
+    }
+    else
+    {
+      padImpl<int8_t>(_constantValueData.i8);
+    }
+  }
   else
   {
     throw std::runtime_error{"Pad: unsupported data type"};
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RNNLayer.h"
+
+#include <cker/operation/RNN.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+RNNLayer::RNNLayer()
+    : _input(nullptr), _weights(nullptr), _recurrent_weights(nullptr), _bias(nullptr),
+      _hidden_state_in(nullptr), _output(nullptr), _hidden_state_out(nullptr),
+      _activation(ir::Activation::NONE)
+{
+  // DO NOTHING
+}
+
+void RNNLayer::rnnFloat32()
+{
+  nnfw::cker::RNNParams op_params;
+  op_params.activation = convertRecurrentActivationType(_activation);
+
+  nnfw::cker::RNN(op_params, getTensorShape(_input),
+                  reinterpret_cast<const float *>(_input->buffer()), getTensorShape(_weights),
+                  reinterpret_cast<const float *>(_weights->buffer()),
+                  getTensorShape(_recurrent_weights),
+                  reinterpret_cast<const float *>(_recurrent_weights->buffer()),
+                  getTensorShape(_bias), reinterpret_cast<const float *>(_bias->buffer()),
+                  getTensorShape(_hidden_state_in),
+                  reinterpret_cast<const float *>(_hidden_state_in->buffer()),
+                  reinterpret_cast<float *>(_output->buffer()),
+                  reinterpret_cast<float *>(_hidden_state_out->buffer()));
+}
+
+void RNNLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
+                         const IPortableTensor *recurrent_weights, const IPortableTensor *bias,
+                         const IPortableTensor *hidden_state_in, ir::Activation activation,
+                         IPortableTensor *output, IPortableTensor *hidden_state_out)
+{
+  _input = input;
+  _weights = weights;
+  _recurrent_weights = recurrent_weights;
+  _bias = bias;
+  _hidden_state_in = hidden_state_in;
+  _activation = activation;
+  _output = output;
+  _hidden_state_out = hidden_state_out;
+}
+
+void RNNLayer::run()
+{
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    rnnFloat32();
+  }
+  else
+  {
+    throw std::runtime_error{"RNN: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -32,10 +32,11 @@ namespace ops
 namespace
 {
 
-template <typename T>
+// Reducer is passed as a type to be inlined into the kernel
+template <typename T, typename Reducer>
 void evalLogic(const IPortableTensor *input, IPortableTensor *output, const std::vector<int> &axes,
                bool keep_dims, T init_value, nnfw::cker::Reduce &reduce_kernel,
-               T reducer(const T current, const T in))
+               const Reducer &reducer)
 {
   reduce_kernel.prepare(input->num_dimensions(), axes.size());
   bool result = reduce_kernel.ReduceGeneric<T>(
@@ -29,11 +29,13 @@ namespace ops
 
 ResizeBilinearLayer::ResizeBilinearLayer()
     : _input(nullptr), _output(nullptr), _output_height(0), _output_width(0), _align_corners(false),
-      _half_pixel_centers(false)
+      _half_pixel_centers(false), _kernel(new nnfw::cker::ResizeBilinear())
 {
   // DO NOTHING
 }
 
+ResizeBilinearLayer::~ResizeBilinearLayer() = default;
+
 void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                     int32_t output_height, int32_t output_width, bool align_corners,
                                     bool half_pixel_centers)
@@ -46,26 +48,36 @@ void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTenso
   _half_pixel_centers = half_pixel_centers;
 }
 
-void ResizeBilinearLayer::run()
+nnfw::cker::ResizeBilinearParams ResizeBilinearLayer::params() const
 {
   nnfw::cker::ResizeBilinearParams params;
   params.align_corners = _align_corners;
   params.half_pixel_centers = _half_pixel_centers;
   params.output_height = _output_height;
   params.output_width = _output_width;
+  return params;
+}
+
+void ResizeBilinearLayer::run()
+{
+  const auto params = this->params();
+  nnfw::cker::ResizeBilinear &kernel = *_kernel;
 
   switch (_input->data_type())
   {
     case OperandType::FLOAT32:
-      nnfw::cker::ResizeBilinear(
-          params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
-          getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+      kernel(params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+             getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
       break;
 
     case OperandType::QUANT_UINT8_ASYMM:
-      nnfw::cker::ResizeBilinear(
-          params, getTensorShape(_input), reinterpret_cast<const uint8_t *>(_input->buffer()),
-          getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
+      kernel(params, getTensorShape(_input), reinterpret_cast<const uint8_t *>(_input->buffer()),
+             getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
+      break;
+
+    case OperandType::QUANT_INT8_ASYMM:
+      kernel(params, getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+             getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()));
       break;
 
     case OperandType::UINT8:
@@ -74,13 +86,21 @@ void ResizeBilinearLayer::run()
     case OperandType::INT32:
     case OperandType::INT64:
     case OperandType::QUANT_INT8_SYMM:
-      std::runtime_error("ResizeBilinear NYI");
-      break;
+      throw std::runtime_error("ResizeBilinear NYI");
     default:
-      std::runtime_error("ResizeBilinear unsupported data type");
+      throw std::runtime_error("ResizeBilinear unsupported data type");
   }
 }
 
+void ResizeBilinearLayer::prepare()
+{
+  if (_input->is_dynamic())
+    return;
+
+  // Input shape is known, so interpolation tables are built before the first run
+  _kernel->prepare(params(), getTensorShape(_input));
+}
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
@@ -18,8 +18,18 @@
 #define __ONERT_BACKEND_CPU_OPS_RESIZEBILINEAR_H__
 
 #include <backend/IPortableTensor.h>
+#include "OperationUtils.h"
 
 #include <exec/IFunction.h>
+#include <memory>
+
+namespace nnfw
+{
+namespace cker
+{
+class ResizeBilinear;
+}
+} // namespace nnfw
 
 namespace onert
 {
@@ -34,6 +44,7 @@ class ResizeBilinearLayer : public ::onert::exec::IFunction
 {
 public:
   ResizeBilinearLayer();
+  ~ResizeBilinearLayer();
 
 public:
   void configure(const IPortableTensor *input1, IPortableTensor *output, int32_t output_height,
@@ -41,6 +52,11 @@ public:
 
   void run() override;
 
+  void prepare() override;
+
+private:
+  nnfw::cker::ResizeBilinearParams params() const;
+
 private:
   const IPortableTensor *_input;
   IPortableTensor *_output;
@@ -48,6 +64,8 @@ private:
   int32_t _output_width;
   bool _align_corners;
   bool _half_pixel_centers;
+
+  std::unique_ptr<nnfw::cker::ResizeBilinear> _kernel;
 };
 
 } // namespace ops
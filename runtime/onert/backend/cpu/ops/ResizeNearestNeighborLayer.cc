@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "OperationUtils.h"
+#include "ResizeNearestNeighborLayer.h"
+#include "cker/operation/ResizeNearestNeighbor.h"
+#include <cker/Types.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+ResizeNearestNeighborLayer::ResizeNearestNeighborLayer()
+    : _input(nullptr), _output(nullptr), _output_height(0), _output_width(0), _align_corners(false),
+      _half_pixel_centers(false), _kernel(new nnfw::cker::ResizeNearestNeighbor())
+{
+  // DO NOTHING
+}
+
+ResizeNearestNeighborLayer::~ResizeNearestNeighborLayer() = default;
+
+void ResizeNearestNeighborLayer::configure(const IPortableTensor *input, IPortableTensor *output,
+                                           int32_t output_height, int32_t output_width,
+                                           bool align_corners, bool half_pixel_centers)
+{
+  _input = input;
+  _output = output;
+  _output_height = output_height;
+  _output_width = output_width;
+  _align_corners = align_corners;
+  _half_pixel_centers = half_pixel_centers;
+}
+
+nnfw::cker::ResizeNearestNeighborParams ResizeNearestNeighborLayer::params() const
+{
+  nnfw::cker::ResizeNearestNeighborParams params;
+  params.align_corners = _align_corners;
+  params.half_pixel_centers = _half_pixel_centers;
+  params.output_height = _output_height;
+  params.output_width = _output_width;
+  return params;
+}
+
+void ResizeNearestNeighborLayer::run()
+{
+  const auto params = this->params();
+  nnfw::cker::ResizeNearestNeighbor &kernel = *_kernel;
+
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      kernel(params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+             getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+      break;
+    case OperandType::QUANT_UINT8_ASYMM:
+    case OperandType::UINT8:
+    case OperandType::BOOL8:
+      kernel(params, getTensorShape(_input), reinterpret_cast<const uint8_t *>(_input->buffer()),
+             getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
+      break;
+    case OperandType::QUANT_INT8_ASYMM:
+    case OperandType::QUANT_INT8_SYMM:
+      kernel(params, getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+             getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()));
+      break;
+    case OperandType::INT32:
+      kernel(params, getTensorShape(_input), reinterpret_cast<const int32_t *>(_input->buffer()),
+             getTensorShape(_output), reinterpret_cast<int32_t *>(_output->buffer()));
+      break;
+    case OperandType::INT64:
+      kernel(params, getTensorShape(_input), reinterpret_cast<const int64_t *>(_input->buffer()),
+             getTensorShape(_output), reinterpret_cast<int64_t *>(_output->buffer()));
+      break;
+    default:
+      throw std::runtime_error("ResizeNearestNeighbor: unsupported data type");
+  }
+}
+
+void ResizeNearestNeighborLayer::prepare()
+{
+  if (_input->is_dynamic())
+    return;
+
+  // Input shape is known, so source tables are built before the first run
+  _kernel->prepare(params(), getTensorShape(_input));
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
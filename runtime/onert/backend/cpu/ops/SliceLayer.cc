@@ -97,6 +97,10 @@ void SliceLayer::run()
   {
     sliceImpl<uint8_t>();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    sliceImpl<int8_t>();
+  }
   else
   {
     throw std::runtime_error{"Slice: unsupported data type"};
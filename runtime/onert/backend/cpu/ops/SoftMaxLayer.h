@@ -38,7 +38,7 @@ public:
 public:
   void softmaxFloat32();
 
-  void softmaxQuant8();
+  template <typename T> void softmaxQuant8();
 
   void configure(const IPortableTensor *input, const float beta, IPortableTensor *output);
 
@@ -49,6 +49,8 @@ private:
   IPortableTensor *_output;
 
   float _beta;
+
+  float _table[256];
 };
 
 } // namespace ops
@@ -62,6 +62,10 @@ void SpaceToDepthLayer::run()
   {
     spaceToDepth<uint8_t>();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    spaceToDepth<int8_t>();
+  }
   else
   {
     throw std::runtime_error{"SpaceToDepth: unsupported data type"};
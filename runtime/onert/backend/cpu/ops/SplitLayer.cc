@@ -74,6 +74,10 @@ void SplitLayer::run()
   {
     split<uint8_t>();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    split<int8_t>();
+  }
   else if (_input->data_type() == OperandType::INT32)
   {
     split<int32_t>();
@@ -79,6 +79,10 @@ void SplitVLayer::run()
   {
     splitV<uint8_t>();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    splitV<int8_t>();
+  }
   else if (_input->data_type() == OperandType::INT32)
   {
     splitV<int32_t>();
@@ -77,11 +77,11 @@ void SubLayer::subInt32()
       getTensorShape(_output), reinterpret_cast<int32_t *>(_output->buffer()));
 }
 
-void SubLayer::subQuant8()
+template <typename T> void SubLayer::subQuant8()
 {
   int32_t output_activation_min, output_activation_max;
-  CalculateActivationRangeUint8(_activation, _output, &output_activation_min,
-                                &output_activation_max);
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
   nnfw::cker::BinaryArithmeticOpParam op_params;
   op_params.quantized_activation_max = output_activation_max;
   op_params.quantized_activation_min = output_activation_min;
@@ -91,9 +91,12 @@ void SubLayer::subQuant8()
   op_params.input1_offset = -_lhs->data_offset();
   op_params.input2_offset = -_rhs->data_offset();
   op_params.output_offset = _output->data_offset();
-  assert((op_params.input1_offset >= 0) && (op_params.input1_offset <= 255));
-  assert((op_params.input2_offset >= 0) && (op_params.input2_offset <= 255));
-  assert((op_params.output_offset >= 0) && (op_params.output_offset <= 255));
+  assert((-op_params.input1_offset >= std::numeric_limits<T>::min()) &&
+         (-op_params.input1_offset <= std::numeric_limits<T>::max()));
+  assert((-op_params.input2_offset >= std::numeric_limits<T>::min()) &&
+         (-op_params.input2_offset <= std::numeric_limits<T>::max()));
+  assert((op_params.output_offset >= std::numeric_limits<T>::min()) &&
+         (op_params.output_offset <= std::numeric_limits<T>::max()));
 
   // Compute normalized scale for _lhs and _rhs values,
   // and represent in 32-bit fixed point
@@ -115,16 +118,16 @@ void SubLayer::subQuant8()
   if (need_broadcast)
   {
     nnfw::cker::BroadcastBinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::SUB>(
-        op_params, getTensorShape(_lhs), reinterpret_cast<const uint8_t *>(_lhs->buffer()),
-        getTensorShape(_rhs), reinterpret_cast<const uint8_t *>(_rhs->buffer()),
-        getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
+        op_params, getTensorShape(_lhs), reinterpret_cast<const T *>(_lhs->buffer()),
+        getTensorShape(_rhs), reinterpret_cast<const T *>(_rhs->buffer()),
+        getTensorShape(_output), reinterpret_cast<T *>(_output->buffer()));
     return;
   }
 
   nnfw::cker::BinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::SUB>(
-      op_params, getTensorShape(_lhs), reinterpret_cast<const uint8_t *>(_lhs->buffer()),
-      getTensorShape(_rhs), reinterpret_cast<const uint8_t *>(_rhs->buffer()),
-      getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
+      op_params, getTensorShape(_lhs), reinterpret_cast<const T *>(_lhs->buffer()),
+      getTensorShape(_rhs), reinterpret_cast<const T *>(_rhs->buffer()),
+      getTensorShape(_output), reinterpret_cast<T *>(_output->buffer()));
 }
 
 void SubLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
@@ -144,7 +147,11 @@ void SubLayer::run()
   }
   else if (_output->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
-    subQuant8();
+    subQuant8<uint8_t>();
+  }
+  else if (_output->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    subQuant8<int8_t>();
   }
   else if (_output->data_type() == OperandType::INT32)
   {
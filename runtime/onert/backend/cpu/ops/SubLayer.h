@@ -42,7 +42,7 @@ public:
 public:
   void subFloat32();
 
-  void subQuant8();
+  template <typename T> void subQuant8();
 
   void subInt32();
 
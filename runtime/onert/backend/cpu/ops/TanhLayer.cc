@@ -19,6 +19,7 @@
 #include "OperationUtils.h"
 
 #include <cker/operation/Tanh.h>
+#include <cker/operation/LookupTable.h>
 
 namespace onert
 {
@@ -36,20 +37,18 @@ TanhLayer::TanhLayer() : _input(nullptr), _output(nullptr)
 
 void TanhLayer::PopulateLookupTable()
 {
-  const auto input_scale = static_cast<double>(_input->data_scale());
-  const auto input_zero_point = static_cast<int32_t>(_input->data_offset());
-  const auto output_scale = static_cast<double>(_output->data_scale());
-  const auto output_zero_point = static_cast<int32_t>(_output->data_offset());
-  const float inverse_scale = 1 / output_scale;
-  int32_t maxval = std::numeric_limits<uint8_t>::max();
-  int32_t minval = std::numeric_limits<uint8_t>::min();
-  for (int32_t val = minval; val <= maxval; ++val)
+  const auto transform = [](float value) { return std::tanh(value); };
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
   {
-    const float dequantized = input_scale * (val - input_zero_point);
-    const float transformed = std::tanh(dequantized);
-    const float rescaled = std::round(transformed * inverse_scale);
-    const int32_t quantized = static_cast<int32_t>(rescaled + output_zero_point);
-    _table[val] = static_cast<uint8_t>(std::max(std::min(maxval, quantized), minval));
+    nnfw::cker::PopulateLookupTable<int8_t>(_input->data_scale(), _input->data_offset(),
+                                            _output->data_scale(), _output->data_offset(),
+                                            transform, reinterpret_cast<int8_t *>(_table));
+  }
+  else
+  {
+    nnfw::cker::PopulateLookupTable<uint8_t>(_input->data_scale(), _input->data_offset(),
+                                             _output->data_scale(), _output->data_offset(),
+                                             transform, _table);
   }
 }
 
@@ -59,23 +58,20 @@ void TanhLayer::tanhFloat32()
                    getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
 }
 
-void TanhLayer::tanhQuant8()
+template <typename T> void TanhLayer::tanhQuant8()
 {
   const int size = MatchingFlatSize(getTensorShape(_input), getTensorShape(_output));
-  const uint8_t *input_data = reinterpret_cast<const uint8_t *>(_input->buffer());
-  uint8_t *output_data = reinterpret_cast<uint8_t *>(_output->buffer());
-
-  for (int i = 0; i < size; ++i)
-  {
-    output_data[i] = _table[input_data[i]];
-  }
+  nnfw::cker::LookupTable(reinterpret_cast<const T *>(_input->buffer()), size,
+                          reinterpret_cast<const T *>(_table),
+                          reinterpret_cast<T *>(_output->buffer()));
 }
 
 void TanhLayer::configure(const IPortableTensor *input, IPortableTensor *output)
 {
   _input = input;
   _output = output;
-  if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM ||
+      _input->data_type() == OperandType::QUANT_INT8_ASYMM)
   {
     PopulateLookupTable();
   }
@@ -89,7 +85,11 @@ void TanhLayer::run()
   }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
-    tanhQuant8();
+    tanhQuant8<uint8_t>();
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    tanhQuant8<int8_t>();
   }
   else
   {
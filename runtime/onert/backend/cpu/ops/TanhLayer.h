@@ -38,7 +38,7 @@ public:
 public:
   void tanhFloat32();
 
-  void tanhQuant8();
+  template <typename T> void tanhQuant8();
 
   void configure(const IPortableTensor *input, IPortableTensor *output);
 
@@ -49,6 +49,7 @@ public:
 private:
   const IPortableTensor *_input;
   IPortableTensor *_output;
+  // Holds int8 values for int8 input
   uint8_t _table[256];
 };
 
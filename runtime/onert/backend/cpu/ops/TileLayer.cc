@@ -36,15 +36,16 @@ TileLayer::TileLayer() : _input(nullptr), _multipliers(nullptr), _output(nullptr
 
 void TileLayer::tileFloat32()
 {
-  TileOneDimension(getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
-                   reinterpret_cast<const int *>(_multipliers->buffer()),
-                   reinterpret_cast<float *>(_output->buffer()), 0);
+  nnfw::cker::Tile(getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+                   reinterpret_cast<const int *>(_multipliers->buffer()), getTensorShape(_output),
+                   reinterpret_cast<float *>(_output->buffer()));
 }
 
 void TileLayer::tileQuant8()
 {
-  // cker quant8 tile is not implemented yet
-  throw std::runtime_error{"NYI"};
+  nnfw::cker::Tile(getTensorShape(_input), reinterpret_cast<const uint8_t *>(_input->buffer()),
+                   reinterpret_cast<const int *>(_multipliers->buffer()), getTensorShape(_output),
+                   reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
 void TileLayer::configure(const IPortableTensor *input, const IPortableTensor *multipliers,
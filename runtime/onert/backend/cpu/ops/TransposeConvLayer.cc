@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransposeConvLayer.h"
+
+#include "../Tensor.h"
+#include <cker/operation/TransposeConv.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+TransposeConvLayer::TransposeConvLayer()
+    : _input(nullptr), _kernel(nullptr), _bias(nullptr), _output(nullptr), _padding(),
+      _paddingLeft(0), _paddingTop(0), _strideWidth(0), _strideHeight(0),
+      _activation(ir::Activation::NONE), _transpose_conv_kernel(new nnfw::cker::TransposeConv()),
+      _prepare(false)
+{
+  // DO NOTHING
+}
+
+TransposeConvLayer::~TransposeConvLayer() = default;
+
+void TransposeConvLayer::transposeConvFloat32()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  nnfw::cker::TransposeConv &kernel = *_transpose_conv_kernel;
+  kernel(op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+         getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
+         getTensorShape(_bias), reinterpret_cast<const float *>(_bias ? _bias->buffer() : nullptr),
+         getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+}
+
+void TransposeConvLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
+                                   const IPortableTensor *bias, const ir::Padding &padding,
+                                   const uint32_t paddingLeft, const uint32_t paddingTop,
+                                   const uint32_t strideWidth, const uint32_t strideHeight,
+                                   const ir::Activation activation, IPortableTensor *output)
+{
+  _input = input;
+  _kernel = kernel;
+  _bias = bias;
+  _padding = padding;
+  _paddingLeft = paddingLeft;
+  _paddingTop = paddingTop;
+  _strideWidth = strideWidth;
+  _strideHeight = strideHeight;
+  _activation = activation;
+  _output = output;
+}
+
+void TransposeConvLayer::run()
+{
+  prepare();
+
+  if (_input->is_dynamic() || _output->is_dynamic())
+  {
+    const auto ifm_shape = _input->getShape().asFeature(_input->layout());
+    const auto ofm_shape = _output->getShape().asFeature(_input->layout());
+    // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+    const auto ker_shape = _kernel->getShape();
+
+    ir::Stride stride;
+    stride.vertical = _strideHeight;
+    stride.horizontal = _strideWidth;
+
+    // Padding of TransposeConv is the padding of the convolution whose output is the input
+    const auto padding = ir::calculatePadding(_padding, ofm_shape, ifm_shape, stride,
+                                              ker_shape.dim(2), ker_shape.dim(1));
+    _paddingLeft = padding.left;
+    _paddingTop = padding.top;
+  }
+
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    transposeConvFloat32();
+  }
+  else
+  {
+    throw std::runtime_error{"TransposeConv: unsupported data type"};
+  }
+}
+
+void TransposeConvLayer::prepare()
+{
+  if (_prepare)
+    return;
+
+  if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
+  {
+    _transpose_conv_kernel->prepare(getTensorShape(_kernel),
+                                    reinterpret_cast<const float *>(_kernel->buffer()));
+
+    // The packed filter replaces the constant kernel
+    auto kernel_tensor = dynamic_cast<const Tensor *>(_kernel);
+    if (kernel_tensor)
+      // TODO Remove const_cast
+      const_cast<Tensor *>(kernel_tensor)->decrease_ref();
+  }
+  _prepare = true;
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_TRANSPOSECONVLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_TRANSPOSECONVLAYER_H__
+
+#include <backend/IPortableTensor.h>
+#include "OperationUtils.h"
+
+#include <exec/IFunction.h>
+#include <memory>
+
+namespace nnfw
+{
+namespace cker
+{
+class TransposeConv;
+}
+} // namespace nnfw
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class TransposeConvLayer : public ::onert::exec::IFunction
+{
+public:
+  TransposeConvLayer();
+  ~TransposeConvLayer();
+
+public:
+  void transposeConvFloat32();
+
+  void configure(const IPortableTensor *input, const IPortableTensor *kernel,
+                 const IPortableTensor *bias, const ir::Padding &padding,
+                 const uint32_t paddingLeft, const uint32_t paddingTop, const uint32_t strideWidth,
+                 const uint32_t strideHeight, const ir::Activation activation,
+                 IPortableTensor *output);
+
+  void run() override;
+
+  void prepare() override;
+
+private:
+  const IPortableTensor *_input;
+  const IPortableTensor *_kernel;
+  const IPortableTensor *_bias;
+  IPortableTensor *_output;
+
+  ir::Padding _padding;
+  uint32_t _paddingLeft;
+  uint32_t _paddingTop;
+
+  uint32_t _strideWidth;
+  uint32_t _strideHeight;
+
+  ir::Activation _activation;
+
+  std::unique_ptr<nnfw::cker::TransposeConv> _transpose_conv_kernel;
+
+  bool _prepare;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_TRANSPOSECONVLAYER_H__
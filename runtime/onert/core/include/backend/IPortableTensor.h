@@ -19,6 +19,8 @@
 
 #include "backend/ITensor.h"
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -38,6 +40,13 @@ class IPortableTensor : public ITensor
 public:
   virtual ~IPortableTensor() = default;
 
+public:
+  /**
+   * @brief Return scales of each output channel if the tensor is per-channel quantized
+   * @note  Empty if the tensor has only one scale, @c data_scale()
+   */
+  virtual const std::vector<float> &data_scales() const = 0;
+
 public:
   bool has_padding() const final { return false; }
   void access(const std::function<void(ITensor &tensor)> &fn) final { fn(*this); }
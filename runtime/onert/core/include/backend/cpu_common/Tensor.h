@@ -101,6 +101,7 @@ public:
   ir::Layout layout() const override { return _layout; }
   ir::DataType data_type() const override { return _info.typeInfo().type(); }
   float data_scale() const override { return _info.typeInfo().scale(); }
+  const std::vector<float> &data_scales() const override { return _info.typeInfo().scales(); }
   int32_t data_offset() const override { return _info.typeInfo().offset(); }
   bool is_constant() const override { return _info.isConstant(); }
   bool is_dynamic() const override { return _info.isDynamic(); }
@@ -28,6 +28,11 @@
 namespace onert
 {
 
+namespace exec
+{
+class OnlineExecTime;
+} // namespace exec
+
 namespace compiler
 {
 
@@ -60,6 +65,17 @@ struct CompilerOptions
   bool he_profiling_mode; //< Whether HEScheduler profiling mode ON/OFF
   bool disable_compile;   //< Run with Interpreter if true, try compilation otherwise
   bool fp16_enable;       //< Whether fp16 mode ON/OFF
+
+  // OPTIONS ONLY FOR ONLINE PROFILING
+  // NOTE Like profiling mode, online profiling makes one operation per OpSequence to measure
+  //      each operation. So it costs more to run, and operations of a backend are not fused
+  //      (e.g. Conv2D with Add/Mul epilogue of cpu backend). It is only for Execution::execute,
+  //      so run_async, batch sizes and pipeline of nnfw API do not profile or reschedule.
+  bool he_online_profiling;        //< Whether to keep profiling during normal runs
+  int he_online_sampling_period;   //< Profile one of this number of runs
+  int he_online_reschedule_period; //< Number of runs between reschedulings with new profiles
+  // Profiles shared by executors of all compilations with these options, set by Compiler
+  std::shared_ptr<exec::OnlineExecTime> he_online_exec_time;
 };
 
 CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs);
@@ -102,6 +118,7 @@ public:
 
 private:
   void checkProfilerConditions();
+  void checkOnlineProfilerConditions();
   std::shared_ptr<ir::Graph> &primary_subgraph() { return _subgraphs->at(ir::SubgraphIndex{0}); }
 
 private:
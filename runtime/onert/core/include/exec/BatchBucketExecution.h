@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  BatchBucketExecution.h
+ * @brief This file defines execution over a set of executors compiled for several batch sizes
+ */
+#ifndef __ONERT_EXEC_BATCH_BUCKET_EXECUTION_H__
+#define __ONERT_EXEC_BATCH_BUCKET_EXECUTION_H__
+
+#include "exec/Execution.h"
+
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to run a model compiled statically for several batch sizes(buckets)
+ *
+ * Each bucket is a set of executors compiled with the batch dimension(axis 0) of every model
+ * input fixed to the bucket size, so all tensors stay static. A requested batch size selects the
+ * smallest bucket that can hold it. When the batch is smaller than the bucket, inputs are copied
+ * into zero-padded staging buffers and only the first rows of outputs are copied back to user
+ * buffers. So changing the batch size never goes through dynamic shape inference.
+ *
+ * @note  Every model input and output must have the batch on axis 0
+ */
+class BatchBucketExecution
+{
+public:
+  /**
+   * @brief     Construct a new BatchBucketExecution object
+   * @param[in] buckets Executors of each batch size, keyed by the batch size
+   */
+  BatchBucketExecution(const std::map<uint32_t, std::shared_ptr<ExecutorMap>> &buckets);
+
+public:
+  /**
+   * @brief     Select the bucket to run the given batch size
+   * @param[in] batch_size Number of samples to be given by user
+   * @note      It should be called before setting input and output buffers
+   */
+  void setBatchSize(uint32_t batch_size);
+  /**
+   * @brief   Returns the batch size that user gives
+   */
+  uint32_t batchSize() const { return _batch_size; }
+  /**
+   * @brief   Returns the batch size the selected bucket is compiled for
+   */
+  uint32_t bucketSize() const { return _bucket_it->first; }
+  /**
+   * @brief   Returns the execution of the selected bucket
+   */
+  const std::shared_ptr<Execution> &execution() const { return _bucket_it->second; }
+
+  /**
+   * @brief     Set input data's buffer holding @c batchSize() samples
+   * @param[in] index   Input index
+   * @param[in] buffer  Input data's buffer pointer
+   * @param[in] length  Input data's length
+   */
+  void setInput(const ir::IOIndex &index, const void *buffer, size_t length);
+  /**
+   * @brief     Set output data's buffer holding @c batchSize() samples
+   * @param[in] index   Output index
+   * @param[in] buffer  Output data's buffer pointer
+   * @param[in] length  Output data's length
+   */
+  void setOutput(const ir::IOIndex &index, void *buffer, size_t length);
+
+  /**
+   * @brief  Execution
+   * @note   It should be called after setting input and output buffer
+   */
+  void execute();
+  /**
+   * @brief Start asynchronous execution
+   */
+  void startExecute(void);
+  /**
+   * @brief Return when execution is finished
+   */
+  void waitFinish(void);
+
+  ir::Shape getInputShape(ir::IOIndex ind) const;
+  ir::Shape getOutputShape(ir::IOIndex ind) const;
+
+  /**
+   * @brief   Returns bytes of one sample of the input
+   */
+  size_t inputSampleSize(const ir::IOIndex &index) const;
+  /**
+   * @brief   Returns bytes of one sample of the output
+   */
+  size_t outputSampleSize(const ir::IOIndex &index) const;
+
+private:
+  struct Padding
+  {
+    const uint8_t *user_input{nullptr};
+    uint8_t *user_output{nullptr};
+    size_t user_size{0};             //< Bytes of @c batchSize() samples
+    std::vector<uint8_t> staging{}; //< Buffer of @c bucketSize() samples given to execution
+  };
+
+  bool padded() const { return _batch_size != bucketSize(); }
+
+private:
+  std::map<uint32_t, std::shared_ptr<Execution>> _buckets;
+  std::map<uint32_t, std::shared_ptr<Execution>>::const_iterator _bucket_it;
+  uint32_t _batch_size;
+  std::vector<Padding> _input_paddings;
+  std::vector<Padding> _output_paddings;
+  std::unique_ptr<std::thread> _exec_thread;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_BATCH_BUCKET_EXECUTION_H__
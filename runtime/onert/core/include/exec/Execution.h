@@ -142,6 +142,15 @@ public:
   ir::Shape getInputShape(ir::IOIndex ind) const;
   ir::Shape getOutputShape(ir::IOIndex ind) const;
 
+  /**
+   * @brief     Replace executors with ones compiled from the same model, keeping input and output
+   *            information already set
+   * @param[in] executors New executors
+   * @return    Previous executors
+   * @note      It must not be called during execution
+   */
+  std::shared_ptr<ExecutorMap> replaceExecutors(const std::shared_ptr<ExecutorMap> &executors);
+
 private:
   const std::unique_ptr<IExecutor> &primary_executor() const
   {
@@ -150,7 +159,7 @@ private:
   std::unique_ptr<IExecutor> &primary_executor() { return _executors->at(ir::SubgraphIndex{0}); };
 
 private:
-  const std::shared_ptr<ExecutorMap> _executors;
+  std::shared_ptr<ExecutorMap> _executors;
   IODescription _io_desc;
   std::unique_ptr<std::thread> _exec_thread;
   bool finished{false};
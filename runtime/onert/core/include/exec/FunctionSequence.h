@@ -107,6 +107,36 @@ public: // methods related to dynamic tensor
     _enable_dynamic_shape_inferer = _enable_dynamic_shape_inferer && enable;
   }
 
+  /**
+   * @brief Number of operations whose dynamic shape inference was skipped with memoized shapes
+   */
+  uint64_t shapeMemoHits() const { return _shape_memo_hits; }
+
+  /**
+   * @brief Number of operations whose dynamic shape inference ran, including when memoization is
+   *        disabled
+   */
+  uint64_t shapeMemoMisses() const { return _shape_memo_misses; }
+
+private:
+  /**
+   * @brief Shape signature of an operation seen when its shape inference ran last time
+   * @note  Integer inputs of at most 16 elements are keyed on their values as they may decide
+   *        output shapes. Operations having a bigger integer input are not memoized.
+   */
+  struct ShapeMemo
+  {
+    bool valid = false;
+    std::vector<ir::Shape> input_shapes;
+    std::vector<std::vector<uint8_t>> input_values; //< Values of inputs that may decide shapes
+    std::vector<ir::Shape> output_shapes;
+  };
+
+  void initShapeMemos();
+  bool hitShapeMemo(const ir::Operation &op, const ShapeMemo &memo) const;
+  void allocShapeMemoOutputs(const ir::Operation &op, const ShapeMemo &memo) const;
+  void recordShapeMemo(const ir::Operation &op, ShapeMemo &memo) const;
+
 protected:
   std::vector<std::unique_ptr<IFunction>> _functions;
 
@@ -114,6 +144,14 @@ protected:
   bool _enable_dynamic_shape_inferer = true;
 
   std::shared_ptr<DynamicTensorCtx> _dynamic_tensor_ctx = nullptr;
+
+private:
+  // Memoization of dynamic shape inference, one for each operation of op_seq
+  bool _shape_memo_initialized = false;
+  bool _enable_shape_memo = false;
+  std::vector<ShapeMemo> _shape_memos;
+  uint64_t _shape_memo_hits = 0;
+  uint64_t _shape_memo_misses = 0;
 };
 
 } // namespace exec
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  OnlineRescheduler.h
+ * @brief This file defines OnlineRescheduler which recompiles a model with new profiles on the fly
+ */
+#ifndef __ONERT_EXEC_ONLINE_RESCHEDULER_H__
+#define __ONERT_EXEC_ONLINE_RESCHEDULER_H__
+
+#include "exec/Execution.h"
+
+#include <chrono>
+#include <functional>
+#include <future>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to run an execution while rescheduling its model in background
+ *
+ * Every @c period runs, the model is compiled again in background with the given function, which
+ * is expected to use HEScheduler with execution times profiled so far. When compilation is done,
+ * the new executors replace the current ones for the next @c period runs as a trial. They are kept
+ * only if the average latency of the trial is shorter than the one of the previous @c period runs,
+ * otherwise the previous executors are restored.
+ */
+class OnlineRescheduler
+{
+public:
+  using CompileFn = std::function<std::shared_ptr<ExecutorMap>(void)>;
+
+public:
+  /**
+   * @brief     Construct a new OnlineRescheduler object
+   * @param[in] execution Execution to run
+   * @param[in] compile   Function to compile the model again, called on a background thread
+   * @param[in] period    Number of runs to measure the average latency of executors
+   */
+  OnlineRescheduler(const std::shared_ptr<Execution> &execution, const CompileFn &compile,
+                    uint32_t period);
+  /**
+   * @brief Destroy the OnlineRescheduler object after background compilation is finished
+   */
+  ~OnlineRescheduler();
+
+public:
+  /**
+   * @brief  Run the execution, and replace its executors if needed
+   * @note   It should be called after setting input and output buffer of the execution
+   */
+  void execute();
+
+  /**
+   * @brief   Returns the number of times executors are replaced and kept
+   */
+  uint32_t replacedCount() const { return _replaced_count; }
+
+private:
+  void endWindow();
+
+private:
+  std::shared_ptr<Execution> _execution;
+  CompileFn _compile;
+  const uint32_t _period;
+  uint32_t _window_runs{0};
+  std::chrono::steady_clock::duration _window_time{0};
+  std::future<std::shared_ptr<ExecutorMap>> _candidate; //< Executors being compiled
+  std::shared_ptr<ExecutorMap> _previous;               //< Executors before the trial
+  std::chrono::steady_clock::duration _previous_latency{0};
+  uint32_t _replaced_count{0};
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_ONLINE_RESCHEDULER_H__
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  PipelineExecution.h
+ * @brief This file defines PipelineExecution which runs models chained as pipeline stages
+ */
+#ifndef __ONERT_EXEC_PIPELINE_EXECUTION_H__
+#define __ONERT_EXEC_PIPELINE_EXECUTION_H__
+
+#include "exec/Execution.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to run several models chained as stages of a pipeline
+ *
+ * Inputs of stage k+1 are connected to outputs of stage k. Each stage runs on its own thread
+ * with requests queued in order, so stage k of a request overlaps stage k-1 of the next request.
+ * Inputs of the pipeline are inputs of the first stage, and outputs of the pipeline are outputs
+ * of the last stage.
+ *
+ * @note  All tensors connecting stages must have static shapes
+ */
+class PipelineExecution
+{
+public:
+  /**
+   * @brief Latency statistics of a stage
+   */
+  struct StageStat
+  {
+    uint64_t runs = 0;                       //< Number of requests run by the stage
+    std::chrono::microseconds total_run{0};  //< Sum of execution time
+    std::chrono::microseconds max_run{0};    //< Longest execution time
+    std::chrono::microseconds total_wait{0}; //< Sum of time requests waited for the stage
+  };
+
+public:
+  /**
+   * @brief     Construct a new PipelineExecution object and start a thread for each stage
+   * @param[in] stages      Executors of each stage in order
+   * @param[in] connections For each stage except the first, output indices of the previous stage
+   *                        connected to its inputs in order
+   */
+  PipelineExecution(const std::vector<std::shared_ptr<ExecutorMap>> &stages,
+                    const std::vector<std::vector<uint32_t>> &connections);
+  /**
+   * @brief Destroy the PipelineExecution object after running all submitted requests
+   */
+  ~PipelineExecution();
+
+public:
+  /**
+   * @brief     Submit a request to the pipeline
+   * @param[in] inputs  Input buffers, one for each input of the first stage
+   * @param[in] outputs Output buffers, one for each output of the last stage
+   * @return    Future which is ready when the request is finished
+   * @note      This method is thread-safe. Buffers must be valid until the request is finished.
+   */
+  std::future<void> submit(const std::vector<const void *> &inputs,
+                           const std::vector<void *> &outputs);
+  /**
+   * @brief     Run a request, blocking until it is finished
+   * @param[in] inputs  Input buffers, one for each input of the first stage
+   * @param[in] outputs Output buffers, one for each output of the last stage
+   */
+  void run(const std::vector<const void *> &inputs, const std::vector<void *> &outputs)
+  {
+    submit(inputs, outputs).get();
+  }
+
+  size_t stageSize() const { return _stages.size(); }
+  /**
+   * @brief   Returns primary graph of the stage
+   */
+  const ir::Graph &stageGraph(size_t stage) const;
+  /**
+   * @brief   Returns latency statistics of the stage so far
+   */
+  StageStat stageStat(size_t stage) const;
+
+  /**
+   * @brief   Returns bytes of the input of the pipeline
+   */
+  size_t inputSize(const ir::IOIndex &index) const;
+  /**
+   * @brief   Returns bytes of the output of the pipeline
+   */
+  size_t outputSize(const ir::IOIndex &index) const;
+
+private:
+  struct Request
+  {
+    std::vector<const void *> inputs;
+    std::vector<void *> outputs;
+    // Outputs of each stage except the last one
+    std::vector<std::vector<std::vector<uint8_t>>> stage_outputs;
+    std::promise<void> done;
+    std::chrono::steady_clock::time_point enqueued; //< When it is queued to the current stage
+  };
+
+  struct Stage
+  {
+    std::unique_ptr<Execution> execution;
+    std::vector<uint32_t> connection; //< Output indices of the previous stage for each input
+    std::deque<std::unique_ptr<Request>> queue;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool terminating = false;
+    StageStat stat;
+    std::thread thread;
+  };
+
+  void enqueue(size_t stage, std::unique_ptr<Request> request);
+  void worker(size_t stage);
+  void runStage(size_t stage, Request &request);
+
+private:
+  std::vector<std::unique_ptr<Stage>> _stages;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_PIPELINE_EXECUTION_H__
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  RequestBatcher.h
+ * @brief This file defines RequestBatcher which coalesces single-sample requests into batches
+ */
+#ifndef __ONERT_EXEC_REQUEST_BATCHER_H__
+#define __ONERT_EXEC_REQUEST_BATCHER_H__
+
+#include "exec/BatchBucketExecution.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to run single-sample requests as batched inferences
+ *
+ * Requests are queued by any number of threads. A worker thread waits until @c max_batch
+ * requests are pending or the oldest pending request has waited for the latency budget, then
+ * gathers their inputs along the batch axis(axis 0), runs one inference on
+ * @c BatchBucketExecution and scatters outputs back to each request's buffers.
+ */
+class RequestBatcher
+{
+public:
+  /**
+   * @brief     Construct a new RequestBatcher object and start its worker thread
+   * @param[in] execution      Execution compiled for batch sizes up to @c max_batch
+   * @param[in] max_batch      Maximum number of requests run at once
+   * @param[in] latency_budget Maximum time a request waits for other requests
+   */
+  RequestBatcher(const std::shared_ptr<BatchBucketExecution> &execution, uint32_t max_batch,
+                 std::chrono::microseconds latency_budget);
+  /**
+   * @brief Destroy the RequestBatcher object after running all pending requests
+   */
+  ~RequestBatcher();
+
+public:
+  /**
+   * @brief     Run one sample, blocking until its batch is finished
+   * @param[in] inputs  Input buffers of one sample, one for each model input
+   * @param[in] outputs Output buffers of one sample, one for each model output
+   * @note      This method is thread-safe. Buffers must hold one sample each.
+   */
+  void run(const std::vector<const void *> &inputs, const std::vector<void *> &outputs);
+
+  uint32_t maxBatch() const { return _max_batch; }
+
+private:
+  struct Request
+  {
+    std::vector<const void *> inputs;
+    std::vector<void *> outputs;
+    std::promise<void> done;
+    std::chrono::steady_clock::time_point enqueued;
+  };
+
+  void worker();
+  void runBatch(std::vector<std::unique_ptr<Request>> &batch);
+
+private:
+  std::shared_ptr<BatchBucketExecution> _execution;
+  const uint32_t _max_batch;
+  const std::chrono::microseconds _latency_budget;
+  std::vector<size_t> _input_sample_sizes;
+  std::vector<size_t> _output_sample_sizes;
+  std::vector<std::vector<uint8_t>> _input_buffers;  //< Gathered inputs of a batch
+  std::vector<std::vector<uint8_t>> _output_buffers; //< Outputs of a batch to be scattered
+  std::deque<std::unique_ptr<Request>> _pending;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  bool _terminating{false};
+  std::thread _worker;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_REQUEST_BATCHER_H__
@@ -51,6 +51,7 @@
 #include "ir/operation/RSQRT.h"
 #include "ir/operation/ReLU.h"
 #include "ir/operation/ResizeBilinear.h"
+#include "ir/operation/ResizeNearestNeighbor.h"
 #include "ir/operation/ReLU1.h"
 #include "ir/operation/ReLU6.h"
 #include "ir/operation/Reverse.h"
@@ -18,6 +18,7 @@
 #define __ONERT_IR_TYPEINFO_H__
 
 #include <cstdint>
+#include <vector>
 
 #include "ir/DataType.h"
 
@@ -40,14 +41,21 @@ public:
   DataType type() const { return _type; }
   float scale() const { return _scale; }
   int32_t offset() const { return _offset; }
+  /**
+   * @brief Return scales of each output channel for per-channel quantized weights
+   * @note  Empty if the tensor is quantized with one scale of @c scale()
+   */
+  const std::vector<float> &scales() const { return _scales; }
 
 public:
   void type(const DataType type) { _type = type; }
+  void scales(const std::vector<float> &scales) { _scales = scales; }
 
 private:
   DataType _type;
   float _scale;
   int32_t _offset;
+  std::vector<float> _scales;
 };
 
 bool operator==(const TypeInfo &lhs, const TypeInfo &rhs);
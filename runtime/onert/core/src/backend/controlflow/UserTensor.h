@@ -67,6 +67,7 @@ public:
   ir::Layout layout() const override { return _layout; }
   ir::DataType data_type() const override { return _info.typeInfo().type(); }
   float data_scale() const override { return _info.typeInfo().scale(); }
+  const std::vector<float> &data_scales() const override { return _info.typeInfo().scales(); }
   int32_t data_offset() const override { return _info.typeInfo().offset(); }
   bool is_dynamic() const override { return _dynamic; }
   void set_dynamic() override { _dynamic = true; }
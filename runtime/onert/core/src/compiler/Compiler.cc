@@ -54,6 +54,9 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
   options.executor = util::getConfigString(util::config::EXECUTOR);
   options.he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
   options.he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
+  options.he_online_profiling = util::getConfigBool(util::config::PROFILING_ONLINE);
+  options.he_online_sampling_period = util::getConfigInt(util::config::PROFILING_SAMPLING);
+  options.he_online_reschedule_period = util::getConfigInt(util::config::RESCHEDULE_PERIOD);
   options.disable_compile = util::getConfigBool(util::config::DISABLE_COMPILE);
   options.fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
 #ifdef RUY_PROFILER
@@ -124,6 +127,18 @@ void Compiler::checkProfilerConditions()
     throw std::runtime_error("Profiling mode works only with 'Dataflow' executor");
 }
 
+void Compiler::checkOnlineProfilerConditions()
+{
+  if (!_options.he_scheduler)
+    throw std::runtime_error("Heterogeneous scheduler must be enabled during online profiling.");
+
+  if (_options.he_profiling_mode)
+    throw std::runtime_error("Online profiling cannot be used with profiling mode");
+
+  if (_options.he_online_sampling_period <= 0 || _options.he_online_reschedule_period <= 0)
+    throw std::runtime_error("Online profiling periods must be positive");
+}
+
 std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
 {
   // Set control flow backend for control flow operators
@@ -148,6 +163,8 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
     VERBOSE(Compiler) << "manual_scheduler_options : (Too many things to print)" << std::endl;
     VERBOSE(Compiler) << "he_scheduler             : " << _options.he_scheduler << std::endl;
     VERBOSE(Compiler) << "he_profiling_mode        : " << _options.he_profiling_mode << std::endl;
+    VERBOSE(Compiler) << "he_online_profiling      : " << _options.he_online_profiling
+                      << std::endl;
     VERBOSE(Compiler) << "disable_compile          : " << _options.disable_compile << std::endl;
     VERBOSE(Compiler) << "fp16_enable              : " << _options.fp16_enable << std::endl;
     VERBOSE(Compiler) << std::noboolalpha;
@@ -174,6 +191,13 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
   // Mode check
   if (_options.he_profiling_mode)
     checkProfilerConditions();
+  if (_options.he_online_profiling)
+  {
+    checkOnlineProfilerConditions();
+    // Write profiles of previous compilations for HEScheduler, which loads them from the file
+    if (_options.he_online_exec_time)
+      _options.he_online_exec_time->flush();
+  }
 
   /***************************************************
    * Backend independent analysis & optimization phase
@@ -234,6 +258,12 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
     compiler::OperationValidator{lowered_subg->graph()}();
   }
 
+  if (_options.he_online_profiling && !_options.he_online_exec_time)
+  {
+    _options.he_online_exec_time =
+        std::make_shared<exec::OnlineExecTime>(BackendManager::get().getAll());
+  }
+
   executors = std::make_shared<exec::ExecutorMap>();
   for (auto &pair : lowered_subgs)
   {
@@ -231,6 +231,15 @@ void ExecutorFactory::prepareExternalTensors(ir::LoweredGraph &lowered_graph,
       });
 }
 
+void ExecutorFactory::addOnlineProfileObserver(exec::ExecutorBase *exec,
+                                               const compiler::CompilerOptions &options)
+{
+  assert(options.he_online_exec_time != nullptr);
+  std::unique_ptr<exec::IExecutionObserver> obs = std::make_unique<exec::OnlineProfileObserver>(
+      options.he_online_exec_time, exec->graph(), options.he_online_sampling_period);
+  exec->addObserver(std::move(obs));
+}
+
 exec::IExecutor *
 ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
                                       const compiler::CompilerOptions &options,
@@ -339,6 +348,11 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_
       new exec::LinearExecutor{std::move(lowered_graph), input_tensors,       output_tensors,
                                tensor_builders,          std::move(code_map), order};
 
+  if (options.he_online_profiling)
+  {
+    addOnlineProfileObserver(exec, options);
+  }
+
   if (!options.trace_filepath.empty())
   {
     std::unique_ptr<exec::IExecutionObserver> ctp =
@@ -466,6 +480,11 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     exec = dataflow_exec;
   }
 
+  if (options.he_online_profiling)
+  {
+    addOnlineProfileObserver(exec, options);
+  }
+
   if (!options.trace_filepath.empty())
   {
     std::unique_ptr<exec::IExecutionObserver> ctp =
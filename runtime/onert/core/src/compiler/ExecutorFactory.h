@@ -20,6 +20,7 @@
 #include <unordered_map>
 
 #include "backend/ITensor.h"
+#include "exec/ExecutorBase.h"
 #include "exec/IExecutor.h"
 #include "ir/LoweredGraph.h"
 #include "TensorBuilders.h"
@@ -51,6 +52,8 @@ private:
                            const ir::OperandIndexSequence &indices);
   static void prepareExternalTensors(ir::LoweredGraph &lowered_graph,
                                      TensorBuilders &tensor_builders);
+  static void addOnlineProfileObserver(exec::ExecutorBase *exec,
+                                       const compiler::CompilerOptions &options);
   static exec::IExecutor *
   createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
                        const compiler::CompilerOptions &options,
@@ -19,6 +19,7 @@
 #include "ir/Graph.h"
 #include "util/ConfigSource.h"
 #include "compiler/BackendResolver.h"
+#include "backend/controlflow/Config.h"
 #include "util/logging.h"
 #include "util/Utils.h"
 #include "exec/FunctionSequence.h"
@@ -287,7 +288,7 @@ int64_t HEScheduler::getPermuteTime(const backend::Backend *src_backend,
 int64_t HEScheduler::tryBackend(const ir::Operation &node, const backend::Backend *backend)
 {
   // if there is no profiling info don't use this backend during scheduling
-  if (!_is_profiling_mode)
+  if (!_is_profiling_mode && !_is_online_profiling)
   {
     VERBOSE(HEScheduler::tryBackend)
         << "Trying to HE schedule while there is no profiling info for " << node.name()
@@ -309,7 +310,11 @@ int64_t HEScheduler::tryBackend(const ir::Operation &node, const backend::Backen
   {
     // DO NOTHING
 
-    _is_supported[backend][node.name()] = true;
+    // With online profiling, backends are tried without a profiling run, so the controlflow
+    // backend that has kernels only for control flow operations is excluded here
+    _is_supported[backend][node.name()] =
+        !_is_online_profiling || backend->config()->id() != backend::controlflow::Config::ID ||
+        node.opcode() == ir::OpCode::If || node.opcode() == ir::OpCode::While;
   }
   catch (std::runtime_error &e)
   {
@@ -54,6 +54,7 @@ public:
       : _is_supported{}, _backends_avail_time{}, _ops_eft{},
         _op_to_rank{std::make_shared<ir::OperationIndexMap<int64_t>>()},
         _is_profiling_mode{options.he_profiling_mode},
+        _is_online_profiling{options.he_online_profiling},
         _is_linear_exec{options.executor == "Linear"},
         _is_parallel_exec{options.executor == "Parallel"}
   {
@@ -173,6 +174,8 @@ private:
   std::vector<const backend::Backend *> _all_backends;
   const backend::Backend *_cpu_backend{nullptr}; // TODO Change this to controlflow_backend
   bool _is_profiling_mode;
+  // With online profiling, backends without profiling info are tried so that they get profiled
+  bool _is_online_profiling;
   bool _is_linear_exec;
   bool _is_parallel_exec;
 };
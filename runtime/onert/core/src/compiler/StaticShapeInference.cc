@@ -396,6 +396,11 @@ void StaticShapeInferer::visit(const ir::operation::Gather &op)
   output.info().shape(new_shape);
 }
 
+void StaticShapeInferer::visit(const ir::operation::InstanceNorm &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::InstanceNorm::Input::INPUT));
+}
+
 void StaticShapeInferer::visit(const ir::operation::If &op)
 {
   auto &then_graph = _lowered_subgs.at(op.param().then_subg_index)->graph();
@@ -502,6 +507,12 @@ void StaticShapeInferer::visit(const ir::operation::L2Normalization &op)
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::L2Normalization::Input::INPUT));
 }
 
+void StaticShapeInferer::visit(const ir::operation::LocalResponseNormalization &op)
+{
+  handleSimpleUnaryOp(op,
+                      op.getInputs().at(ir::operation::LocalResponseNormalization::Input::INPUT));
+}
+
 void StaticShapeInferer::visit(const ir::operation::MatrixBandPart &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::MatrixBandPart::Input::INPUT));
@@ -660,6 +671,12 @@ void StaticShapeInferer::visit(const ir::operation::Pow &op)
                            op.getInputs().at(ir::operation::Pow::Input::RHS));
 }
 
+void StaticShapeInferer::visit(const ir::operation::PReLU &op)
+{
+  handleBinaryArithmeticOp(op, op.getInputs().at(ir::operation::PReLU::Input::INPUT),
+                           op.getInputs().at(ir::operation::PReLU::Input::ALPHA));
+}
+
 void StaticShapeInferer::visit(const ir::operation::Range &op)
 {
   const auto start_idx{op.getInputs().at(ir::operation::Range::Input::START)};
@@ -847,6 +864,34 @@ void StaticShapeInferer::visit(const ir::operation::ResizeBilinear &op)
   }
 }
 
+void StaticShapeInferer::visit(const ir::operation::ResizeNearestNeighbor &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::ResizeNearestNeighbor::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  // if input is dynamic, output also becomes dynamic
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    _return_has_dynamic_tensor = true;
+    return;
+  }
+
+  // Output shape is the same as ResizeBilinear of the same size
+  ir::Shape new_shape = shape_inference::inferResizeBilinearShape(
+      input.shape(), op.param().height_out, op.param().width_out);
+
+  if (new_shape != output.shape())
+  {
+    // change on output shape
+    output.info().shape(new_shape);
+  }
+}
+
 void StaticShapeInferer::visit(const ir::operation::Reverse &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::Reverse::Input::INPUT));
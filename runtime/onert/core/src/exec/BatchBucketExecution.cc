@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/BatchBucketExecution.h"
+
+#include "util/logging.h"
+
+#include <cstring>
+
+namespace onert
+{
+namespace exec
+{
+
+namespace
+{
+
+size_t sampleSize(const ir::OperandInfo &info, uint32_t bucket_size)
+{
+  const auto &shape = info.shape();
+  if (shape.rank() == 0 || shape.dim(0) != static_cast<int32_t>(bucket_size))
+    throw std::runtime_error{"BatchBucketExecution: batch must be on axis 0 of all inputs/outputs"};
+
+  return info.total_size() / bucket_size;
+}
+
+} // namespace
+
+BatchBucketExecution::BatchBucketExecution(
+    const std::map<uint32_t, std::shared_ptr<ExecutorMap>> &buckets)
+{
+  if (buckets.empty())
+    throw std::runtime_error{"BatchBucketExecution: no bucket is given"};
+
+  for (auto &bucket : buckets)
+  {
+    if (bucket.first == 0)
+      throw std::runtime_error{"BatchBucketExecution: bucket size must be positive"};
+    _buckets.emplace(bucket.first, std::make_shared<Execution>(bucket.second));
+  }
+
+  _bucket_it = _buckets.begin();
+  _batch_size = _bucket_it->first;
+
+  const auto &primary_subg = execution()->primary_subgraph();
+  _input_paddings.resize(primary_subg.getInputs().size());
+  _output_paddings.resize(primary_subg.getOutputs().size());
+}
+
+void BatchBucketExecution::setBatchSize(uint32_t batch_size)
+{
+  if (batch_size == 0)
+    throw std::runtime_error{"BatchBucketExecution: batch size must be positive"};
+
+  auto bucket_it = _buckets.lower_bound(batch_size);
+  if (bucket_it == _buckets.end())
+    throw std::runtime_error{"BatchBucketExecution: batch size " + std::to_string(batch_size) +
+                             " exceeds the largest bucket " +
+                             std::to_string(_buckets.rbegin()->first)};
+
+  if (bucket_it != _bucket_it || batch_size != _batch_size)
+  {
+    // Buffers given for the previous batch size are not valid anymore
+    for (auto &padding : _input_paddings)
+      padding = Padding{};
+    for (auto &padding : _output_paddings)
+      padding = Padding{};
+  }
+
+  VERBOSE(BatchBucketExecution) << "Batch " << batch_size << " runs on bucket " << bucket_it->first
+                                << std::endl;
+
+  _bucket_it = bucket_it;
+  _batch_size = batch_size;
+}
+
+size_t BatchBucketExecution::inputSampleSize(const ir::IOIndex &index) const
+{
+  const auto &graph = execution()->primary_subgraph();
+  const auto &info = graph.operands().at(graph.getInputs().at(index)).info();
+  return sampleSize(info, bucketSize());
+}
+
+size_t BatchBucketExecution::outputSampleSize(const ir::IOIndex &index) const
+{
+  const auto &graph = execution()->primary_subgraph();
+  const auto &info = graph.operands().at(graph.getOutputs().at(index)).info();
+  return sampleSize(info, bucketSize());
+}
+
+void BatchBucketExecution::setInput(const ir::IOIndex &index, const void *buffer, size_t length)
+{
+  if (!padded())
+  {
+    execution()->setInput(index, buffer, length);
+    return;
+  }
+
+  const auto user_size = inputSampleSize(index) * _batch_size;
+  if (length < user_size)
+    throw std::runtime_error{"Too small length"};
+
+  auto &padding = _input_paddings.at(index.value());
+  padding.user_input = static_cast<const uint8_t *>(buffer);
+  padding.user_size = user_size;
+  // Rows after batch size stay zero
+  padding.staging.assign(inputSampleSize(index) * bucketSize(), 0);
+  execution()->setInput(index, padding.staging.data(), padding.staging.size());
+}
+
+void BatchBucketExecution::setOutput(const ir::IOIndex &index, void *buffer, size_t length)
+{
+  if (!padded())
+  {
+    execution()->setOutput(index, buffer, length);
+    return;
+  }
+
+  const auto user_size = outputSampleSize(index) * _batch_size;
+  if (length < user_size)
+    throw std::runtime_error{"Too small length"};
+
+  auto &padding = _output_paddings.at(index.value());
+  padding.user_output = static_cast<uint8_t *>(buffer);
+  padding.user_size = user_size;
+  padding.staging.resize(outputSampleSize(index) * bucketSize());
+  execution()->setOutput(index, padding.staging.data(), padding.staging.size());
+}
+
+void BatchBucketExecution::execute()
+{
+  // User may update input buffers after setInput, so copy them right before execution
+  for (auto &padding : _input_paddings)
+  {
+    if (padding.user_input != nullptr)
+      std::memcpy(padding.staging.data(), padding.user_input, padding.user_size);
+  }
+
+  execution()->execute();
+
+  for (auto &padding : _output_paddings)
+  {
+    if (padding.user_output != nullptr)
+      std::memcpy(padding.user_output, padding.staging.data(), padding.user_size);
+  }
+}
+
+void BatchBucketExecution::startExecute()
+{
+  VERBOSE(BatchBucketExecution) << "Create asynchronous execution thread" << std::endl;
+
+  _exec_thread = std::make_unique<std::thread>(&BatchBucketExecution::execute, this);
+}
+
+void BatchBucketExecution::waitFinish()
+{
+  VERBOSE(BatchBucketExecution) << "Wait to finish execution" << std::endl;
+
+  _exec_thread->join();
+}
+
+ir::Shape BatchBucketExecution::getInputShape(ir::IOIndex ind) const
+{
+  auto shape = execution()->getInputShape(ind);
+  if (shape.rank() > 0)
+    shape.dim(0) = _batch_size;
+  return shape;
+}
+
+ir::Shape BatchBucketExecution::getOutputShape(ir::IOIndex ind) const
+{
+  // All tensors of a bucket are static, so it can be given even before execution
+  const auto &graph = execution()->primary_subgraph();
+  auto shape = graph.operands().at(graph.getOutputs().at(ind)).shape();
+  if (shape.rank() > 0)
+    shape.dim(0) = _batch_size;
+  return shape;
+}
+
+} // namespace exec
+} // namespace onert
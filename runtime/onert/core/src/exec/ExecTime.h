@@ -23,6 +23,7 @@
 #include <memory>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -106,6 +107,48 @@ private:
   JSON _json;
 };
 
+/**
+ * @brief ExecTime shared by all executors that keep profiling during normal runs
+ *
+ * Measurements are updated from inference threads, while the measurement file is written only by
+ * flush(), which is called off the inference path and when the last owner is destroyed.
+ */
+class OnlineExecTime
+{
+public:
+  explicit OnlineExecTime(const std::vector<const backend::Backend *> &backends) : _et{backends}
+  {
+  }
+  ~OnlineExecTime() { flush(); }
+
+public:
+  /**
+   * @brief Update measurements with fn, which is given ExecTime under lock
+   */
+  template <typename Fn> void update(Fn fn)
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    fn(_et);
+    _dirty = true;
+  }
+  /**
+   * @brief Write measurements to the metrics file if there are new ones
+   */
+  void flush()
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (!_dirty)
+      return;
+    _et.uploadOperationsExecTime();
+    _dirty = false;
+  }
+
+private:
+  std::mutex _mutex;
+  ExecTime _et;
+  bool _dirty = false;
+};
+
 } // namespace exec
 } // namespace onert
 
@@ -32,6 +32,20 @@ Execution::Execution(const std::shared_ptr<ExecutorMap> &executors) : _executors
   _io_desc.outputs.resize(primary_subg.getOutputs().size());
 }
 
+std::shared_ptr<ExecutorMap>
+Execution::replaceExecutors(const std::shared_ptr<ExecutorMap> &executors)
+{
+  assert(executors != nullptr);
+  const auto &subg = executors->at(ir::SubgraphIndex{0})->graph();
+  if (subg.getInputs().size() != _io_desc.inputs.size() ||
+      subg.getOutputs().size() != _io_desc.outputs.size())
+    throw std::runtime_error{"Executors to replace have different inputs or outputs"};
+
+  auto previous = _executors;
+  _executors = executors;
+  return previous;
+}
+
 void Execution::changeInputShape(const ir::IOIndex &index, const ir::Shape &new_shape)
 {
   // This should be called BEFORE setInput.
@@ -29,46 +29,101 @@ namespace onert
 namespace exec
 {
 
-void ProfileObserver::handleBegin(onert::exec::IExecutor *, const ir::OpSequence *,
-                                  const onert::backend::Backend *backend)
+namespace
 {
-  _timer = backend->config()->timer();
-  if (_timer == nullptr)
-    throw std::runtime_error("To profile backend timer() method must be implemented");
-  _timer->handleBegin();
-}
 
-void ProfileObserver::handleEnd(IExecutor *exec, const ir::OpSequence *op_seq,
-                                const backend::Backend *backend)
+void updateExecTime(ExecTime &et, const ir::Graph &graph, const ir::OpSequence *op_seq,
+                    const backend::Backend *backend, int64_t time)
 {
-  _timer->handleEnd();
-  const auto timer_res = _timer->getTime();
-
   // NOTE This assumes there is just one operation in a op_seq
-  const auto &node = _graph.operations().at(op_seq->operations().at(0));
+  const auto &node = graph.operations().at(op_seq->operations().at(0));
   auto node_name = node.name();
-  VERBOSE(ProfileInfo) << "Time for " << node_name << " : " << timer_res << std::endl;
+  VERBOSE(ProfileInfo) << "Time for " << node_name << " : " << time << std::endl;
 
   // fill ExecTime:
-  bool is_quantized = exec->graph().operands().at(node.getInputs().at(0)).typeInfo().type() ==
+  bool is_quantized = graph.operands().at(node.getInputs().at(0)).typeInfo().type() ==
                       ir::DataType::QUANT_UINT8_ASYMM;
 
   uint32_t size = 0;
   for (const auto &ind : node.getInputs() + node.getOutputs())
   {
-    size += exec->graph().operands().at(ind).info().total_size();
+    size += graph.operands().at(ind).info().total_size();
   }
   if (node_name == "Permute")
   {
     // TODO Change it to updateOperationExecTime()
-    _et->updatePermuteTime(backend, backend, is_quantized, size, timer_res);
+    et.updatePermuteTime(backend, backend, is_quantized, size, time);
   }
   else
   {
-    _et->updateOperationExecTime(backend, node_name, is_quantized, size, timer_res);
+    et.updateOperationExecTime(backend, node_name, is_quantized, size, time);
   }
+}
+
+} // namespace
+
+void ProfileObserver::handleBegin(onert::exec::IExecutor *, const ir::OpSequence *,
+                                  const onert::backend::Backend *backend)
+{
+  _timer = backend->config()->timer();
+  if (_timer == nullptr)
+    throw std::runtime_error("To profile backend timer() method must be implemented");
+  _timer->handleBegin();
+}
+
+void ProfileObserver::handleEnd(IExecutor *, const ir::OpSequence *op_seq,
+                                const backend::Backend *backend)
+{
+  _timer->handleEnd();
+  const auto timer_res = _timer->getTime();
+
+  updateExecTime(*_et, _graph, op_seq, backend, timer_res);
 };
 
+void OnlineProfileObserver::handleBegin(IExecutor *)
+{
+  _sampling = (_runs++ % _sampling_period == 0);
+}
+
+void OnlineProfileObserver::handleBegin(IExecutor *, const ir::OpSequence *op_seq,
+                                        const backend::Backend *backend)
+{
+  if (!_sampling)
+    return;
+
+  auto timer = backend->config()->timer();
+  if (timer == nullptr)
+    return; // The backend cannot be profiled
+  timer->handleBegin();
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  _timers[op_seq] = std::move(timer);
+}
+
+void OnlineProfileObserver::handleEnd(IExecutor *, const ir::OpSequence *op_seq,
+                                      const backend::Backend *backend)
+{
+  if (!_sampling)
+    return;
+
+  std::unique_ptr<util::ITimer> timer;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto it = _timers.find(op_seq);
+    if (it == _timers.end())
+      return;
+    timer = std::move(it->second);
+    _timers.erase(it);
+  }
+
+  // Asynchronous backends need to finish the job to be measured
+  backend->config()->sync();
+  timer->handleEnd();
+
+  const auto time = timer->getTime();
+  _et->update([&](ExecTime &et) { updateExecTime(et, _graph, op_seq, backend, time); });
+}
+
 ChromeTracingObserver::ChromeTracingObserver(const std::string &filepath, const ir::Graph &graph)
     : _ofs{filepath, std::ofstream::out}, _recorder{}, _collector{&_recorder}, _graph{graph}
 {
@@ -25,6 +25,9 @@
 #include "util/EventCollector.h"
 #include "util/EventRecorder.h"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace onert
 {
 namespace exec
@@ -62,6 +65,35 @@ private:
   const ir::Graph &_graph;
 };
 
+/**
+ * @brief Observer to keep profiling during normal runs with low overhead
+ *
+ * Only one of every @c sampling_period runs is profiled. Unlike @c ProfileObserver, it can be used
+ * with any executor, including @c ParallelExecutor running several op sequences at once.
+ * Measurements go to an @c OnlineExecTime shared by all executors, which writes no file here.
+ */
+class OnlineProfileObserver : public IExecutionObserver
+{
+public:
+  OnlineProfileObserver(std::shared_ptr<OnlineExecTime> et, const ir::Graph &graph,
+                        uint32_t sampling_period)
+      : _et(std::move(et)), _graph(graph), _sampling_period(sampling_period)
+  {
+  }
+  void handleBegin(IExecutor *) override;
+  void handleBegin(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+  void handleEnd(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+
+private:
+  std::shared_ptr<OnlineExecTime> _et; //< Shared by all executors of online profiling
+  const ir::Graph &_graph;
+  const uint32_t _sampling_period;
+  uint32_t _runs = 0;
+  bool _sampling = false; //< Whether the current run is profiled
+  std::mutex _mutex;
+  std::unordered_map<const ir::OpSequence *, std::unique_ptr<util::ITimer>> _timers;
+};
+
 class ChromeTracingObserver : public IExecutionObserver
 {
 public:
@@ -19,13 +19,49 @@
 #include "ir/Operation.h"
 #include "backend/IDynamicTensorManager.h"
 #include "backend/ITensorRegistry.h"
+#include "util/ConfigSource.h"
 #include "util/logging.h"
 
+#include <cstring>
+
 namespace onert
 {
 namespace exec
 {
 
+namespace
+{
+
+// Integer inputs that may decide output shapes, like shape, axis or paddings, are small. An
+// operation having an integer input with more elements than this is not memoized and its shape
+// inference always runs, because comparing the values would cost as much as the kernel.
+constexpr uint64_t kMaxShapeValueElements = 16;
+
+bool isMemoizable(const ir::Operation &op)
+{
+  // Output shapes of control flow operations depend on the values of whole tensors
+  return op.opcode() != ir::OpCode::If && op.opcode() != ir::OpCode::While;
+}
+
+// Returns true if the values of the tensor may decide output shapes of the operation
+bool isShapeValue(const ir::Operation &op, const backend::ITensor &tensor)
+{
+  switch (tensor.data_type())
+  {
+    case ir::DataType::INT32:
+    case ir::DataType::UINT32:
+    case ir::DataType::INT64:
+      return true;
+    case ir::DataType::FLOAT32:
+      // start, limit and delta of Range can be float
+      return op.opcode() == ir::OpCode::Range;
+    default:
+      return false;
+  }
+}
+
+} // namespace
+
 void FunctionSequence::run()
 {
   if (_enable_dynamic_shape_inferer)
@@ -33,12 +69,28 @@ void FunctionSequence::run()
     if (_dynamic_tensor_ctx->op_seq->size() != _functions.size())
       throw std::runtime_error("operation and functions should be mapped one by one");
 
+    if (!_shape_memo_initialized)
+      initShapeMemos();
+
     auto op_seq_iter = _dynamic_tensor_ctx->op_seq->begin();
     for (const auto &function : _functions)
     {
       // set shape of output and allocate memory when needed
+      // It is skipped when shapes and shape-deciding values of inputs are same as the last run
       auto &op = _dynamic_tensor_ctx->operations->at(*op_seq_iter);
-      op.accept(*_dynamic_tensor_ctx->dynamic_shape_inferer);
+      auto &memo = _shape_memos[op_seq_iter - _dynamic_tensor_ctx->op_seq->begin()];
+      if (_enable_shape_memo && hitShapeMemo(op, memo))
+      {
+        allocShapeMemoOutputs(op, memo);
+        _shape_memo_hits++;
+      }
+      else
+      {
+        op.accept(*_dynamic_tensor_ctx->dynamic_shape_inferer);
+        _shape_memo_misses++;
+        if (_enable_shape_memo)
+          recordShapeMemo(op, memo);
+      }
 
       auto *sub_func_seq = dynamic_cast<FunctionSequence *>(function.get());
       if (sub_func_seq != nullptr)
@@ -70,6 +122,105 @@ void FunctionSequence::run()
   }
 }
 
+void FunctionSequence::initShapeMemos()
+{
+  _enable_shape_memo = util::getConfigBool(util::config::DYNAMIC_SHAPE_MEMO);
+  _shape_memos.clear();
+  _shape_memos.resize(_dynamic_tensor_ctx->op_seq->size());
+  _shape_memo_initialized = true;
+}
+
+bool FunctionSequence::hitShapeMemo(const ir::Operation &op, const ShapeMemo &memo) const
+{
+  if (!memo.valid)
+    return false;
+
+  auto &tensor_registry = *_dynamic_tensor_ctx->tensor_registry;
+
+  size_t value_idx = 0;
+  size_t input_idx = 0;
+  for (const auto &ind : op.getInputs() | ir::Remove::UNDEFINED)
+  {
+    auto tensor = tensor_registry.getITensor(ind);
+    if (tensor->getShape() != memo.input_shapes[input_idx++])
+      return false;
+
+    if (isShapeValue(op, *tensor))
+    {
+      const auto &value = memo.input_values[value_idx++];
+      if (tensor->buffer() == nullptr || tensor->total_size() != value.size() ||
+          std::memcmp(tensor->buffer(), value.data(), value.size()) != 0)
+        return false;
+    }
+  }
+
+  // Outputs must still have the memoized shapes. Their memory may have been deallocated after the
+  // last use, which is allocated again by allocShapeMemoOutputs().
+  size_t output_idx = 0;
+  for (const auto &ind : op.getOutputs())
+  {
+    auto tensor = tensor_registry.getITensor(ind);
+    if (tensor->getShape() != memo.output_shapes[output_idx++])
+      return false;
+    if (tensor->buffer() == nullptr && tensor->dynamic_tensor_manager() == nullptr)
+      return false;
+  }
+
+  return true;
+}
+
+void FunctionSequence::allocShapeMemoOutputs(const ir::Operation &op, const ShapeMemo &memo) const
+{
+  auto &tensor_registry = *_dynamic_tensor_ctx->tensor_registry;
+
+  size_t output_idx = 0;
+  for (const auto &ind : op.getOutputs())
+  {
+    auto tensor = tensor_registry.getITensor(ind);
+    const auto &shape = memo.output_shapes[output_idx++];
+    if (tensor->buffer() == nullptr)
+      tensor->dynamic_tensor_manager()->applyShape(ind, shape);
+  }
+}
+
+void FunctionSequence::recordShapeMemo(const ir::Operation &op, ShapeMemo &memo) const
+{
+  auto &tensor_registry = *_dynamic_tensor_ctx->tensor_registry;
+
+  memo.valid = false;
+  memo.input_shapes.clear();
+  memo.input_values.clear();
+  memo.output_shapes.clear();
+  if (!isMemoizable(op))
+    return;
+
+  for (const auto &ind : op.getInputs() | ir::Remove::UNDEFINED)
+  {
+    auto tensor = tensor_registry.getITensor(ind);
+    if (tensor == nullptr)
+      return;
+    memo.input_shapes.emplace_back(tensor->getShape());
+
+    if (isShapeValue(op, *tensor))
+    {
+      if (tensor->buffer() == nullptr ||
+          tensor->getShape().num_elements() > kMaxShapeValueElements)
+        return;
+      memo.input_values.emplace_back(tensor->buffer(), tensor->buffer() + tensor->total_size());
+    }
+  }
+
+  for (const auto &ind : op.getOutputs())
+  {
+    auto tensor = tensor_registry.getITensor(ind);
+    if (tensor == nullptr)
+      return;
+    memo.output_shapes.emplace_back(tensor->getShape());
+  }
+
+  memo.valid = true;
+}
+
 void FunctionSequence::prepare()
 {
   for (const auto &function : _functions)
@@ -24,6 +24,7 @@
 #include "feature/nhwc/View.h"
 
 #include "backend/ITensor.h"
+#include "cker/operation/Transpose.h"
 #include "exec/IFunction.h"
 #include "ir/Index.h"
 #include "ir/Shape.h"
@@ -81,6 +82,7 @@ public:
             permute<uint8_t>(src_tensor, dst_tensor, rank);
             break;
           case ir::DataType::QUANT_INT8_SYMM:
+          case ir::DataType::QUANT_INT8_ASYMM:
             permute<int8_t>(src_tensor, dst_tensor, rank);
             break;
           case ir::DataType::INT64:
@@ -180,6 +182,11 @@ private:
             {
               case PermuteType::NHWC_TO_NCHW:
               {
+                if (!src_tensor.has_padding() && !dst_tensor.has_padding())
+                {
+                  transposeLayout<T>(src_tensor, dst_tensor, {0, 3, 1, 2});
+                  break;
+                }
                 ir::FeatureShape shape;
                 shape.N = dst_tensor.dimension(0);
                 shape.C = dst_tensor.dimension(1);
@@ -196,6 +203,11 @@ private:
               }
               case PermuteType::NCHW_TO_NHWC:
               {
+                if (!src_tensor.has_padding() && !dst_tensor.has_padding())
+                {
+                  transposeLayout<T>(src_tensor, dst_tensor, {0, 2, 3, 1});
+                  break;
+                }
                 ir::FeatureShape shape;
                 shape.N = src_tensor.dimension(0);
                 shape.C = src_tensor.dimension(1);
@@ -248,6 +260,25 @@ private:
     src->access(fn);
   }
 
+  // Transposes a 4D tensor without padding into the other layout by the tiled cker kernel
+  template <class T>
+  void transposeLayout(backend::ITensor &src_tensor, backend::ITensor &dst_tensor,
+                       const std::vector<int32_t> &perm)
+  {
+    nnfw::cker::Shape src_shape(4);
+    nnfw::cker::Shape dst_shape(4);
+    nnfw::cker::TransposeParams params;
+    params.perm_count = 4;
+    for (int i = 0; i < 4; ++i)
+    {
+      src_shape.SetDim(i, static_cast<int32_t>(src_tensor.dimension(i)));
+      dst_shape.SetDim(i, static_cast<int32_t>(dst_tensor.dimension(i)));
+      params.perm[i] = perm[i];
+    }
+    nnfw::cker::Transpose(params, src_shape, reinterpret_cast<const T *>(src_tensor.buffer()),
+                          dst_shape, reinterpret_cast<T *>(dst_tensor.buffer()));
+  }
+
   // NOTE The typeid expression is lvalue expression which refers to an object with static storage
   //      duration, of the polymorphic type const std::type_info or of some type derived from it.
   //      So std::type_info is non-copyable
@@ -268,6 +299,7 @@ private:
       case ir::DataType::UINT8:
         return typeid(uint8_t);
       case ir::DataType::QUANT_INT8_SYMM:
+      case ir::DataType::QUANT_INT8_ASYMM:
         return typeid(int8_t);
       default:
         throw std::runtime_error("IPermuteFunction: Not supported data type");
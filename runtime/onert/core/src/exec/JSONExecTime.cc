@@ -17,11 +17,22 @@
 #include "exec/JSONExecTime.h"
 #include "backend/IConfig.h"
 #include <fstream>
+#include <mutex>
 
 namespace onert
 {
 namespace exec
 {
+
+namespace
+{
+
+// The measurement file can be uploaded and loaded by several executors at once with online
+// profiling
+std::mutex measurement_file_mutex;
+
+} // namespace
+
 /**
  * @brief Helper function for reading string from stream
  *
@@ -137,6 +148,7 @@ void JSON::printOperation(const std::map<uint32_t, int64_t> &operation_info,
 
 void JSON::uploadOperationsExecTime() const
 {
+  std::lock_guard<std::mutex> lock{measurement_file_mutex};
   std::ofstream stream(_measurement_file);
   if (!stream.is_open())
   {
@@ -174,6 +186,7 @@ void JSON::uploadOperationsExecTime() const
 
 void JSON::loadOperationsExecTime()
 {
+  std::lock_guard<std::mutex> lock{measurement_file_mutex};
   std::ifstream stream(_measurement_file);
   if (stream.is_open())
   {
@@ -62,6 +62,8 @@ public:
 public:
   void executeImpl(void) override;
 
+  const std::vector<compiler::CodeAndInfo> &code() const { return _code; }
+
 private:
   std::vector<compiler::CodeAndInfo> _code;
 };
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/OnlineRescheduler.h"
+
+#include "util/logging.h"
+
+namespace onert
+{
+namespace exec
+{
+
+OnlineRescheduler::OnlineRescheduler(const std::shared_ptr<Execution> &execution,
+                                     const CompileFn &compile, uint32_t period)
+    : _execution{execution}, _compile{compile}, _period{period}
+{
+  assert(_execution != nullptr);
+  if (_period == 0)
+    throw std::runtime_error{"OnlineRescheduler: period must be positive"};
+}
+
+OnlineRescheduler::~OnlineRescheduler()
+{
+  if (_candidate.valid())
+    _candidate.wait();
+}
+
+void OnlineRescheduler::execute()
+{
+  const auto begin = std::chrono::steady_clock::now();
+  _execution->execute();
+  _window_time += std::chrono::steady_clock::now() - begin;
+
+  if (++_window_runs == _period)
+    endWindow();
+}
+
+void OnlineRescheduler::endWindow()
+{
+  const auto latency = _window_time / _window_runs;
+  _window_runs = 0;
+  _window_time = std::chrono::steady_clock::duration{0};
+
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+
+  if (_previous)
+  {
+    // The trial is over
+    if (latency < _previous_latency)
+    {
+      VERBOSE(OnlineRescheduler) << "Keep new executors: "
+                                 << duration_cast<microseconds>(latency).count() << "us"
+                                 << std::endl;
+      _replaced_count++;
+    }
+    else
+    {
+      VERBOSE(OnlineRescheduler) << "Restore previous executors: "
+                                 << duration_cast<microseconds>(_previous_latency).count() << "us"
+                                 << std::endl;
+      _execution->replaceExecutors(_previous);
+    }
+    _previous.reset();
+    return;
+  }
+
+  if (!_candidate.valid())
+  {
+    // Start compilation with profiles so far
+    auto compile = _compile;
+    _candidate = std::async(std::launch::async, [compile]() -> std::shared_ptr<ExecutorMap> {
+      try
+      {
+        return compile();
+      }
+      catch (const std::exception &e)
+      {
+        VERBOSE(OnlineRescheduler) << "Failed to reschedule: " << e.what() << std::endl;
+        return nullptr;
+      }
+    });
+    return;
+  }
+
+  if (_candidate.wait_for(std::chrono::seconds{0}) != std::future_status::ready)
+    return; // Still compiling
+
+  auto candidate = _candidate.get();
+  if (!candidate)
+    return;
+
+  VERBOSE(OnlineRescheduler) << "Try new executors after "
+                             << duration_cast<microseconds>(latency).count() << "us" << std::endl;
+  _previous = _execution->replaceExecutors(candidate);
+  _previous_latency = latency;
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/PipelineExecution.h"
+
+#include "util/logging.h"
+
+namespace onert
+{
+namespace exec
+{
+
+namespace
+{
+
+const ir::OperandInfo &inputInfo(const ir::Graph &graph, uint32_t index)
+{
+  return graph.operands().at(graph.getInputs().at(index)).info();
+}
+
+const ir::OperandInfo &outputInfo(const ir::Graph &graph, uint32_t index)
+{
+  return graph.operands().at(graph.getOutputs().at(index)).info();
+}
+
+} // namespace
+
+PipelineExecution::PipelineExecution(const std::vector<std::shared_ptr<ExecutorMap>> &stages,
+                                     const std::vector<std::vector<uint32_t>> &connections)
+{
+  if (stages.empty())
+    throw std::runtime_error{"PipelineExecution: no stage is given"};
+  if (connections.size() + 1 != stages.size())
+    throw std::runtime_error{"PipelineExecution: connections must be given between stages"};
+
+  for (size_t k = 0; k < stages.size(); k++)
+  {
+    auto stage = std::make_unique<Stage>();
+    stage->execution = std::make_unique<Execution>(stages[k]);
+    if (k > 0)
+    {
+      const auto &prev_graph = _stages.back()->execution->primary_subgraph();
+      const auto &graph = stage->execution->primary_subgraph();
+      const auto &connection = connections[k - 1];
+      if (connection.size() != graph.getInputs().size())
+        throw std::runtime_error{"PipelineExecution: stage " + std::to_string(k) +
+                                 " has inputs not connected"};
+      for (uint32_t i = 0; i < connection.size(); i++)
+      {
+        if (connection[i] >= prev_graph.getOutputs().size())
+          throw std::runtime_error{"PipelineExecution: stage " + std::to_string(k - 1) +
+                                   " has no output " + std::to_string(connection[i])};
+        const auto &from = outputInfo(prev_graph, connection[i]);
+        const auto &to = inputInfo(graph, i);
+        if (from.typeInfo() != to.typeInfo() || from.total_size() != to.total_size())
+          throw std::runtime_error{"PipelineExecution: type or size mismatch on input " +
+                                   std::to_string(i) + " of stage " + std::to_string(k)};
+      }
+      stage->connection = connection;
+    }
+    _stages.emplace_back(std::move(stage));
+  }
+
+  for (size_t k = 0; k < _stages.size(); k++)
+    _stages[k]->thread = std::thread{&PipelineExecution::worker, this, k};
+}
+
+PipelineExecution::~PipelineExecution()
+{
+  // Terminate stages in order so that every request reaches the last stage
+  for (auto &stage : _stages)
+  {
+    {
+      std::lock_guard<std::mutex> lock{stage->mutex};
+      stage->terminating = true;
+    }
+    stage->cv.notify_all();
+    stage->thread.join();
+  }
+}
+
+const ir::Graph &PipelineExecution::stageGraph(size_t stage) const
+{
+  return _stages.at(stage)->execution->primary_subgraph();
+}
+
+PipelineExecution::StageStat PipelineExecution::stageStat(size_t stage) const
+{
+  auto &s = *_stages.at(stage);
+  std::lock_guard<std::mutex> lock{s.mutex};
+  return s.stat;
+}
+
+size_t PipelineExecution::inputSize(const ir::IOIndex &index) const
+{
+  return inputInfo(stageGraph(0), index.value()).total_size();
+}
+
+size_t PipelineExecution::outputSize(const ir::IOIndex &index) const
+{
+  return outputInfo(stageGraph(_stages.size() - 1), index.value()).total_size();
+}
+
+std::future<void> PipelineExecution::submit(const std::vector<const void *> &inputs,
+                                            const std::vector<void *> &outputs)
+{
+  if (inputs.size() != stageGraph(0).getInputs().size() ||
+      outputs.size() != stageGraph(_stages.size() - 1).getOutputs().size())
+    throw std::runtime_error{"PipelineExecution: wrong number of inputs or outputs"};
+
+  auto request = std::make_unique<Request>();
+  request->inputs = inputs;
+  request->outputs = outputs;
+  request->stage_outputs.resize(_stages.size() - 1);
+  auto done = request->done.get_future();
+
+  enqueue(0, std::move(request));
+  return done;
+}
+
+void PipelineExecution::enqueue(size_t stage, std::unique_ptr<Request> request)
+{
+  auto &s = *_stages.at(stage);
+  {
+    std::lock_guard<std::mutex> lock{s.mutex};
+    if (s.terminating && stage == 0)
+      throw std::runtime_error{"PipelineExecution: already terminated"};
+    request->enqueued = std::chrono::steady_clock::now();
+    s.queue.emplace_back(std::move(request));
+  }
+  s.cv.notify_all();
+}
+
+void PipelineExecution::worker(size_t stage)
+{
+  auto &s = *_stages[stage];
+  while (true)
+  {
+    std::unique_ptr<Request> request;
+    {
+      std::unique_lock<std::mutex> lock{s.mutex};
+      s.cv.wait(lock, [&] { return s.terminating || !s.queue.empty(); });
+      if (s.queue.empty())
+        return; // Terminating with no pending request
+      request = std::move(s.queue.front());
+      s.queue.pop_front();
+    }
+
+    try
+    {
+      runStage(stage, *request);
+    }
+    catch (...)
+    {
+      request->done.set_exception(std::current_exception());
+      continue;
+    }
+
+    if (stage + 1 < _stages.size())
+      enqueue(stage + 1, std::move(request));
+    else
+      request->done.set_value();
+  }
+}
+
+void PipelineExecution::runStage(size_t stage, Request &request)
+{
+  auto &s = *_stages[stage];
+  auto &execution = *s.execution;
+  const auto &graph = execution.primary_subgraph();
+
+  const auto begin = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < graph.getInputs().size(); i++)
+  {
+    const ir::IOIndex index{i};
+    if (stage == 0)
+    {
+      execution.setInput(index, request.inputs[i], inputInfo(graph, i).total_size());
+    }
+    else
+    {
+      const auto &buffer = request.stage_outputs[stage - 1][s.connection[i]];
+      execution.setInput(index, buffer.data(), buffer.size());
+    }
+  }
+
+  const bool last = (stage + 1 == _stages.size());
+  if (!last)
+    request.stage_outputs[stage].resize(graph.getOutputs().size());
+  for (uint32_t i = 0; i < graph.getOutputs().size(); i++)
+  {
+    const ir::IOIndex index{i};
+    const auto size = outputInfo(graph, i).total_size();
+    if (last)
+    {
+      execution.setOutput(index, request.outputs[i], size);
+    }
+    else
+    {
+      auto &buffer = request.stage_outputs[stage][i];
+      buffer.resize(size);
+      execution.setOutput(index, buffer.data(), buffer.size());
+    }
+  }
+
+  execution.execute();
+
+  // Inputs from the previous stage are not used anymore
+  if (stage > 0)
+    request.stage_outputs[stage - 1].clear();
+
+  const auto end = std::chrono::steady_clock::now();
+  const auto run = std::chrono::duration_cast<std::chrono::microseconds>(end - begin);
+  const auto wait = std::chrono::duration_cast<std::chrono::microseconds>(begin - request.enqueued);
+  {
+    std::lock_guard<std::mutex> lock{s.mutex};
+    s.stat.runs++;
+    s.stat.total_run += run;
+    s.stat.max_run = std::max(s.stat.max_run, run);
+    s.stat.total_wait += wait;
+  }
+
+  VERBOSE(PipelineExecution) << "Stage " << stage << " ran for " << run.count() << "us after "
+                             << wait.count() << "us waiting" << std::endl;
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/RequestBatcher.h"
+
+#include "util/logging.h"
+
+#include <cstring>
+
+namespace onert
+{
+namespace exec
+{
+
+RequestBatcher::RequestBatcher(const std::shared_ptr<BatchBucketExecution> &execution,
+                               uint32_t max_batch, std::chrono::microseconds latency_budget)
+    : _execution{execution}, _max_batch{max_batch}, _latency_budget{latency_budget}
+{
+  assert(_execution != nullptr);
+  if (_max_batch == 0)
+    throw std::runtime_error{"RequestBatcher: max batch must be positive"};
+
+  // Check the largest batch can run before accepting any request
+  _execution->setBatchSize(_max_batch);
+
+  const auto &graph = _execution->execution()->primary_subgraph();
+  for (uint32_t i = 0; i < graph.getInputs().size(); i++)
+  {
+    _input_sample_sizes.emplace_back(_execution->inputSampleSize(ir::IOIndex{i}));
+    _input_buffers.emplace_back(_input_sample_sizes.back() * _max_batch);
+  }
+  for (uint32_t i = 0; i < graph.getOutputs().size(); i++)
+  {
+    _output_sample_sizes.emplace_back(_execution->outputSampleSize(ir::IOIndex{i}));
+    _output_buffers.emplace_back(_output_sample_sizes.back() * _max_batch);
+  }
+
+  _worker = std::thread{&RequestBatcher::worker, this};
+}
+
+RequestBatcher::~RequestBatcher()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _terminating = true;
+  }
+  _cv.notify_all();
+  _worker.join();
+}
+
+void RequestBatcher::run(const std::vector<const void *> &inputs,
+                         const std::vector<void *> &outputs)
+{
+  if (inputs.size() != _input_sample_sizes.size() || outputs.size() != _output_sample_sizes.size())
+    throw std::runtime_error{"RequestBatcher: wrong number of inputs or outputs"};
+
+  auto request = std::make_unique<Request>();
+  request->inputs = inputs;
+  request->outputs = outputs;
+  auto done = request->done.get_future();
+
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_terminating)
+      throw std::runtime_error{"RequestBatcher: already terminated"};
+    request->enqueued = std::chrono::steady_clock::now();
+    _pending.emplace_back(std::move(request));
+  }
+  _cv.notify_all();
+
+  // Rethrows the exception of the batch run if any
+  done.get();
+}
+
+void RequestBatcher::worker()
+{
+  std::vector<std::unique_ptr<Request>> batch;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _cv.wait(lock, [&] { return _terminating || !_pending.empty(); });
+      if (_pending.empty())
+        return; // Terminating with no pending request
+
+      // Wait for more requests until the oldest one runs out of its latency budget
+      const auto deadline = _pending.front()->enqueued + _latency_budget;
+      _cv.wait_until(lock, deadline,
+                     [&] { return _terminating || _pending.size() >= _max_batch; });
+
+      while (!_pending.empty() && batch.size() < _max_batch)
+      {
+        batch.emplace_back(std::move(_pending.front()));
+        _pending.pop_front();
+      }
+    }
+
+    runBatch(batch);
+    batch.clear();
+  }
+}
+
+void RequestBatcher::runBatch(std::vector<std::unique_ptr<Request>> &batch)
+{
+  const auto batch_size = static_cast<uint32_t>(batch.size());
+  VERBOSE(RequestBatcher) << "Run " << batch_size << " request(s) at once" << std::endl;
+
+  try
+  {
+    // Gather inputs along the batch axis
+    for (uint32_t i = 0; i < _input_sample_sizes.size(); i++)
+    {
+      const auto sample_size = _input_sample_sizes[i];
+      for (uint32_t n = 0; n < batch_size; n++)
+        std::memcpy(_input_buffers[i].data() + n * sample_size, batch[n]->inputs[i], sample_size);
+    }
+
+    _execution->setBatchSize(batch_size);
+    for (uint32_t i = 0; i < _input_sample_sizes.size(); i++)
+      _execution->setInput(ir::IOIndex{i}, _input_buffers[i].data(),
+                           _input_sample_sizes[i] * batch_size);
+    for (uint32_t i = 0; i < _output_sample_sizes.size(); i++)
+      _execution->setOutput(ir::IOIndex{i}, _output_buffers[i].data(),
+                            _output_sample_sizes[i] * batch_size);
+    _execution->execute();
+
+    // Scatter outputs to each request
+    for (uint32_t i = 0; i < _output_sample_sizes.size(); i++)
+    {
+      const auto sample_size = _output_sample_sizes[i];
+      for (uint32_t n = 0; n < batch_size; n++)
+        std::memcpy(batch[n]->outputs[i], _output_buffers[i].data() + n * sample_size,
+                    sample_size);
+    }
+  }
+  catch (...)
+  {
+    for (auto &request : batch)
+      request->done.set_exception(std::current_exception());
+    return;
+  }
+
+  for (auto &request : batch)
+    request->done.set_value();
+}
+
+} // namespace exec
+} // namespace onert
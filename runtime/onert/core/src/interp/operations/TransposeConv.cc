@@ -14,7 +14,7 @@
  * limitations under the License.
  */
 
-#include <cker/operation/TransposeConv.h>
+#include <cker/operation/reference/TransposeConv.h>
 #include <misc/polymorphic_downcast.h>
 
 #include "OperationUtil.h"
@@ -101,8 +101,8 @@ void invoke(const ITensor *ifm_tensor, const ITensor *ker_tensor, const ITensor
   const float *ker_ptr = reinterpret_cast<const float *>(ker_tensor->bufferRO());
   float *ofm_ptr = reinterpret_cast<float *>(ofm_tensor->buffer());
 
-  nnfw::cker::TransposeConv(cker_param, cker_ifm_shape, ifm_ptr, cker_ker_shape, ker_ptr,
-                            cker_ofm_shape, ofm_ptr);
+  nnfw::cker::reference::TransposeConv(cker_param, cker_ifm_shape, ifm_ptr, cker_ker_shape,
+                                       ker_ptr, cker_ofm_shape, ofm_ptr);
 }
 
 void invokeTransposeConv(const ExecEnv *env, const ir::Operation &node)
@@ -41,6 +41,7 @@ size_t sizeOfDataType(DataType data_type)
     case DataType::UINT8:
       return sizeof(uint8_t);
     case DataType::QUANT_INT8_SYMM:
+    case DataType::QUANT_INT8_ASYMM:
       return sizeof(int8_t);
     case DataType::FLOAT16:
       return sizeof(float16);
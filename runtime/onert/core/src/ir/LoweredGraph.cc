@@ -248,7 +248,9 @@ void LoweredGraph::makeOpSequences(
   const int op_seq_max_node = options.op_seq_max_node;
   assert(op_seq_max_node >= 0);
 
-  bool is_profiling = options.he_profiling_mode;
+  // NOTE Observers measure a whole OpSequence as the time of its first operation, so each
+  //      operation must have its own OpSequence while profiling
+  bool is_profiling = options.he_profiling_mode || options.he_online_profiling;
   OpSequence *op_seq = nullptr;
   OpSequenceIndex op_seq_index;
 
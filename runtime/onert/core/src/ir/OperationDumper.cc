@@ -491,6 +491,14 @@ void OperationDumper::visit(const ResizeBilinear &node)
   VERBOSE(LIR) << "  - Output : Output(" << node.getOutputs().at(0) << ")" << std::endl;
 }
 
+void OperationDumper::visit(const ResizeNearestNeighbor &node)
+{
+  VERBOSE(LIR) << "* ResizeNearestNeighbor" << std::endl;
+  VERBOSE(LIR) << "  - Inputs : Input("
+               << node.getInputs().at(ResizeNearestNeighbor::Input::INPUT) << ")" << std::endl;
+  VERBOSE(LIR) << "  - Output : Output(" << node.getOutputs().at(0) << ")" << std::endl;
+}
+
 void OperationDumper::visit(const Reverse &node)
 {
   VERBOSE(LIR) << "* Reverse" << std::endl;
@@ -92,6 +92,8 @@ protected:
                        ir::OperandIndexSequence &outputs);
   // Create operations from Operator
   void loadOperation(const Operator *op, ir::Graph &subg);
+  // Set int8 weights of an operation to symmetric type
+  void loadSymmetricWeights(ir::Graph &subg, const ir::OperandIndex &index);
   // Load Strides and Paddings from options to param
   template <typename Param, typename OptionsType>
   void loadStridesAndPaddings(Param &param, const OptionsType *options);
@@ -118,6 +120,7 @@ protected:
   void loadRelu(const Operator *op, ir::Graph &subg);
   void loadRelu6(const Operator *op, ir::Graph &subg);
   void loadResizeBilinear(const Operator *op, ir::Graph &subg);
+  void loadResizeNearestNeighbor(const Operator *op, ir::Graph &subg);
   void loadRsqrt(const Operator *op, ir::Graph &subg);
   void loadSelect(const Operator *op, ir::Graph &subg);
   void loadSqrt(const Operator *op, ir::Graph &subg);
@@ -139,6 +142,7 @@ protected:
   void loadBatchToSpaceND(const Operator *op, ir::Graph &subg);
   void loadSqueeze(const Operator *op, ir::Graph &subg);
   void loadPrelu(const Operator *op, ir::Graph &subg);
+  void loadLocalResponseNormalization(const Operator *op, ir::Graph &subg);
   void loadSplit(const Operator *op, ir::Graph &subg);
   void loadSplitV(const Operator *op, ir::Graph &subg);
   void loadSlice(const Operator *op, ir::Graph &subg);
@@ -331,24 +335,40 @@ ir::OperandIndex BaseLoader<LoaderDomain, SpecificLoader>::loadOperand(const Ten
   auto q_params = tensor->quantization();
   float scale = 0.0;
   long zero_point = 0;
+  std::vector<float> scales;
   if (q_params != nullptr)
   {
     if (q_params->scale())
     {
-      if (q_params->scale()->size() != 1)
+      if (q_params->scale()->size() > 1)
       {
-        throw std::runtime_error("Only 1 scale for a tensor is supported.");
+        // Per-channel quantization is supported only for symmetric weights
+        scales.assign(q_params->scale()->begin(), q_params->scale()->end());
+      }
+      else if (q_params->scale()->size() == 1)
+      {
+        scale = q_params->scale()->Get(0);
       }
-      scale = q_params->scale()->Get(0);
     }
 
     if (q_params->zero_point())
     {
-      if (q_params->zero_point()->size() != 1)
+      if (!scales.empty())
+      {
+        for (const auto zp : *q_params->zero_point())
+        {
+          if (zp != 0)
+            throw std::runtime_error("Per-channel quantization must be symmetric.");
+        }
+      }
+      else if (q_params->zero_point()->size() > 1)
       {
         throw std::runtime_error("Only 1 zero_point value for a tensor is supported.");
       }
-      zero_point = q_params->zero_point()->Get(0);
+      else if (q_params->zero_point()->size() == 1)
+      {
+        zero_point = q_params->zero_point()->Get(0);
+      }
       // zero_point is long while TypeInfo.zero_point is defined as int32_t.
       assert(zero_point >= std::numeric_limits<int32_t>::min());
       assert(zero_point <= std::numeric_limits<int32_t>::max());
@@ -357,13 +377,28 @@ ir::OperandIndex BaseLoader<LoaderDomain, SpecificLoader>::loadOperand(const Ten
     if (details != nullptr)
       throw std::runtime_error("Custom Quantization is not supported");
   }
+
+  // int8 tensors are asymmetric. Ones used as weights are set to symmetric by the operations
+  // consuming them, see loadSymmetricWeights().
+  const auto *data = _model->buffers()->Get(tensor->buffer())->data();
+  if (data_type == ir::DataType::QUANT_INT8_SYMM)
+  {
+    if (!scales.empty() && data == nullptr)
+      throw std::runtime_error("Per-channel quantization is supported only for weights.");
+    data_type = ir::DataType::QUANT_INT8_ASYMM;
+  }
+  else if (!scales.empty())
+  {
+    throw std::runtime_error("Only 1 scale for a tensor is supported.");
+  }
+
   // Create TypeInfo
-  ir::TypeInfo type_info(data_type, scale, zero_point);
+  ir::TypeInfo type_info(data_type, scales.empty() ? scale : scales[0], zero_point);
+  type_info.scales(scales);
   // Create operand
   const auto operand_index = subg.addOperand(shape, type_info);
 
   // Constant tensors are indicated by non-empty data.
-  const auto *data = _model->buffers()->Get(tensor->buffer())->data();
   if (data != nullptr)
   {
     using std::ptrdiff_t;
@@ -415,6 +450,19 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadOperationIO(const Operator *o
   }
 }
 
+template <typename LoaderDomain, typename SpecificLoader>
+void BaseLoader<LoaderDomain, SpecificLoader>::loadSymmetricWeights(ir::Graph &subg,
+                                                                    const ir::OperandIndex &index)
+{
+  auto &operand = subg.operands().at(index);
+  const auto &type_info = operand.typeInfo();
+  if (type_info.type() == ir::DataType::QUANT_INT8_ASYMM && operand.isConstant() &&
+      type_info.offset() == 0)
+  {
+    operand.type(ir::DataType::QUANT_INT8_SYMM);
+  }
+}
+
 template <typename LoaderDomain, typename SpecificLoader>
 template <typename Param, typename OptionsType>
 void BaseLoader<LoaderDomain, SpecificLoader>::loadStridesAndPaddings(Param &param,
@@ -453,6 +501,7 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadConv2D(const Operator *op, ir
   ir::OperandIndexSequence outputs;
 
   loadOperationIO(op, inputs, outputs);
+  loadSymmetricWeights(subg, inputs.at(ir::operation::Conv2D::KERNEL));
 
   ir::operation::Conv2D::Param param;
   const auto *options = op->builtin_options_as_Conv2DOptions();
@@ -471,6 +520,7 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadDepthwiseConv2D(const Operato
   ir::OperandIndexSequence outputs;
 
   loadOperationIO(op, inputs, outputs);
+  loadSymmetricWeights(subg, inputs.at(ir::operation::DepthwiseConv2D::KERNEL));
 
   ir::operation::DepthwiseConv2D::Param param;
   const auto *options = op->builtin_options_as_DepthwiseConv2DOptions();
@@ -633,6 +683,7 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadFC(const Operator *op, ir::Gr
   ir::OperandIndexSequence outputs;
 
   loadOperationIO(op, inputs, outputs);
+  loadSymmetricWeights(subg, inputs.at(ir::operation::FullyConnected::WEIGHT));
 
   const auto &input_operand = subg.operands().at(inputs.at(ir::operation::FullyConnected::INPUT));
   auto &weights_operand = subg.operands().at(inputs.at(ir::operation::FullyConnected::WEIGHT));
@@ -789,6 +840,34 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadResizeBilinear(const Operator
   subg.addOperation(std::move(new_op));
 }
 
+template <typename LoaderDomain, typename SpecificLoader>
+void BaseLoader<LoaderDomain, SpecificLoader>::loadResizeNearestNeighbor(const Operator *op,
+                                                                         ir::Graph &subg)
+{
+  ir::OperandIndexSequence inputs;
+  ir::OperandIndexSequence outputs;
+
+  loadOperationIO(op, inputs, outputs);
+  auto input = inputs.at(0);
+  auto size = inputs.at(1);
+
+  if (!subg.operands().at(size).isConstant())
+    throw std::runtime_error("ResizeNearestNeighbor: non-constant 'size' is not supported.");
+
+  std::vector<std::int32_t> size_v = subg.operands().at(size).template asVector<std::int32_t>();
+
+  ir::operation::ResizeNearestNeighbor::Param param;
+  param.height_out = size_v[0];
+  param.width_out = size_v[1];
+  param.align_corners = op->builtin_options_as_ResizeNearestNeighborOptions()->align_corners();
+  // ResizeNearestNeighborOptions of the schema has no half_pixel_centers
+  param.half_pixel_centers = false;
+
+  std::unique_ptr<ir::Operation> new_op(
+      new ir::operation::ResizeNearestNeighbor({input}, outputs, param));
+  subg.addOperation(std::move(new_op));
+}
+
 template <typename LoaderDomain, typename SpecificLoader>
 void BaseLoader<LoaderDomain, SpecificLoader>::loadRsqrt(const Operator *op, ir::Graph &subg)
 {
@@ -1288,6 +1367,27 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadPrelu(const Operator *op, ir:
   subg.addOperation(std::move(new_op));
 }
 
+template <typename LoaderDomain, typename SpecificLoader>
+void BaseLoader<LoaderDomain, SpecificLoader>::loadLocalResponseNormalization(const Operator *op,
+                                                                              ir::Graph &subg)
+{
+  ir::OperandIndexSequence inputs;
+  ir::OperandIndexSequence outputs;
+
+  loadOperationIO(op, inputs, outputs);
+
+  ir::operation::LocalResponseNormalization::Param param;
+  const auto *options = op->builtin_options_as_LocalResponseNormalizationOptions();
+  param.radius = options->radius();
+  param.bias = options->bias();
+  param.alpha = options->alpha();
+  param.beta = options->beta();
+
+  std::unique_ptr<ir::Operation> new_op(
+      new ir::operation::LocalResponseNormalization(inputs, outputs, param));
+  subg.addOperation(std::move(new_op));
+}
+
 template <typename LoaderDomain, typename SpecificLoader>
 void BaseLoader<LoaderDomain, SpecificLoader>::loadSplit(const Operator *op, ir::Graph &subg)
 {
@@ -1868,6 +1968,9 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadOperation(const Operator *op,
     case BuiltinOperator::BuiltinOperator_RESIZE_BILINEAR:
       loadResizeBilinear(op, subg);
       return;
+    case BuiltinOperator::BuiltinOperator_RESIZE_NEAREST_NEIGHBOR:
+      loadResizeNearestNeighbor(op, subg);
+      return;
     case BuiltinOperator::BuiltinOperator_RSQRT:
       loadRsqrt(op, subg);
       return;
@@ -1935,6 +2038,9 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadOperation(const Operator *op,
     case BuiltinOperator::BuiltinOperator_PRELU:
       loadPrelu(op, subg);
       return;
+    case BuiltinOperator::BuiltinOperator_LOCAL_RESPONSE_NORMALIZATION:
+      loadLocalResponseNormalization(op, subg);
+      return;
     case BuiltinOperator::BuiltinOperator_SPLIT:
       loadSplit(op, subg);
       return;
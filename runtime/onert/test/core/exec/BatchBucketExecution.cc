@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "exec/BatchBucketExecution.h"
+#include "TestUtils.h"
+
+namespace
+{
+
+using namespace onert::ir;
+using onert_test::exec::compileAddBias;
+
+std::map<uint32_t, std::shared_ptr<onert::exec::ExecutorMap>> compileBuckets()
+{
+  std::map<uint32_t, std::shared_ptr<onert::exec::ExecutorMap>> buckets;
+  for (uint32_t batch : {1, 2, 4})
+    buckets.emplace(batch, compileAddBias(batch));
+  return buckets;
+}
+
+TEST(BatchBucketExecution, exact_bucket)
+{
+  onert::exec::BatchBucketExecution execution{compileBuckets()};
+
+  const float input[4] = {1, 2, 3, 4};
+  float output[4] = {};
+  const float expected[4] = {11, 22, 13, 24};
+
+  execution.setBatchSize(2);
+  EXPECT_EQ(execution.bucketSize(), 2);
+  execution.setInput(IOIndex{0}, input, sizeof(input));
+  execution.setOutput(IOIndex{0}, output, sizeof(output));
+  execution.execute();
+
+  for (auto i = 0; i < 4; i++)
+    EXPECT_EQ(output[i], expected[i]);
+}
+
+TEST(BatchBucketExecution, padded_bucket)
+{
+  onert::exec::BatchBucketExecution execution{compileBuckets()};
+
+  float input[6] = {1, 2, 3, 4, 5, 6};
+  float output[6] = {};
+
+  execution.setBatchSize(3);
+  EXPECT_EQ(execution.batchSize(), 3);
+  EXPECT_EQ(execution.bucketSize(), 4);
+  EXPECT_EQ(execution.getInputShape(IOIndex{0}), (Shape{3, 2}));
+  EXPECT_EQ(execution.getOutputShape(IOIndex{0}), (Shape{3, 2}));
+
+  // Buffers hold only 3 samples
+  execution.setInput(IOIndex{0}, input, sizeof(input));
+  execution.setOutput(IOIndex{0}, output, sizeof(output));
+  execution.execute();
+
+  const float expected1[6] = {11, 22, 13, 24, 15, 26};
+  for (auto i = 0; i < 6; i++)
+    EXPECT_EQ(output[i], expected1[i]);
+
+  // Input buffer updated after setInput is used on the next execution
+  input[0] = -10;
+  execution.execute();
+  EXPECT_EQ(output[0], 0);
+}
+
+TEST(BatchBucketExecution, neg_too_large_batch)
+{
+  onert::exec::BatchBucketExecution execution{compileBuckets()};
+
+  EXPECT_ANY_THROW(execution.setBatchSize(5));
+  EXPECT_ANY_THROW(execution.setBatchSize(0));
+}
+
+TEST(BatchBucketExecution, neg_too_small_buffer)
+{
+  onert::exec::BatchBucketExecution execution{compileBuckets()};
+
+  float input[4] = {};
+  execution.setBatchSize(3);
+  EXPECT_ANY_THROW(execution.setInput(IOIndex{0}, input, sizeof(input)));
+}
+
+} // namespace
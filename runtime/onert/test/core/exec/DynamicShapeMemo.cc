@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ir/Graph.h"
+#include "exec/Execution.h"
+#include "exec/LinearExecutor.h"
+#include "ir/operation/Add.h"
+#include "ir/operation/Reshape.h"
+#include "TestUtils.h"
+
+namespace
+{
+
+using namespace onert::ir;
+using onert_test::exec::compile;
+
+// Model: reshaped <= reshape(input + input, shape)
+//        output   <= reshaped + reshaped
+// input shape: {1, 6} at compile time, changed at execution time
+// shape(int32 input) shape: {2}
+std::shared_ptr<onert::exec::ExecutorMap> compileAddReshapeAdd()
+{
+  auto graph = std::make_shared<Graph>();
+  TypeInfo float_type{DataType::FLOAT32};
+  auto operand_input = graph->addOperand(Shape{1, 6}, float_type);
+  auto operand_shape = graph->addOperand(Shape{2}, TypeInfo{DataType::INT32});
+  auto operand_sum = graph->addOperand(Shape{1, 6}, float_type);
+  auto operand_reshaped = graph->addOperand(Shape{2, 3}, float_type);
+  auto operand_output = graph->addOperand(Shape{2, 3}, float_type);
+
+  operation::Add::Param add_param;
+  add_param.activation = Activation::NONE;
+  graph->addOperation(std::make_unique<operation::Add>(
+      OperandIndexSequence{operand_input, operand_input}, OperandIndexSequence{operand_sum},
+      add_param));
+  graph->addOperation(std::make_unique<operation::Reshape>(
+      OperandIndexSequence{operand_sum, operand_shape}, OperandIndexSequence{operand_reshaped},
+      operation::Reshape::Param{}));
+  graph->addOperation(std::make_unique<operation::Add>(
+      OperandIndexSequence{operand_reshaped, operand_reshaped},
+      OperandIndexSequence{operand_output}, add_param));
+  graph->addInput(operand_input);
+  graph->addInput(operand_shape);
+  graph->addOutput(operand_output);
+  graph->finishBuilding();
+
+  return compile(graph);
+}
+
+struct MemoCount
+{
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+};
+
+// Sum of shape memo counts of all function sequences of the primary executor
+MemoCount countMemo(const std::shared_ptr<onert::exec::ExecutorMap> &executors)
+{
+  const auto &executor =
+      dynamic_cast<const onert::exec::LinearExecutor &>(*executors->at(SubgraphIndex{0}));
+
+  MemoCount count;
+  for (const auto &code : executor.code())
+  {
+    count.hits += code.fn_seq->shapeMemoHits();
+    count.misses += code.fn_seq->shapeMemoMisses();
+  }
+  return count;
+}
+
+// Executors keep memoized shapes between executions
+void run(const std::shared_ptr<onert::exec::ExecutorMap> &executors, const Shape &input_shape,
+         const std::vector<int32_t> &new_shape)
+{
+  onert::exec::Execution execution{executors};
+
+  std::vector<float> input(input_shape.num_elements());
+  for (size_t i = 0; i < input.size(); i++)
+    input[i] = i;
+  std::vector<float> output(input.size());
+
+  execution.changeInputShape(IOIndex{0}, input_shape);
+  execution.setInput(IOIndex{0}, input.data(), input.size() * sizeof(float));
+  execution.setInput(IOIndex{1}, new_shape.data(), new_shape.size() * sizeof(int32_t));
+  execution.setOutput(IOIndex{0}, output.data(), output.size() * sizeof(float));
+  execution.execute();
+
+  auto output_shape = execution.getOutputShape(IOIndex{0});
+  ASSERT_EQ(output_shape.rank(), 2);
+  EXPECT_EQ(output_shape.dim(0), new_shape[0]);
+  EXPECT_EQ(output_shape.dim(1), new_shape[1]);
+  for (size_t i = 0; i < output.size(); i++)
+    EXPECT_EQ(output[i], 4 * i);
+}
+
+// Each run of the model does shape inference of 3 operations, or skips it with the memo
+TEST(DynamicShapeMemo, same_shapes)
+{
+  auto executors = compileAddReshapeAdd();
+
+  run(executors, Shape{2, 6}, {3, 4});
+  auto count = countMemo(executors);
+  EXPECT_EQ(count.hits, 0);
+  EXPECT_EQ(count.misses, 3);
+
+  run(executors, Shape{2, 6}, {3, 4});
+  run(executors, Shape{2, 6}, {3, 4});
+  count = countMemo(executors);
+  EXPECT_EQ(count.hits, 6);
+  EXPECT_EQ(count.misses, 3);
+}
+
+TEST(DynamicShapeMemo, changed_shapes)
+{
+  auto executors = compileAddReshapeAdd();
+
+  run(executors, Shape{2, 6}, {3, 4});
+  run(executors, Shape{3, 6}, {3, 6});
+  auto count = countMemo(executors);
+  EXPECT_EQ(count.hits, 0);
+  EXPECT_EQ(count.misses, 6);
+
+  run(executors, Shape{3, 6}, {3, 6});
+  count = countMemo(executors);
+  EXPECT_EQ(count.hits, 3);
+  EXPECT_EQ(count.misses, 6);
+
+  run(executors, Shape{1, 6}, {2, 3});
+  count = countMemo(executors);
+  EXPECT_EQ(count.hits, 3);
+  EXPECT_EQ(count.misses, 9);
+}
+
+TEST(DynamicShapeMemo, changed_shape_value)
+{
+  auto executors = compileAddReshapeAdd();
+
+  // Input shape is not changed, but the output shape is decided by the value of shape input
+  run(executors, Shape{2, 6}, {3, 4});
+  run(executors, Shape{2, 6}, {4, 3});
+  auto count = countMemo(executors);
+  EXPECT_EQ(count.hits, 1); // Only the first Add, whose inputs are not changed
+  EXPECT_EQ(count.misses, 5);
+
+  run(executors, Shape{2, 6}, {4, 3});
+  count = countMemo(executors);
+  EXPECT_EQ(count.hits, 4);
+  EXPECT_EQ(count.misses, 5);
+
+  run(executors, Shape{2, 6}, {2, 6});
+  count = countMemo(executors);
+  EXPECT_EQ(count.hits, 5);
+  EXPECT_EQ(count.misses, 7);
+}
+
+} // namespace
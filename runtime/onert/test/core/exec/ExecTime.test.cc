@@ -102,4 +102,33 @@ TEST(ExecTime, structure)
   // clean up
   EXPECT_EQ(remove("exec_time.json"), 0);
 }
+
+TEST(ExecTime, online_shared)
+{
+  const auto *b = new MockBackend();
+  std::vector<const Backend *> bs = {b};
+  {
+    // Two owners like executors of two subgraphs, one of which is gone before the flush
+    auto shared = std::make_shared<OnlineExecTime>(bs);
+    auto other = shared;
+    shared->update([&](ExecTime &et) { et.updateOperationExecTime(b, "op1", false, 100, 100); });
+    other->update([&](ExecTime &et) { et.updateOperationExecTime(b, "op2", false, 100, 300); });
+    other.reset();
+    shared->flush();
+
+    ExecTime et(bs);
+    ASSERT_EQ(et.getOperationExecTime(b, "op1", false, 100), 100);
+    ASSERT_EQ(et.getOperationExecTime(b, "op2", false, 100), 300);
+
+    // Written again when the last owner is destroyed
+    shared->update([&](ExecTime &et) { et.updateOperationExecTime(b, "op3", false, 100, 500); });
+  }
+  {
+    ExecTime et(bs);
+    ASSERT_EQ(et.getOperationExecTime(b, "op1", false, 100), 100);
+    ASSERT_EQ(et.getOperationExecTime(b, "op3", false, 100), 500);
+  }
+  // clean up
+  EXPECT_EQ(remove("exec_time.json"), 0);
+}
 } // unnamed namespace
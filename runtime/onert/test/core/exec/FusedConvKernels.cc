@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+
+#include "ir/Graph.h"
+#include "exec/Execution.h"
+#include "ir/operation/Add.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/Mul.h"
+#include "TestUtils.h"
+
+namespace
+{
+
+using namespace onert::ir;
+using onert_test::exec::makeData;
+using onert_test::exec::compile;
+
+OperandIndex addConstant(Graph &graph, const Shape &shape, const std::vector<float> &data)
+{
+  const auto index = graph.addOperand(shape, TypeInfo{DataType::FLOAT32});
+  graph.operands().at(index).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(data.data()), data.size() * sizeof(float)));
+  return index;
+}
+
+float activate(float value, Activation activation)
+{
+  switch (activation)
+  {
+    case Activation::RELU:
+      return std::max(value, 0.f);
+    case Activation::RELU6:
+      return std::min(std::max(value, 0.f), 6.f);
+    default:
+      return value;
+  }
+}
+
+enum class Epilogue
+{
+  kResidualAdd,
+  kChannelMul,
+  kChannelAdd,
+};
+
+struct FusedConvCase
+{
+  int height, width, input_depth, kernel_size, stride, output_depth;
+  PaddingType padding;
+  Epilogue epilogue;
+};
+
+// Runs Conv followed by an elementwise operation, which the cpu backend fuses into the Conv, and
+// checks the result against a naive Conv and the operation. With computed_kernel, the kernel is
+// computed by a Mul from a model input and the result goes through another Mul to the model
+// output, so that the memory planner can place the result on the kernel.
+void verifyFusedConv(const FusedConvCase &c, bool computed_kernel = false)
+{
+  const int output_height = c.padding == PaddingType::SAME
+                                ? (c.height + c.stride - 1) / c.stride
+                                : (c.height - c.kernel_size) / c.stride + 1;
+  const int output_width = c.padding == PaddingType::SAME
+                               ? (c.width + c.stride - 1) / c.stride
+                               : (c.width - c.kernel_size) / c.stride + 1;
+  const int pad_top = std::max((output_height - 1) * c.stride + c.kernel_size - c.height, 0) / 2;
+  const int pad_left = std::max((output_width - 1) * c.stride + c.kernel_size - c.width, 0) / 2;
+  const int output_size = output_height * output_width * c.output_depth;
+
+  const auto input = makeData(c.height * c.width * c.input_depth, 1);
+  const auto kernel =
+      makeData(c.output_depth * c.kernel_size * c.kernel_size * c.input_depth, 2);
+  const auto bias = makeData(c.output_depth, 3);
+  const bool per_channel = c.epilogue != Epilogue::kResidualAdd;
+  const auto operand = makeData(per_channel ? c.output_depth : output_size, 4);
+
+  auto graph = std::make_shared<Graph>();
+  const TypeInfo float_type{DataType::FLOAT32};
+  const Shape output_shape{1, output_height, output_width, c.output_depth};
+  const auto input_index =
+      graph->addOperand(Shape{1, c.height, c.width, c.input_depth}, float_type);
+  const Shape kernel_shape{c.output_depth, c.kernel_size, c.kernel_size, c.input_depth};
+  OperandIndex kernel_input_index;
+  OperandIndex kernel_index;
+  if (computed_kernel)
+  {
+    kernel_input_index = graph->addOperand(kernel_shape, float_type);
+    kernel_index = graph->addOperand(kernel_shape, float_type);
+  }
+  else
+  {
+    kernel_index = addConstant(*graph, kernel_shape, kernel);
+  }
+  const auto bias_index = addConstant(*graph, Shape{c.output_depth}, bias);
+  const auto conv_index = graph->addOperand(output_shape, float_type);
+  const auto operand_index = per_channel
+                                 ? addConstant(*graph, Shape{c.output_depth}, operand)
+                                 : graph->addOperand(output_shape, float_type);
+  const auto output_index = graph->addOperand(output_shape, float_type);
+  const auto result_index =
+      computed_kernel ? graph->addOperand(output_shape, float_type) : output_index;
+
+  static const std::vector<float> one{1.f};
+  OperandIndex one_index;
+  if (computed_kernel)
+  {
+    one_index = addConstant(*graph, Shape{1}, one);
+    graph->addOperation(std::make_unique<operation::Mul>(
+        OperandIndexSequence{kernel_input_index, one_index}, OperandIndexSequence{kernel_index},
+        operation::Mul::Param{Activation::NONE}));
+  }
+
+  const Stride stride{static_cast<uint32_t>(c.stride), static_cast<uint32_t>(c.stride)};
+  operation::Conv2D::Param conv_param{stride, Padding{c.padding}, Activation::RELU};
+  graph->addOperation(std::make_unique<operation::Conv2D>(
+      OperandIndexSequence{input_index, kernel_index, bias_index},
+      OperandIndexSequence{conv_index}, conv_param));
+  const Activation activation = c.epilogue == Epilogue::kChannelAdd ? Activation::NONE
+                                                                     : Activation::RELU6;
+  if (c.epilogue == Epilogue::kChannelMul)
+  {
+    graph->addOperation(std::make_unique<operation::Mul>(
+        OperandIndexSequence{conv_index, operand_index}, OperandIndexSequence{result_index},
+        operation::Mul::Param{activation}));
+  }
+  else
+  {
+    // Conv output on the right hand side
+    graph->addOperation(std::make_unique<operation::Add>(
+        OperandIndexSequence{operand_index, conv_index}, OperandIndexSequence{result_index},
+        operation::Add::Param{activation}));
+  }
+  if (computed_kernel)
+  {
+    graph->addOperation(std::make_unique<operation::Mul>(
+        OperandIndexSequence{result_index, one_index}, OperandIndexSequence{output_index},
+        operation::Mul::Param{Activation::NONE}));
+  }
+  graph->addInput(input_index);
+  if (!per_channel)
+    graph->addInput(operand_index);
+  if (computed_kernel)
+    graph->addInput(kernel_input_index);
+  graph->addOutput(output_index);
+  graph->finishBuilding();
+
+  onert::exec::Execution execution{compile(graph)};
+
+  std::vector<float> output(output_size);
+  execution.setInput(IOIndex{0}, input.data(), input.size() * sizeof(float));
+  if (!per_channel)
+    execution.setInput(IOIndex{1}, operand.data(), operand.size() * sizeof(float));
+  if (computed_kernel)
+  {
+    execution.setInput(IOIndex{per_channel ? 1u : 2u}, kernel.data(),
+                       kernel.size() * sizeof(float));
+  }
+  execution.setOutput(IOIndex{0}, output.data(), output.size() * sizeof(float));
+  execution.execute();
+
+  for (int y = 0; y < output_height; ++y)
+  {
+    for (int x = 0; x < output_width; ++x)
+    {
+      for (int oc = 0; oc < c.output_depth; ++oc)
+      {
+        float conv = bias[oc];
+        for (int ky = 0; ky < c.kernel_size; ++ky)
+        {
+          for (int kx = 0; kx < c.kernel_size; ++kx)
+          {
+            const int in_y = y * c.stride + ky - pad_top;
+            const int in_x = x * c.stride + kx - pad_left;
+            if (in_y < 0 || in_y >= c.height || in_x < 0 || in_x >= c.width)
+              continue;
+            for (int ic = 0; ic < c.input_depth; ++ic)
+            {
+              conv += input[(in_y * c.width + in_x) * c.input_depth + ic] *
+                      kernel[((oc * c.kernel_size + ky) * c.kernel_size + kx) * c.input_depth + ic];
+            }
+          }
+        }
+        conv = activate(conv, Activation::RELU);
+
+        const int offset = (y * output_width + x) * c.output_depth + oc;
+        const float value = operand[per_channel ? oc : offset];
+        const float expected = activate(
+            c.epilogue == Epilogue::kChannelMul ? conv * value : conv + value, activation);
+        ASSERT_NEAR(output[offset], expected, 1e-4f) << "at " << offset;
+      }
+    }
+  }
+}
+
+} // namespace
+
+TEST(ExecFusedConvKernels, winograd)
+{
+  verifyFusedConv({9, 7, 32, 3, 1, 32, PaddingType::SAME, Epilogue::kResidualAdd});
+  verifyFusedConv({8, 8, 32, 3, 1, 40, PaddingType::VALID, Epilogue::kChannelMul});
+}
+
+TEST(ExecFusedConvKernels, pointwise)
+{
+  verifyFusedConv({6, 5, 12, 1, 1, 20, PaddingType::SAME, Epilogue::kResidualAdd});
+  verifyFusedConv({6, 5, 12, 1, 1, 20, PaddingType::VALID, Epilogue::kChannelAdd});
+}
+
+TEST(ExecFusedConvKernels, spatial)
+{
+  verifyFusedConv({11, 9, 4, 3, 2, 8, PaddingType::SAME, Epilogue::kResidualAdd});
+  verifyFusedConv({7, 7, 3, 5, 1, 6, PaddingType::SAME, Epilogue::kChannelMul});
+  // Kernel of the input size is reduced to a matrix multiplication
+  verifyFusedConv({3, 3, 5, 3, 1, 7, PaddingType::VALID, Epilogue::kChannelAdd});
+}
+
+TEST(ExecFusedConvKernels, computed_kernel)
+{
+  // Memory of the kernel, which is bigger than the output, can be reused for the fused output
+  verifyFusedConv({3, 3, 5, 3, 1, 7, PaddingType::VALID, Epilogue::kChannelAdd}, true);
+  verifyFusedConv({4, 4, 8, 3, 1, 4, PaddingType::VALID, Epilogue::kResidualAdd}, true);
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+
+#include "ir/Graph.h"
+#include "exec/Execution.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/DepthwiseConv2D.h"
+#include "TestUtils.h"
+
+namespace
+{
+
+using namespace onert::ir;
+using onert_test::exec::makeData;
+using onert_test::exec::compile;
+
+struct HybridConvCase
+{
+  bool depthwise;
+  int batches, height, width, input_depth;
+  int kernel_size, stride, multiplier, output_depth;
+  PaddingType padding;
+};
+
+// Runs hybrid conv with int8 kernel and checks it against float conv with dequantized kernel
+// within the error bound of quantizing input to int8
+void verifyHybridConv(const HybridConvCase &c)
+{
+  const int output_height =
+      c.padding == PaddingType::SAME ? (c.height + c.stride - 1) / c.stride
+                                     : (c.height - c.kernel_size) / c.stride + 1;
+  const int output_width = c.padding == PaddingType::SAME
+                               ? (c.width + c.stride - 1) / c.stride
+                               : (c.width - c.kernel_size) / c.stride + 1;
+  const int pad_top = std::max((output_height - 1) * c.stride + c.kernel_size - c.height, 0) / 2;
+  const int pad_left = std::max((output_width - 1) * c.stride + c.kernel_size - c.width, 0) / 2;
+  const int kernel_taps = c.kernel_size * c.kernel_size;
+
+  const auto input = makeData(c.batches * c.height * c.width * c.input_depth, 1);
+  const auto bias = makeData(c.output_depth, 2);
+  const int kernel_elements =
+      c.depthwise ? kernel_taps * c.output_depth : c.output_depth * kernel_taps * c.input_depth;
+  std::vector<int8_t> kernel(kernel_elements);
+  for (int i = 0; i < kernel_elements; ++i)
+    kernel[i] = static_cast<int8_t>((i * 37) % 255 - 127);
+  const float kernel_scale = 0.004f;
+
+  auto graph = std::make_shared<Graph>();
+  const TypeInfo float_type{DataType::FLOAT32};
+  const auto input_index =
+      graph->addOperand(Shape{c.batches, c.height, c.width, c.input_depth}, float_type);
+  const int kernel_depth = c.depthwise ? c.output_depth : c.input_depth;
+  const auto kernel_shape =
+      Shape{c.depthwise ? 1 : c.output_depth, c.kernel_size, c.kernel_size, kernel_depth};
+  const auto kernel_index =
+      graph->addOperand(kernel_shape, TypeInfo{DataType::QUANT_INT8_SYMM, kernel_scale});
+  graph->operands().at(kernel_index).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(kernel.data()), kernel.size()));
+  const auto bias_index = graph->addOperand(Shape{c.output_depth}, float_type);
+  graph->operands().at(bias_index).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(bias.data()), bias.size() * sizeof(float)));
+  const auto output_index = graph->addOperand(
+      Shape{c.batches, output_height, output_width, c.output_depth}, float_type);
+
+  const Stride stride{static_cast<uint32_t>(c.stride), static_cast<uint32_t>(c.stride)};
+  const OperandIndexSequence inputs{input_index, kernel_index, bias_index};
+  if (c.depthwise)
+  {
+    operation::DepthwiseConv2D::Param param{stride, Padding{c.padding},
+                                            static_cast<uint32_t>(c.multiplier), Activation::NONE};
+    graph->addOperation(
+        std::make_unique<operation::DepthwiseConv2D>(inputs, OperandIndexSequence{output_index},
+                                                     param));
+  }
+  else
+  {
+    operation::Conv2D::Param param{stride, Padding{c.padding}, Activation::NONE};
+    graph->addOperation(
+        std::make_unique<operation::Conv2D>(inputs, OperandIndexSequence{output_index}, param));
+  }
+  graph->addInput(input_index);
+  graph->addOutput(output_index);
+  graph->finishBuilding();
+
+  onert::exec::Execution execution{compile(graph)};
+
+  std::vector<float> output(c.batches * output_height * output_width * c.output_depth);
+  execution.setInput(IOIndex{0}, input.data(), input.size() * sizeof(float));
+  execution.setOutput(IOIndex{0}, output.data(), output.size() * sizeof(float));
+  execution.execute();
+
+  const int batch_size = c.height * c.width * c.input_depth;
+  for (int b = 0; b < c.batches; ++b)
+  {
+    float input_max = 0;
+    for (int i = 0; i < batch_size; ++i)
+      input_max = std::max(input_max, std::abs(input[b * batch_size + i]));
+    const float input_error = input_max / 127 / 2;
+
+    for (int y = 0; y < output_height; ++y)
+    {
+      for (int x = 0; x < output_width; ++x)
+      {
+        for (int oc = 0; oc < c.output_depth; ++oc)
+        {
+          float expected = bias[oc];
+          float bound = 1e-4f;
+          for (int ky = 0; ky < c.kernel_size; ++ky)
+          {
+            for (int kx = 0; kx < c.kernel_size; ++kx)
+            {
+              const int in_y = y * c.stride - pad_top + ky;
+              const int in_x = x * c.stride - pad_left + kx;
+              if (in_y < 0 || in_y >= c.height || in_x < 0 || in_x >= c.width)
+                continue;
+              const float *in = input.data() + ((b * c.height + in_y) * c.width + in_x) *
+                                                   c.input_depth;
+              const int tap = ky * c.kernel_size + kx;
+              const int ic_begin = c.depthwise ? oc / c.multiplier : 0;
+              const int ic_end = c.depthwise ? ic_begin + 1 : c.input_depth;
+              for (int ic = ic_begin; ic < ic_end; ++ic)
+              {
+                const int k = c.depthwise ? tap * c.output_depth + oc
+                                          : (oc * kernel_taps + tap) * c.input_depth + ic;
+                const float weight = kernel[k] * kernel_scale;
+                expected += in[ic] * weight;
+                bound += std::abs(weight) * input_error;
+              }
+            }
+          }
+          const int o = ((b * output_height + y) * output_width + x) * c.output_depth + oc;
+          EXPECT_NEAR(output[o], expected, bound);
+        }
+      }
+    }
+  }
+}
+
+} // namespace
+
+TEST(ExecHybridKernels, conv2d)
+{
+  // im2col with stride and SAME padding
+  verifyHybridConv({false, 2, 7, 6, 3, 3, 2, 1, 5, PaddingType::SAME});
+  // 1x1 convolution takes quantized input as it is
+  verifyHybridConv({false, 1, 4, 5, 8, 1, 1, 1, 6, PaddingType::VALID});
+}
+
+TEST(ExecHybridKernels, depthwise_conv2d)
+{
+  verifyHybridConv({true, 2, 5, 5, 3, 3, 1, 2, 6, PaddingType::SAME});
+  verifyHybridConv({true, 1, 6, 7, 4, 3, 2, 1, 4, PaddingType::VALID});
+}
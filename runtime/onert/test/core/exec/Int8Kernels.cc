@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+
+#include "ir/Graph.h"
+#include "exec/Execution.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/DepthwiseConv2D.h"
+#include "ir/operation/FullyConnected.h"
+#include "TestUtils.h"
+
+namespace
+{
+
+using namespace onert::ir;
+using onert_test::exec::makeData;
+using onert_test::exec::compile;
+
+const float kInputScale = 0.02f;
+const int32_t kInputZeroPoint = -3;
+const float kOutputScale = 0.5f;
+const int32_t kOutputZeroPoint = 5;
+
+struct Int8ConvCase
+{
+  bool depthwise;
+  int batches, height, width, input_depth;
+  int kernel_size, stride, multiplier, output_depth;
+  PaddingType padding;
+  bool per_channel;
+};
+
+// Requantizes int32 accumulator like TFLite does in floating point
+int8_t requantize(int32_t acc, double multiplier)
+{
+  const double value = std::round(acc * multiplier) + kOutputZeroPoint;
+  return static_cast<int8_t>(std::min(127.0, std::max(-128.0, value)));
+}
+
+// Runs int8 conv and checks it against integer accumulation requantized in double, which may
+// differ by one from the fixed-point requantization
+void verifyInt8Conv(const Int8ConvCase &c)
+{
+  const int output_height =
+      c.padding == PaddingType::SAME ? (c.height + c.stride - 1) / c.stride
+                                     : (c.height - c.kernel_size) / c.stride + 1;
+  const int output_width = c.padding == PaddingType::SAME
+                               ? (c.width + c.stride - 1) / c.stride
+                               : (c.width - c.kernel_size) / c.stride + 1;
+  const int pad_top = std::max((output_height - 1) * c.stride + c.kernel_size - c.height, 0) / 2;
+  const int pad_left = std::max((output_width - 1) * c.stride + c.kernel_size - c.width, 0) / 2;
+  const int kernel_taps = c.kernel_size * c.kernel_size;
+
+  const auto input = makeData<int8_t>(c.batches * c.height * c.width * c.input_depth, 1);
+  const int kernel_elements =
+      c.depthwise ? kernel_taps * c.output_depth : c.output_depth * kernel_taps * c.input_depth;
+  const auto kernel = makeData<int8_t>(kernel_elements, 2);
+  std::vector<float> kernel_scales(c.output_depth, 0.01f);
+  if (c.per_channel)
+  {
+    for (int oc = 0; oc < c.output_depth; ++oc)
+      kernel_scales[oc] = 0.005f * (oc + 1);
+  }
+  std::vector<int32_t> bias(c.output_depth);
+  for (int oc = 0; oc < c.output_depth; ++oc)
+    bias[oc] = (oc * 97) % 401 - 200;
+
+  auto graph = std::make_shared<Graph>();
+  const auto input_index =
+      graph->addOperand(Shape{c.batches, c.height, c.width, c.input_depth},
+                        TypeInfo{DataType::QUANT_INT8_ASYMM, kInputScale, kInputZeroPoint});
+  const int kernel_depth = c.depthwise ? c.output_depth : c.input_depth;
+  const auto kernel_shape =
+      Shape{c.depthwise ? 1 : c.output_depth, c.kernel_size, c.kernel_size, kernel_depth};
+  TypeInfo kernel_type{DataType::QUANT_INT8_SYMM, kernel_scales[0]};
+  if (c.per_channel)
+    kernel_type.scales(kernel_scales);
+  const auto kernel_index = graph->addOperand(kernel_shape, kernel_type);
+  graph->operands().at(kernel_index).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(kernel.data()), kernel.size()));
+  const auto bias_index = graph->addOperand(Shape{c.output_depth}, TypeInfo{DataType::INT32});
+  graph->operands().at(bias_index).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(bias.data()), bias.size() * sizeof(int32_t)));
+  const auto output_index =
+      graph->addOperand(Shape{c.batches, output_height, output_width, c.output_depth},
+                        TypeInfo{DataType::QUANT_INT8_ASYMM, kOutputScale, kOutputZeroPoint});
+
+  const Stride stride{static_cast<uint32_t>(c.stride), static_cast<uint32_t>(c.stride)};
+  const OperandIndexSequence inputs{input_index, kernel_index, bias_index};
+  if (c.depthwise)
+  {
+    operation::DepthwiseConv2D::Param param{stride, Padding{c.padding},
+                                            static_cast<uint32_t>(c.multiplier), Activation::NONE};
+    graph->addOperation(
+        std::make_unique<operation::DepthwiseConv2D>(inputs, OperandIndexSequence{output_index},
+                                                     param));
+  }
+  else
+  {
+    operation::Conv2D::Param param{stride, Padding{c.padding}, Activation::NONE};
+    graph->addOperation(
+        std::make_unique<operation::Conv2D>(inputs, OperandIndexSequence{output_index}, param));
+  }
+  graph->addInput(input_index);
+  graph->addOutput(output_index);
+  graph->finishBuilding();
+
+  onert::exec::Execution execution{compile(graph)};
+  std::vector<int8_t> output(c.batches * output_height * output_width * c.output_depth);
+  execution.setInput(IOIndex{0}, input.data(), input.size());
+  execution.setOutput(IOIndex{0}, output.data(), output.size());
+  execution.execute();
+
+  for (int b = 0; b < c.batches; ++b)
+  {
+    for (int y = 0; y < output_height; ++y)
+    {
+      for (int x = 0; x < output_width; ++x)
+      {
+        for (int oc = 0; oc < c.output_depth; ++oc)
+        {
+          int32_t acc = bias[oc];
+          for (int ky = 0; ky < c.kernel_size; ++ky)
+          {
+            for (int kx = 0; kx < c.kernel_size; ++kx)
+            {
+              const int in_y = y * c.stride - pad_top + ky;
+              const int in_x = x * c.stride - pad_left + kx;
+              if (in_y < 0 || in_y >= c.height || in_x < 0 || in_x >= c.width)
+                continue;
+              const int8_t *in = input.data() + ((b * c.height + in_y) * c.width + in_x) *
+                                                    c.input_depth;
+              const int tap = ky * c.kernel_size + kx;
+              const int ic_begin = c.depthwise ? oc / c.multiplier : 0;
+              const int ic_end = c.depthwise ? ic_begin + 1 : c.input_depth;
+              for (int ic = ic_begin; ic < ic_end; ++ic)
+              {
+                const int k = c.depthwise ? tap * c.output_depth + oc
+                                          : (oc * kernel_taps + tap) * c.input_depth + ic;
+                acc += (in[ic] - kInputZeroPoint) * kernel[k];
+              }
+            }
+          }
+          const double multiplier =
+              static_cast<double>(kInputScale) * kernel_scales[oc] / kOutputScale;
+          const int o = ((b * output_height + y) * output_width + x) * c.output_depth + oc;
+          EXPECT_NEAR(output[o], requantize(acc, multiplier), 1) << "at " << o;
+        }
+      }
+    }
+  }
+}
+
+} // namespace
+
+TEST(ExecInt8Kernels, conv2d)
+{
+  // im2col with stride and SAME padding filled with input zero point
+  verifyInt8Conv({false, 2, 7, 6, 3, 3, 2, 1, 5, PaddingType::SAME, true});
+  // 1x1 convolution takes input as it is
+  verifyInt8Conv({false, 1, 4, 5, 8, 1, 1, 1, 6, PaddingType::VALID, false});
+}
+
+TEST(ExecInt8Kernels, depthwise_conv2d)
+{
+  verifyInt8Conv({true, 2, 5, 5, 3, 3, 1, 2, 6, PaddingType::SAME, true});
+  verifyInt8Conv({true, 1, 6, 7, 4, 3, 2, 1, 4, PaddingType::VALID, false});
+}
+
+TEST(ExecInt8Kernels, fully_connected)
+{
+  const int batches = 3;
+  const int input_size = 20;
+  const int num_units = 7;
+  const float weights_scale = 0.01f;
+
+  const auto input = makeData<int8_t>(batches * input_size, 3);
+  const auto weights = makeData<int8_t>(num_units * input_size, 4);
+  std::vector<int32_t> bias(num_units);
+  for (int u = 0; u < num_units; ++u)
+    bias[u] = u * 31 - 100;
+
+  auto graph = std::make_shared<Graph>();
+  const auto input_index =
+      graph->addOperand(Shape{batches, input_size},
+                        TypeInfo{DataType::QUANT_INT8_ASYMM, kInputScale, kInputZeroPoint});
+  const auto weights_index = graph->addOperand(
+      Shape{num_units, input_size}, TypeInfo{DataType::QUANT_INT8_SYMM, weights_scale});
+  graph->operands().at(weights_index).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(weights.data()), weights.size()));
+  const auto bias_index =
+      graph->addOperand(Shape{num_units}, TypeInfo{DataType::INT32, kInputScale * weights_scale});
+  graph->operands().at(bias_index).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(bias.data()), bias.size() * sizeof(int32_t)));
+  const auto output_index =
+      graph->addOperand(Shape{batches, num_units},
+                        TypeInfo{DataType::QUANT_INT8_ASYMM, kOutputScale, kOutputZeroPoint});
+
+  operation::FullyConnected::Param param{Activation::NONE};
+  graph->addOperation(std::make_unique<operation::FullyConnected>(
+      OperandIndexSequence{input_index, weights_index, bias_index},
+      OperandIndexSequence{output_index}, param));
+  graph->addInput(input_index);
+  graph->addOutput(output_index);
+  graph->finishBuilding();
+
+  onert::exec::Execution execution{compile(graph)};
+  std::vector<int8_t> output(batches * num_units);
+  execution.setInput(IOIndex{0}, input.data(), input.size());
+  execution.setOutput(IOIndex{0}, output.data(), output.size());
+  execution.execute();
+
+  const double multiplier = static_cast<double>(kInputScale) * weights_scale / kOutputScale;
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int u = 0; u < num_units; ++u)
+    {
+      int32_t acc = bias[u];
+      for (int i = 0; i < input_size; ++i)
+        acc += (input[b * input_size + i] - kInputZeroPoint) * weights[u * input_size + i];
+      EXPECT_NEAR(output[b * num_units + u], requantize(acc, multiplier), 1);
+    }
+  }
+}
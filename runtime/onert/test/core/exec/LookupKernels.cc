@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+
+#include "ir/Graph.h"
+#include "exec/Execution.h"
+#include "ir/operation/EmbeddingLookup.h"
+#include "ir/operation/HashtableLookup.h"
+#include "TestUtils.h"
+
+namespace
+{
+
+using namespace onert::ir;
+using onert_test::exec::compile;
+
+const int kRows = 6;
+const int kWidth = 3;
+
+// Constant [kRows, kWidth] table with value row * 10 + column
+OperandIndex addTable(Graph &graph, std::vector<float> &table)
+{
+  table.resize(kRows * kWidth);
+  for (int r = 0; r < kRows; ++r)
+    for (int c = 0; c < kWidth; ++c)
+      table[r * kWidth + c] = r * 10 + c;
+  const auto index = graph.addOperand(Shape{kRows, kWidth}, TypeInfo{DataType::FLOAT32});
+  graph.operands().at(index).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(table.data()), table.size() * sizeof(float)));
+  return index;
+}
+
+} // namespace
+
+TEST(ExecLookupKernels, embedding_lookup)
+{
+  auto graph = std::make_shared<Graph>();
+  std::vector<float> table;
+  const std::vector<int32_t> lookups{4, 0, 4, 2, 5};
+  const int num_lookups = lookups.size();
+  const auto lookups_index = graph->addOperand(Shape{num_lookups}, TypeInfo{DataType::INT32});
+  const auto values_index = addTable(*graph, table);
+  const auto output_index =
+      graph->addOperand(Shape{num_lookups, kWidth}, TypeInfo{DataType::FLOAT32});
+  graph->addOperation(std::make_unique<operation::EmbeddingLookup>(
+      OperandIndexSequence{lookups_index, values_index}, OperandIndexSequence{output_index}));
+  graph->addInput(lookups_index);
+  graph->addOutput(output_index);
+  graph->finishBuilding();
+
+  onert::exec::Execution execution{compile(graph)};
+  std::vector<float> output(num_lookups * kWidth);
+  execution.setInput(IOIndex{0}, lookups.data(), lookups.size() * sizeof(int32_t));
+  execution.setOutput(IOIndex{0}, output.data(), output.size() * sizeof(float));
+  execution.execute();
+
+  for (int i = 0; i < num_lookups; ++i)
+    for (int c = 0; c < kWidth; ++c)
+      EXPECT_EQ(output[i * kWidth + c], lookups[i] * 10 + c);
+}
+
+TEST(ExecLookupKernels, hashtable_lookup)
+{
+  auto graph = std::make_shared<Graph>();
+  std::vector<float> table;
+  // Keys are not sorted, and colliding keys share the low bits
+  const std::vector<int32_t> keys{1024, -7, 0, 3072, 2048, 99};
+  const std::vector<int32_t> lookups{2048, 5, -7, 1024, 99, 4096, 0};
+  const int num_lookups = lookups.size();
+
+  const auto lookups_index = graph->addOperand(Shape{num_lookups}, TypeInfo{DataType::INT32});
+  const auto keys_index = graph->addOperand(Shape{kRows}, TypeInfo{DataType::INT32});
+  graph->operands().at(keys_index).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(keys.data()), keys.size() * sizeof(int32_t)));
+  const auto values_index = addTable(*graph, table);
+  const auto output_index =
+      graph->addOperand(Shape{num_lookups, kWidth}, TypeInfo{DataType::FLOAT32});
+  const auto hits_index =
+      graph->addOperand(Shape{num_lookups}, TypeInfo{DataType::QUANT_UINT8_ASYMM, 1.f, 0});
+  graph->addOperation(std::make_unique<operation::HashtableLookup>(
+      OperandIndexSequence{lookups_index, keys_index, values_index},
+      OperandIndexSequence{output_index, hits_index}));
+  graph->addInput(lookups_index);
+  graph->addOutput(output_index);
+  graph->addOutput(hits_index);
+  graph->finishBuilding();
+
+  onert::exec::Execution execution{compile(graph)};
+  std::vector<float> output(num_lookups * kWidth, -1.f);
+  std::vector<uint8_t> hits(num_lookups, 2);
+  execution.setInput(IOIndex{0}, lookups.data(), lookups.size() * sizeof(int32_t));
+  execution.setOutput(IOIndex{0}, output.data(), output.size() * sizeof(float));
+  execution.setOutput(IOIndex{1}, hits.data(), hits.size());
+  execution.execute();
+
+  for (int i = 0; i < num_lookups; ++i)
+  {
+    const auto found = std::find(keys.begin(), keys.end(), lookups[i]);
+    const bool hit = found != keys.end();
+    const int row = hit ? found - keys.begin() : 0;
+    EXPECT_EQ(hits[i], hit ? 1 : 0);
+    for (int c = 0; c < kWidth; ++c)
+      EXPECT_EQ(output[i * kWidth + c], hit ? row * 10 + c : 0.f);
+  }
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+
+#include "exec/OnlineRescheduler.h"
+#include "TestUtils.h"
+
+namespace
+{
+
+using namespace onert::ir;
+using onert_test::exec::compileAddBias;
+
+TEST(OnlineRescheduler, reschedule)
+{
+  auto execution = std::make_shared<onert::exec::Execution>(compileAddBias());
+  const float input[2] = {1, 2};
+  float output[2] = {};
+  execution->setInput(IOIndex{0}, input, sizeof(input));
+  execution->setOutput(IOIndex{0}, output, sizeof(output));
+
+  std::atomic<int> compile_count{0};
+  {
+    onert::exec::OnlineRescheduler rescheduler{execution,
+                                               [&] {
+                                                 compile_count++;
+                                                 return compileAddBias();
+                                               },
+                                               2};
+
+    // Executors are replaced while buffers set to the execution are kept
+    for (int n = 0; n < 100; n++)
+    {
+      output[0] = output[1] = 0;
+      rescheduler.execute();
+      ASSERT_EQ(output[0], 11);
+      ASSERT_EQ(output[1], 22);
+    }
+  }
+  // Compilation has started at least once and the destructor has waited for it
+  EXPECT_GE(compile_count, 1);
+}
+
+TEST(OnlineRescheduler, neg_compile_failure)
+{
+  auto execution = std::make_shared<onert::exec::Execution>(compileAddBias());
+  onert::exec::OnlineRescheduler rescheduler{
+      execution, []() -> std::shared_ptr<onert::exec::ExecutorMap> {
+        throw std::runtime_error{"compile failure"};
+      },
+      1};
+
+  const float input[2] = {1, 2};
+  float output[2] = {};
+  execution->setInput(IOIndex{0}, input, sizeof(input));
+  execution->setOutput(IOIndex{0}, output, sizeof(output));
+
+  // Failure of compilation in background does not affect running
+  for (int n = 0; n < 10; n++)
+    EXPECT_NO_THROW(rescheduler.execute());
+  EXPECT_EQ(rescheduler.replacedCount(), 0);
+}
+
+TEST(OnlineRescheduler, neg_zero_period)
+{
+  auto execution = std::make_shared<onert::exec::Execution>(compileAddBias());
+  EXPECT_ANY_THROW(onert::exec::OnlineRescheduler(execution, [] { return compileAddBias(); }, 0));
+}
+
+} // namespace
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "ir/Graph.h"
+#include "exec/PipelineExecution.h"
+#include "ir/operation/Add.h"
+#include "TestUtils.h"
+
+namespace
+{
+
+using namespace onert::ir;
+using onert_test::exec::compile;
+
+// Model: output1 <= input1 + input2
+//        output2 <= input1 + bias
+// All shapes: {1, 2}, bias is constant
+std::shared_ptr<onert::exec::ExecutorMap> compileStage(const float *bias_data)
+{
+  auto graph = std::make_shared<Graph>();
+  Shape shape{1, 2};
+  TypeInfo type{DataType::FLOAT32};
+  auto operand_input1 = graph->addOperand(shape, type);
+  auto operand_input2 = graph->addOperand(shape, type);
+  auto operand_bias = graph->addOperand(shape, type);
+  auto operand_output1 = graph->addOperand(shape, type);
+  auto operand_output2 = graph->addOperand(shape, type);
+  graph->operands()
+      .at(operand_bias)
+      .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(bias_data), 8));
+  operation::Add::Param param;
+  param.activation = Activation::NONE;
+  graph->addOperation(std::make_unique<operation::Add>(
+      OperandIndexSequence{operand_input1, operand_input2}, OperandIndexSequence{operand_output1},
+      param));
+  graph->addOperation(std::make_unique<operation::Add>(
+      OperandIndexSequence{operand_input1, operand_bias}, OperandIndexSequence{operand_output2},
+      param));
+  graph->addInput(operand_input1);
+  graph->addInput(operand_input2);
+  graph->addOutput(operand_output1);
+  graph->addOutput(operand_output2);
+  graph->finishBuilding();
+
+  return compile(graph);
+}
+
+const float bias1[2] = {10, 20};
+const float bias2[2] = {100, 200};
+
+// Stage 2 takes (output2, output1) of stage 1 as its (input1, input2)
+std::unique_ptr<onert::exec::PipelineExecution> createPipeline()
+{
+  return std::make_unique<onert::exec::PipelineExecution>(
+      std::vector<std::shared_ptr<onert::exec::ExecutorMap>>{compileStage(bias1),
+                                                            compileStage(bias2)},
+      std::vector<std::vector<uint32_t>>{{1, 0}});
+}
+
+// Expected output1 and output2 of the pipeline
+void expectOutputs(const float *input1, const float *input2, const float *output1,
+                   const float *output2)
+{
+  for (int i = 0; i < 2; i++)
+  {
+    const float stage1_output1 = input1[i] + input2[i];
+    const float stage1_output2 = input1[i] + bias1[i];
+    EXPECT_EQ(output1[i], stage1_output2 + stage1_output1);
+    EXPECT_EQ(output2[i], stage1_output2 + bias2[i]);
+  }
+}
+
+TEST(PipelineExecution, single_request)
+{
+  auto pipeline = createPipeline();
+
+  const float input1[2] = {1, 2};
+  const float input2[2] = {3, 4};
+  float output1[2] = {};
+  float output2[2] = {};
+  pipeline->run({input1, input2}, {output1, output2});
+
+  expectOutputs(input1, input2, output1, output2);
+  EXPECT_EQ(pipeline->stageStat(0).runs, 1);
+  EXPECT_EQ(pipeline->stageStat(1).runs, 1);
+}
+
+TEST(PipelineExecution, concurrent_requests)
+{
+  auto pipeline = createPipeline();
+
+  constexpr int num_requests = 8;
+  float inputs[num_requests][2][2];
+  float outputs[num_requests][2][2] = {};
+  std::vector<std::thread> threads;
+  for (int n = 0; n < num_requests; n++)
+  {
+    inputs[n][0][0] = n;
+    inputs[n][0][1] = -n;
+    inputs[n][1][0] = 2 * n;
+    inputs[n][1][1] = 3 * n;
+    threads.emplace_back([&, n] {
+      pipeline->run({inputs[n][0], inputs[n][1]}, {outputs[n][0], outputs[n][1]});
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (int n = 0; n < num_requests; n++)
+    expectOutputs(inputs[n][0], inputs[n][1], outputs[n][0], outputs[n][1]);
+  EXPECT_EQ(pipeline->stageStat(0).runs, num_requests);
+  EXPECT_EQ(pipeline->stageStat(1).runs, num_requests);
+}
+
+TEST(PipelineExecution, neg_unconnected_input)
+{
+  EXPECT_ANY_THROW(onert::exec::PipelineExecution(
+      std::vector<std::shared_ptr<onert::exec::ExecutorMap>>{compileStage(bias1),
+                                                            compileStage(bias2)},
+      std::vector<std::vector<uint32_t>>{{0}}));
+}
+
+TEST(PipelineExecution, neg_wrong_output_index)
+{
+  EXPECT_ANY_THROW(onert::exec::PipelineExecution(
+      std::vector<std::shared_ptr<onert::exec::ExecutorMap>>{compileStage(bias1),
+                                                            compileStage(bias2)},
+      std::vector<std::vector<uint32_t>>{{0, 2}}));
+}
+
+TEST(PipelineExecution, neg_wrong_io_count)
+{
+  auto pipeline = createPipeline();
+
+  const float input[2] = {1, 2};
+  float output[2] = {};
+  EXPECT_ANY_THROW(pipeline->run({input}, {output}));
+}
+
+} // namespace
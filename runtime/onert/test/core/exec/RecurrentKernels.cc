@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+
+#include "ir/Graph.h"
+#include "exec/Execution.h"
+#include "ir/operation/LSTM.h"
+#include "ir/operation/RNN.h"
+#include "TestUtils.h"
+
+namespace
+{
+
+using namespace onert::ir;
+using onert_test::exec::makeData;
+using onert_test::exec::compile;
+
+float sigmoid(float x) { return 1.f / (1.f + std::exp(-x)); }
+
+// Keeps constant data alive and quantizes weights for hybrid model
+class ConstantBuilder
+{
+public:
+  ConstantBuilder(Graph &graph) : _graph{graph} {}
+
+  OperandIndex add(const Shape &shape, const std::vector<float> &data)
+  {
+    auto index = _graph.addOperand(shape, TypeInfo{DataType::FLOAT32});
+    setData(index, data.data(), data.size() * sizeof(float));
+    return index;
+  }
+
+  OperandIndex addWeights(const Shape &shape, const std::vector<float> &data, bool quantize)
+  {
+    if (!quantize)
+      return add(shape, data);
+
+    float max = 0;
+    for (auto value : data)
+      max = std::max(max, std::abs(value));
+    const float scale = max / 127.f;
+    std::vector<int8_t> quantized(data.size());
+    for (size_t i = 0; i < data.size(); ++i)
+      quantized[i] = static_cast<int8_t>(std::round(data[i] / scale));
+    _int8_storage.emplace_back(quantized);
+    auto index = _graph.addOperand(shape, TypeInfo{DataType::QUANT_INT8_SYMM, scale});
+    setData(index, _int8_storage.back().data(), quantized.size());
+    return index;
+  }
+
+  // Omitted optional operand is a zero-sized constant
+  OperandIndex addOmitted(const Shape &shape)
+  {
+    auto index = _graph.addOperand(shape, TypeInfo{DataType::FLOAT32});
+    setData(index, nullptr, 0);
+    return index;
+  }
+
+private:
+  void setData(OperandIndex index, const void *data, size_t size)
+  {
+    _graph.operands().at(index).data(
+        std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(data), size));
+  }
+
+private:
+  Graph &_graph;
+  std::vector<std::vector<int8_t>> _int8_storage;
+};
+
+// LSTM with peephole and projection, n_batch 2, n_input 3, n_cell 4, n_output 2
+void verifyLSTM(bool use_cifg, bool hybrid, float tolerance)
+{
+  const int n_batch = 2, n_input = 3, n_cell = 4, n_output = 2;
+  const float cell_clip = 0.6f;
+  std::vector<float> input_to[4], recurrent_to[4], bias[4], cell_to[3];
+  for (int g = use_cifg ? 1 : 0; g < 4; ++g)
+  {
+    input_to[g] = makeData(n_cell * n_input, 10 + g);
+    recurrent_to[g] = makeData(n_cell * n_output, 20 + g);
+    bias[g] = makeData(n_cell, 30 + g);
+    if (g < 3)
+      cell_to[g] = makeData(n_cell, 40 + g);
+  }
+  const auto projection = makeData(n_output * n_cell, 50);
+
+  auto graph = std::make_shared<Graph>();
+  ConstantBuilder constants{*graph};
+  const TypeInfo float_type{DataType::FLOAT32};
+  OperandIndexSequence inputs;
+  inputs.append(graph->addOperand(Shape{n_batch, n_input}, float_type));
+  for (int g = 0; g < 4; ++g)
+  {
+    inputs.append(input_to[g].empty()
+                      ? constants.addOmitted(Shape{0, 0})
+                      : constants.addWeights(Shape{n_cell, n_input}, input_to[g], hybrid));
+  }
+  for (int g = 0; g < 4; ++g)
+  {
+    inputs.append(recurrent_to[g].empty()
+                      ? constants.addOmitted(Shape{0, 0})
+                      : constants.addWeights(Shape{n_cell, n_output}, recurrent_to[g], hybrid));
+  }
+  for (int g = 0; g < 3; ++g)
+  {
+    inputs.append(cell_to[g].empty() ? constants.addOmitted(Shape{0})
+                                     : constants.add(Shape{n_cell}, cell_to[g]));
+  }
+  for (int g = 0; g < 4; ++g)
+  {
+    inputs.append(bias[g].empty() ? constants.addOmitted(Shape{0})
+                                  : constants.add(Shape{n_cell}, bias[g]));
+  }
+  inputs.append(constants.addWeights(Shape{n_output, n_cell}, projection, hybrid));
+  inputs.append(constants.addOmitted(Shape{0}));
+  const auto output_state_in = graph->addOperand(Shape{n_batch, n_output}, float_type);
+  const auto cell_state_in = graph->addOperand(Shape{n_batch, n_cell}, float_type);
+  inputs.append(output_state_in);
+  inputs.append(cell_state_in);
+
+  OperandIndexSequence outputs;
+  outputs.append(graph->addOperand(Shape{n_batch, n_cell * (use_cifg ? 3 : 4)}, float_type));
+  outputs.append(graph->addOperand(Shape{n_batch, n_output}, float_type));
+  outputs.append(graph->addOperand(Shape{n_batch, n_cell}, float_type));
+  outputs.append(graph->addOperand(Shape{n_batch, n_output}, float_type));
+
+  operation::LSTM::Param param;
+  param.activation = Activation::TANH;
+  param.cell_threshold = cell_clip;
+  param.projection_threshold = 0.f;
+  graph->addOperation(std::make_unique<operation::LSTM>(inputs, outputs, param));
+  graph->addInput(inputs.at(0));
+  graph->addInput(output_state_in);
+  graph->addInput(cell_state_in);
+  graph->addOutput(outputs.at(operation::LSTM::Output::CELL_STATE_OUT));
+  graph->addOutput(outputs.at(operation::LSTM::Output::OUTPUT));
+  graph->finishBuilding();
+
+  onert::exec::Execution execution{compile(graph)};
+
+  const auto input = makeData(n_batch * n_input, 100);
+  const auto prev_output = makeData(n_batch * n_output, 101);
+  const auto prev_cell = makeData(n_batch * n_cell, 102);
+  std::vector<float> cell_state_out(n_batch * n_cell);
+  std::vector<float> output(n_batch * n_output);
+  execution.setInput(IOIndex{0}, input.data(), input.size() * sizeof(float));
+  execution.setInput(IOIndex{1}, prev_output.data(), prev_output.size() * sizeof(float));
+  execution.setInput(IOIndex{2}, prev_cell.data(), prev_cell.size() * sizeof(float));
+  execution.setOutput(IOIndex{0}, cell_state_out.data(), cell_state_out.size() * sizeof(float));
+  execution.setOutput(IOIndex{1}, output.data(), output.size() * sizeof(float));
+  execution.execute();
+
+  // Straightforward per-element computation
+  auto gate = [&](int g, int b, int c) {
+    float acc = bias[g][c];
+    for (int i = 0; i < n_input; ++i)
+      acc += input_to[g][c * n_input + i] * input[b * n_input + i];
+    for (int i = 0; i < n_output; ++i)
+      acc += recurrent_to[g][c * n_output + i] * prev_output[b * n_output + i];
+    return acc;
+  };
+  std::vector<float> hidden(n_batch * n_cell);
+  for (int b = 0; b < n_batch; ++b)
+  {
+    for (int c = 0; c < n_cell; ++c)
+    {
+      const float prev = prev_cell[b * n_cell + c];
+      const float f = sigmoid(gate(1, b, c) + cell_to[1][c] * prev);
+      const float i = use_cifg ? 1.f - f : sigmoid(gate(0, b, c) + cell_to[0][c] * prev);
+      float cell = f * prev + i * std::tanh(gate(2, b, c));
+      cell = std::max(-cell_clip, std::min(cell_clip, cell));
+      const float o = sigmoid(gate(3, b, c) + cell_to[2][c] * cell);
+      EXPECT_NEAR(cell_state_out[b * n_cell + c], cell, tolerance);
+      hidden[b * n_cell + c] = o * std::tanh(cell);
+    }
+    for (int o = 0; o < n_output; ++o)
+    {
+      float expected = 0;
+      for (int c = 0; c < n_cell; ++c)
+        expected += projection[o * n_cell + c] * hidden[b * n_cell + c];
+      EXPECT_NEAR(output[b * n_output + o], expected, tolerance);
+    }
+  }
+}
+
+TEST(RecurrentKernels, lstm_float)
+{
+  verifyLSTM(false, false, 1e-5f);
+  verifyLSTM(true, false, 1e-5f);
+}
+
+TEST(RecurrentKernels, lstm_hybrid)
+{
+  verifyLSTM(false, true, 2e-2f);
+  verifyLSTM(true, true, 2e-2f);
+}
+
+TEST(RecurrentKernels, rnn)
+{
+  // output = hidden_state_out = tanh(input * weights^T + hidden_in * recurrent^T + bias)
+  auto graph = std::make_shared<Graph>();
+  ConstantBuilder constants{*graph};
+  const TypeInfo float_type{DataType::FLOAT32};
+  static const std::vector<float> weights = {0.1, 0.2, 0.3, -0.3, -0.2, -0.1};
+  static const std::vector<float> recurrent = {0.5, 0, 0, 0.5};
+  static const std::vector<float> bias = {0.1, -0.1};
+  auto input = graph->addOperand(Shape{2, 3}, float_type);
+  auto hidden_in = graph->addOperand(Shape{2, 2}, float_type);
+  auto output = graph->addOperand(Shape{2, 2}, float_type);
+  auto hidden_out = graph->addOperand(Shape{2, 2}, float_type);
+  operation::RNN::Param param;
+  param.activation = Activation::TANH;
+  graph->addOperation(std::make_unique<operation::RNN>(
+      OperandIndexSequence{input, constants.add(Shape{2, 3}, weights),
+                           constants.add(Shape{2, 2}, recurrent), constants.add(Shape{2}, bias),
+                           hidden_in},
+      OperandIndexSequence{output, hidden_out}, param));
+  graph->addInput(input);
+  graph->addInput(hidden_in);
+  graph->addOutput(output);
+  graph->addOutput(hidden_out);
+  graph->finishBuilding();
+
+  onert::exec::Execution execution{compile(graph)};
+
+  const float input_buffer[6] = {1, 2, 3, -1, 0, 1};
+  const float hidden_in_buffer[4] = {1, -1, 0.5, 0.5};
+  float output_buffer[4] = {};
+  float hidden_out_buffer[4] = {};
+  execution.setInput(IOIndex{0}, input_buffer, sizeof(input_buffer));
+  execution.setInput(IOIndex{1}, hidden_in_buffer, sizeof(hidden_in_buffer));
+  execution.setOutput(IOIndex{0}, output_buffer, sizeof(output_buffer));
+  execution.setOutput(IOIndex{1}, hidden_out_buffer, sizeof(hidden_out_buffer));
+  execution.execute();
+
+  const float expected[4] = {std::tanh(2.0f), std::tanh(-1.6f), std::tanh(0.55f),
+                             std::tanh(0.35f)};
+  for (int i = 0; i < 4; ++i)
+  {
+    EXPECT_NEAR(output_buffer[i], expected[i], 1e-5);
+    EXPECT_EQ(hidden_out_buffer[i], output_buffer[i]);
+  }
+}
+
+} // namespace
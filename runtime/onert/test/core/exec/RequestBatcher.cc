@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "exec/RequestBatcher.h"
+#include "TestUtils.h"
+
+namespace
+{
+
+using namespace onert::ir;
+using onert_test::exec::compileAddBias;
+
+std::shared_ptr<onert::exec::BatchBucketExecution> compileBuckets()
+{
+  std::map<uint32_t, std::shared_ptr<onert::exec::ExecutorMap>> buckets;
+  for (uint32_t batch : {1, 2, 4})
+    buckets.emplace(batch, compileAddBias(batch));
+  return std::make_shared<onert::exec::BatchBucketExecution>(buckets);
+}
+
+TEST(RequestBatcher, single_request)
+{
+  onert::exec::RequestBatcher batcher{compileBuckets(), 4, std::chrono::microseconds{100}};
+
+  const float input[2] = {1, 2};
+  float output[2] = {};
+  batcher.run({input}, {output});
+
+  EXPECT_EQ(output[0], 11);
+  EXPECT_EQ(output[1], 22);
+}
+
+TEST(RequestBatcher, concurrent_requests)
+{
+  onert::exec::RequestBatcher batcher{compileBuckets(), 4, std::chrono::milliseconds{20}};
+
+  constexpr int num_requests = 7;
+  float inputs[num_requests][2];
+  float outputs[num_requests][2] = {};
+  std::vector<std::thread> threads;
+  for (int n = 0; n < num_requests; n++)
+  {
+    inputs[n][0] = n;
+    inputs[n][1] = -n;
+    threads.emplace_back([&, n] { batcher.run({inputs[n]}, {outputs[n]}); });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (int n = 0; n < num_requests; n++)
+  {
+    EXPECT_EQ(outputs[n][0], n + 10);
+    EXPECT_EQ(outputs[n][1], -n + 20);
+  }
+}
+
+TEST(RequestBatcher, neg_wrong_io_count)
+{
+  onert::exec::RequestBatcher batcher{compileBuckets(), 4, std::chrono::microseconds{100}};
+
+  const float input[2] = {1, 2};
+  EXPECT_ANY_THROW(batcher.run({input, input}, {}));
+}
+
+TEST(RequestBatcher, neg_too_large_max_batch)
+{
+  EXPECT_ANY_THROW(
+      onert::exec::RequestBatcher(compileBuckets(), 8, std::chrono::microseconds{100}));
+}
+
+} // namespace
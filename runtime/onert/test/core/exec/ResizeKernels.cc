@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ir/Graph.h"
+#include "exec/Execution.h"
+#include "ir/operation/ResizeNearestNeighbor.h"
+#include "TestUtils.h"
+
+using namespace onert::ir;
+using onert_test::exec::compile;
+
+TEST(ExecResizeKernels, nearest_neighbor_upsampling)
+{
+  const int height = 2;
+  const int width = 3;
+  const int depth = 2;
+  const int factor = 2;
+  auto graph = std::make_shared<Graph>();
+  const TypeInfo float_type{DataType::FLOAT32};
+  const auto input_index = graph->addOperand(Shape{1, height, width, depth}, float_type);
+  const auto output_index =
+      graph->addOperand(Shape{1, height * factor, width * factor, depth}, float_type);
+  operation::ResizeNearestNeighbor::Param param{height * factor, width * factor, false, false};
+  graph->addOperation(std::make_unique<operation::ResizeNearestNeighbor>(
+      OperandIndexSequence{input_index}, OperandIndexSequence{output_index}, param));
+  graph->addInput(input_index);
+  graph->addOutput(output_index);
+  graph->finishBuilding();
+
+  onert::exec::Execution execution{compile(graph)};
+
+  std::vector<float> input(height * width * depth);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = i;
+  std::vector<float> output(input.size() * factor * factor);
+  execution.setInput(IOIndex{0}, input.data(), input.size() * sizeof(float));
+  execution.setOutput(IOIndex{0}, output.data(), output.size() * sizeof(float));
+  execution.execute();
+
+  // Each input pixel fills a factor x factor block
+  for (int y = 0; y < height * factor; ++y)
+    for (int x = 0; x < width * factor; ++x)
+      for (int d = 0; d < depth; ++d)
+        ASSERT_EQ(output[(y * width * factor + x) * depth + d],
+                  input[((y / factor) * width + x / factor) * depth + d]);
+}
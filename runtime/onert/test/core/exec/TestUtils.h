@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_TEST_CORE_EXEC_TEST_UTILS_H__
+#define __ONERT_TEST_CORE_EXEC_TEST_UTILS_H__
+
+#include "ir/Graph.h"
+#include "compiler/Compiler.h"
+#include "ir/operation/Add.h"
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace onert_test
+{
+namespace exec
+{
+
+/**
+ * @brief Linear congruential generator, which gives the same sequence on every platform
+ */
+class LinearCongruential
+{
+public:
+  explicit LinearCongruential(uint32_t seed) : _state{seed} {}
+
+public:
+  uint32_t next()
+  {
+    _state = _state * 1664525u + 1013904223u;
+    return _state;
+  }
+
+private:
+  uint32_t _state;
+};
+
+/**
+ * @brief  Make uniform random data in [-1, 1) for floating point type, and in the range of a
+ *         byte of the same signedness for integral type
+ */
+template <typename T = float> std::vector<T> makeData(int size, uint32_t seed)
+{
+  LinearCongruential random{seed};
+  std::vector<T> data(size);
+  for (auto &value : data)
+  {
+    const uint32_t bits = random.next();
+    if (std::is_floating_point<T>::value)
+      value = static_cast<T>(static_cast<float>(bits >> 8) / (1 << 24) * 2.f - 1.f);
+    else
+      value = static_cast<T>(static_cast<int32_t>(bits >> 24) -
+                             (std::is_signed<T>::value ? 128 : 0));
+  }
+  return data;
+}
+
+/**
+ * @brief  Compile a graph, which has finished building, as the primary subgraph of a model
+ */
+inline std::shared_ptr<onert::exec::ExecutorMap>
+compile(const std::shared_ptr<onert::ir::Graph> &graph)
+{
+  auto subgs = std::make_shared<onert::ir::Subgraphs>();
+  subgs->push(onert::ir::SubgraphIndex{0}, graph);
+  onert::compiler::Compiler compiler{subgs};
+  return compiler.compile();
+}
+
+/**
+ * @brief  Compile model of output <= input + bias
+ * @note   input, output shape: {batch, 2}
+ *         bias(constant) shape: {1, 2}, value: {10, 20}
+ */
+inline std::shared_ptr<onert::exec::ExecutorMap> compileAddBias(uint32_t batch = 1)
+{
+  using namespace onert::ir;
+
+  auto graph = std::make_shared<Graph>();
+  Shape shape{static_cast<int32_t>(batch), 2};
+  TypeInfo type{DataType::FLOAT32};
+  static float bias_data[2] = {10, 20};
+  auto operand_input = graph->addOperand(shape, type);
+  auto operand_bias = graph->addOperand(Shape{1, 2}, type);
+  auto operand_output = graph->addOperand(shape, type);
+  graph->operands()
+      .at(operand_bias)
+      .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&bias_data), 8));
+  operation::Add::Param param;
+  param.activation = Activation::NONE;
+  graph->addOperation(std::make_unique<operation::Add>(
+      OperandIndexSequence{operand_input, operand_bias}, OperandIndexSequence{operand_output},
+      param));
+  graph->addInput(operand_input);
+  graph->addOutput(operand_output);
+  graph->finishBuilding();
+
+  return compile(graph);
+}
+
+} // namespace exec
+} // namespace onert_test
+
+#endif // __ONERT_TEST_CORE_EXEC_TEST_UTILS_H__
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <nnfw_experimental.h>
+
+#include "fixtures.h"
+#include "NNPackages.h"
+
+using TestBatchSizesAddModelLoaded = ValidationTestModelLoaded<NNPackages::ADD>;
+
+/**
+ * @brief Testing "Add" model (output = input + 2, shape = [1]) compiled for batch 1, 2 and 4
+ */
+TEST_F(TestBatchSizesAddModelLoaded, padded_batch)
+{
+  const uint32_t batch_sizes[] = {4, 1, 2};
+  ASSERT_EQ(nnfw_set_batch_sizes(_session, batch_sizes, 3), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_prepare(_session), NNFW_STATUS_NO_ERROR);
+
+  // Batch 3 runs on batch 4 without dynamic shape inference
+  nnfw_tensorinfo ti = {NNFW_TYPE_TENSOR_FLOAT32, 1, {3}};
+  ASSERT_EQ(nnfw_set_input_tensorinfo(_session, 0, &ti), NNFW_STATUS_NO_ERROR);
+
+  nnfw_tensorinfo ti_output;
+  ASSERT_EQ(nnfw_output_tensorinfo(_session, 0, &ti_output), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(ti_output.rank, 1);
+  ASSERT_EQ(ti_output.dims[0], 3);
+
+  std::vector<float> input = {1, 2, 3};
+  std::vector<float> output(3);
+  ASSERT_EQ(nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, input.data(),
+                           sizeof(float) * input.size()),
+            NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(),
+                            sizeof(float) * output.size()),
+            NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_NO_ERROR);
+
+  ASSERT_FLOAT_EQ(output[0], 3.0);
+  ASSERT_FLOAT_EQ(output[1], 4.0);
+  ASSERT_FLOAT_EQ(output[2], 5.0);
+}
+
+TEST_F(TestBatchSizesAddModelLoaded, neg_too_large_batch)
+{
+  const uint32_t batch_sizes[] = {1, 2};
+  ASSERT_EQ(nnfw_set_batch_sizes(_session, batch_sizes, 2), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_prepare(_session), NNFW_STATUS_NO_ERROR);
+
+  nnfw_tensorinfo ti = {NNFW_TYPE_TENSOR_FLOAT32, 1, {3}};
+  ASSERT_EQ(nnfw_set_input_tensorinfo(_session, 0, &ti), NNFW_STATUS_ERROR);
+}
+
+TEST_F(TestBatchSizesAddModelLoaded, neg_zero_batch)
+{
+  const uint32_t batch_sizes[] = {0, 2};
+  ASSERT_EQ(nnfw_set_batch_sizes(_session, batch_sizes, 2), NNFW_STATUS_ERROR);
+}
+
+TEST_F(TestBatchSizesAddModelLoaded, neg_set_io_with_request_batching)
+{
+  ASSERT_EQ(nnfw_set_request_batching(_session, 4, 100), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_prepare(_session), NNFW_STATUS_NO_ERROR);
+
+  // Buffers and batch of the executions are owned by the request batcher thread
+  std::vector<float> input = {1, 2};
+  std::vector<float> output(2);
+  ASSERT_EQ(nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, input.data(),
+                           sizeof(float) * input.size()),
+            NNFW_STATUS_INVALID_STATE);
+  ASSERT_EQ(nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(),
+                            sizeof(float) * output.size()),
+            NNFW_STATUS_INVALID_STATE);
+  nnfw_tensorinfo ti = {NNFW_TYPE_TENSOR_FLOAT32, 1, {2}};
+  ASSERT_EQ(nnfw_set_input_tensorinfo(_session, 0, &ti), NNFW_STATUS_INVALID_STATE);
+
+  // Requests still run
+  const void *inputs[] = {input.data()};
+  void *outputs[] = {output.data()};
+  ASSERT_EQ(nnfw_run_request(_session, inputs, outputs), NNFW_STATUS_NO_ERROR);
+  ASSERT_FLOAT_EQ(output[0], 3.0);
+}
+
+TEST_F(TestBatchSizesAddModelLoaded, neg_request_batching_over_batch_sizes)
+{
+  const uint32_t batch_sizes[] = {1, 2};
+  ASSERT_EQ(nnfw_set_batch_sizes(_session, batch_sizes, 2), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_set_request_batching(_session, 4, 100), NNFW_STATUS_ERROR);
+}
+
+TEST_F(TestBatchSizesAddModelLoaded, neg_batch_sizes_under_request_batching)
+{
+  ASSERT_EQ(nnfw_set_request_batching(_session, 4, 100), NNFW_STATUS_NO_ERROR);
+  const uint32_t batch_sizes[] = {1, 2};
+  ASSERT_EQ(nnfw_set_batch_sizes(_session, batch_sizes, 2), NNFW_STATUS_ERROR);
+}
@@ -76,8 +76,16 @@ void H5Formatter::loadInputs(const std::string &filename, std::vector<Allocation
             throw std::runtime_error(
                 "model input type is qasymm8, bool or uint8. But h5 data type is different.");
           break;
+        case NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED:
+          if (type == H5::PredType::STD_I8BE || type == H5::PredType::STD_I8LE)
+            data_set.read(inputs[i].data(), H5::PredType::NATIVE_INT8);
+          else
+            throw std::runtime_error("model input type is qasymm8 signed. But h5 data type is "
+                                     "different.");
+          break;
         default:
-          throw std::runtime_error("nnpkg_run can load f32, i32, qasymm8, bool and uint8.");
+          throw std::runtime_error(
+              "nnpkg_run can load f32, i32, qasymm8, qasymm8 signed, bool and uint8.");
       }
       NNPR_ENSURE_STATUS(nnfw_set_input(session_, i, ti.dtype, inputs[i].data(), bufsz));
       NNPR_ENSURE_STATUS(nnfw_set_input_layout(session_, i, NNFW_LAYOUT_CHANNELS_LAST));
@@ -154,6 +162,7 @@ void H5Formatter::dumpOutputs(const std::string &filename, std::vector<Allocatio
           break;
         }
         case NNFW_TYPE_TENSOR_BOOL:
+        case NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED:
         {
           H5::DataSet data_set =
               value_group.createDataSet(std::to_string(i), H5::PredType::STD_I8LE, data_space);
@@ -161,7 +170,8 @@ void H5Formatter::dumpOutputs(const std::string &filename, std::vector<Allocatio
           break;
         }
         default:
-          throw std::runtime_error("nnpkg_run can dump f32, i32, qasymm8, bool and uint8.");
+          throw std::runtime_error(
+              "nnpkg_run can dump f32, i32, qasymm8, qasymm8 signed, bool and uint8.");
       }
     }
   }
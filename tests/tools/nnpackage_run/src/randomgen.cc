@@ -53,6 +53,7 @@ void RandomGenerator::generate(std::vector<Allocation> &inputs)
         randomData<bool>(randgen, inputs[i].data(), num_elems(&ti));
         break;
       case NNFW_TYPE_TENSOR_UINT8:
+      case NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED:
         randomData<uint8_t>(randgen, inputs[i].data(), num_elems(&ti));
         break;
       case NNFW_TYPE_TENSOR_INT32: